@@ -83,7 +83,7 @@ static void btloop_persist_pairing(const char *addr_str, const char *type,
     saved = true;
   }
   if (saved) {
-    settings_save(gconfig_getContext(), true);
+    gconfig_commit();
   }
 }
 
@@ -255,5 +255,5 @@ void btloop_clear_pairings(void) {
   settings_put_string(gconfig_getContext(), PARAM_BT_KEYBOARD, "");
   settings_put_string(gconfig_getContext(), PARAM_BT_MOUSE, "");
   settings_put_string(gconfig_getContext(), PARAM_BT_GAMEPAD, "");
-  settings_save(gconfig_getContext(), true);
+  gconfig_commit();
 }
@@ -1467,202 +1467,209 @@ static const unsigned char data_mngr_bt_shtml[] = {
 	0x6f, 0x61, 0x64, 0x20, 0x3d, 0x20, 0x62, 0x75, 0x69, 0x6c, 
 	0x64, 0x50, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x28, 0x29, 
 	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 
-	0x72, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x64, 0x20, 
-	0x3d, 0x20, 0x62, 0x74, 0x6f, 0x61, 0x28, 0x4a, 0x53, 0x4f, 
-	0x4e, 0x2e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x69, 0x66, 
-	0x79, 0x28, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x29, 
-	0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 
-	0x65, 0x74, 0x63, 0x68, 0x28, 0x22, 0x2f, 0x73, 0x61, 0x76, 
-	0x65, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x2e, 0x63, 0x67, 
-	0x69, 0x3f, 0x6a, 0x73, 0x6f, 0x6e, 0x3d, 0x22, 0x20, 0x2b, 
-	0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x55, 0x52, 0x49, 
-	0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x28, 
-	0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x64, 0x29, 0x29, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 
+	0x74, 0x63, 0x68, 0x28, 0x22, 0x2f, 0x73, 0x61, 0x76, 0x65, 
+	0x70, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x2e, 0x63, 0x67, 0x69, 
+	0x22, 0x2c, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 
+	0x64, 0x3a, 0x20, 0x22, 0x50, 0x4f, 0x53, 0x54, 0x22, 0x2c, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x66, 0x75, 0x6e, 0x63, 
-	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x72, 0x65, 0x73, 0x70, 
-	0x6f, 0x6e, 0x73, 0x65, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 
-	0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 
-	0x6e, 0x73, 0x65, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 
-	0x3b, 0x20, 0x7d, 0x29, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x3a, 0x20, 
+	0x7b, 0x20, 0x22, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 
+	0x2d, 0x54, 0x79, 0x70, 0x65, 0x22, 0x3a, 0x20, 0x22, 0x61, 
+	0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 
+	0x2f, 0x6a, 0x73, 0x6f, 0x6e, 0x22, 0x20, 0x7d, 0x2c, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x74, 0x68, 0x65, 0x6e, 
-	0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
-	0x28, 0x74, 0x65, 0x78, 0x74, 0x29, 0x20, 0x7b, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x6f, 0x64, 0x79, 0x3a, 0x20, 0x4a, 0x53, 0x4f, 0x4e, 
+	0x2e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x69, 0x66, 0x79, 
+	0x28, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x29, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x74, 0x72, 0x79, 0x20, 0x7b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 
+	0x74, 0x68, 0x65, 0x6e, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 
+	0x69, 0x6f, 0x6e, 0x20, 0x28, 0x72, 0x65, 0x73, 0x70, 0x6f, 
+	0x6e, 0x73, 0x65, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 
+	0x75, 0x72, 0x6e, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 
+	0x73, 0x65, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x3b, 
+	0x20, 0x7d, 0x29, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 
-	0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3d, 0x20, 0x4a, 0x53, 
-	0x4f, 0x4e, 0x2e, 0x70, 0x61, 0x72, 0x73, 0x65, 0x28, 0x74, 
-	0x65, 0x78, 0x74, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 
+	0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 
+	0x74, 0x65, 0x78, 0x74, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x64, 0x61, 
-	0x74, 0x61, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 
-	0x3d, 0x3d, 0x3d, 0x20, 0x32, 0x30, 0x30, 0x29, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x74, 0x72, 0x79, 0x20, 0x7b, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 
-	0x53, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x6d, 0x6f, 0x64, 0x65, 
-	0x20, 0x3d, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x43, 0x68, 0x65, 
-	0x63, 0x6b, 0x62, 0x6f, 0x78, 0x20, 0x26, 0x26, 0x20, 0x6d, 
-	0x6f, 0x64, 0x65, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 
-	0x78, 0x2e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x20, 
-	0x3f, 0x20, 0x32, 0x20, 0x3a, 0x20, 0x30, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 
+	0x64, 0x61, 0x74, 0x61, 0x20, 0x3d, 0x20, 0x4a, 0x53, 0x4f, 
+	0x4e, 0x2e, 0x70, 0x61, 0x72, 0x73, 0x65, 0x28, 0x74, 0x65, 
+	0x78, 0x74, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x64, 0x61, 0x74, 
+	0x61, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x3d, 
+	0x3d, 0x3d, 0x20, 0x32, 0x30, 0x30, 0x29, 0x20, 0x7b, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x53, 0x74, 
-	0x61, 0x74, 0x65, 0x2e, 0x6d, 0x6f, 0x75, 0x73, 0x65, 0x53, 
-	0x70, 0x65, 0x65, 0x64, 0x20, 0x3d, 0x20, 0x6d, 0x6f, 0x75, 
-	0x73, 0x65, 0x53, 0x70, 0x65, 0x65, 0x64, 0x2e, 0x76, 0x61, 
-	0x6c, 0x75, 0x65, 0x2e, 0x74, 0x6f, 0x53, 0x74, 0x72, 0x69, 
-	0x6e, 0x67, 0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 
-	0x69, 0x74, 0x69, 0x61, 0x6c, 0x53, 0x74, 0x61, 0x74, 0x65, 
-	0x2e, 0x67, 0x61, 0x6d, 0x65, 0x70, 0x61, 0x64, 0x41, 0x75, 
-	0x74, 0x6f, 0x73, 0x68, 0x6f, 0x6f, 0x74, 0x20, 0x3d, 0x20, 
+	0x20, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x53, 
+	0x74, 0x61, 0x74, 0x65, 0x2e, 0x6d, 0x6f, 0x64, 0x65, 0x20, 
+	0x3d, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x43, 0x68, 0x65, 0x63, 
+	0x6b, 0x62, 0x6f, 0x78, 0x20, 0x26, 0x26, 0x20, 0x6d, 0x6f, 
+	0x64, 0x65, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 
+	0x2e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x20, 0x3f, 
+	0x20, 0x32, 0x20, 0x3a, 0x20, 0x30, 0x3b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x53, 0x74, 0x61, 
+	0x74, 0x65, 0x2e, 0x6d, 0x6f, 0x75, 0x73, 0x65, 0x53, 0x70, 
+	0x65, 0x65, 0x64, 0x20, 0x3d, 0x20, 0x6d, 0x6f, 0x75, 0x73, 
+	0x65, 0x53, 0x70, 0x65, 0x65, 0x64, 0x2e, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x2e, 0x74, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 
+	0x67, 0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x69, 
+	0x74, 0x69, 0x61, 0x6c, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2e, 
 	0x67, 0x61, 0x6d, 0x65, 0x70, 0x61, 0x64, 0x41, 0x75, 0x74, 
-	0x6f, 0x73, 0x68, 0x6f, 0x6f, 0x74, 0x20, 0x3f, 0x20, 0x67, 
+	0x6f, 0x73, 0x68, 0x6f, 0x6f, 0x74, 0x20, 0x3d, 0x20, 0x67, 
 	0x61, 0x6d, 0x65, 0x70, 0x61, 0x64, 0x41, 0x75, 0x74, 0x6f, 
-	0x73, 0x68, 0x6f, 0x6f, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 
-	0x65, 0x2e, 0x74, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 
-	0x28, 0x29, 0x20, 0x3a, 0x20, 0x22, 0x30, 0x22, 0x3b, 0xa, 
+	0x73, 0x68, 0x6f, 0x6f, 0x74, 0x20, 0x3f, 0x20, 0x67, 0x61, 
+	0x6d, 0x65, 0x70, 0x61, 0x64, 0x41, 0x75, 0x74, 0x6f, 0x73, 
+	0x68, 0x6f, 0x6f, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+	0x2e, 0x74, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 
+	0x29, 0x20, 0x3a, 0x20, 0x22, 0x30, 0x22, 0x3b, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x53, 
-	0x74, 0x61, 0x74, 0x65, 0x2e, 0x6b, 0x62, 0x4c, 0x61, 0x79, 
-	0x6f, 0x75, 0x74, 0x20, 0x3d, 0x20, 0x6b, 0x62, 0x4c, 0x61, 
-	0x79, 0x6f, 0x75, 0x74, 0x20, 0x3f, 0x20, 0x6b, 0x62, 0x4c, 
-	0x61, 0x79, 0x6f, 0x75, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 
-	0x65, 0x2e, 0x74, 0x6f, 0x4c, 0x6f, 0x77, 0x65, 0x72, 0x43, 
-	0x61, 0x73, 0x65, 0x28, 0x29, 0x20, 0x3a, 0x20, 0x22, 0x75, 
-	0x73, 0x22, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x53, 0x74, 
+	0x61, 0x74, 0x65, 0x2e, 0x6b, 0x62, 0x4c, 0x61, 0x79, 0x6f, 
+	0x75, 0x74, 0x20, 0x3d, 0x20, 0x6b, 0x62, 0x4c, 0x61, 0x79, 
+	0x6f, 0x75, 0x74, 0x20, 0x3f, 0x20, 0x6b, 0x62, 0x4c, 0x61, 
+	0x79, 0x6f, 0x75, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+	0x2e, 0x74, 0x6f, 0x4c, 0x6f, 0x77, 0x65, 0x72, 0x43, 0x61, 
+	0x73, 0x65, 0x28, 0x29, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x73, 
+	0x22, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 
-	0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x22, 0x73, 0x75, 
-	0x63, 0x63, 0x65, 0x73, 0x73, 0x22, 0x2c, 0x20, 0x22, 0x42, 
-	0x6c, 0x75, 0x65, 0x74, 0x6f, 0x6f, 0x74, 0x68, 0x20, 0x73, 
-	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x73, 0x61, 
-	0x76, 0x65, 0x64, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 
-	0x73, 0x66, 0x75, 0x6c, 0x6c, 0x79, 0x2e, 0x20, 0x54, 0x68, 
-	0x65, 0x73, 0x65, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
-	0x67, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 
-	0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x65, 0x64, 0x20, 0x61, 
-	0x75, 0x74, 0x6f, 0x6d, 0x61, 0x74, 0x69, 0x63, 0x61, 0x6c, 
-	0x6c, 0x79, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x65, 
-	0x61, 0x63, 0x68, 0x20, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x2d, 
-	0x6f, 0x6e, 0x2e, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 
-	0x65, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x53, 
+	0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x22, 0x73, 0x75, 0x63, 
+	0x63, 0x65, 0x73, 0x73, 0x22, 0x2c, 0x20, 0x22, 0x42, 0x6c, 
+	0x75, 0x65, 0x74, 0x6f, 0x6f, 0x74, 0x68, 0x20, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x73, 0x61, 0x76, 
+	0x65, 0x64, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 
+	0x66, 0x75, 0x6c, 0x6c, 0x79, 0x2e, 0x20, 0x54, 0x68, 0x65, 
+	0x73, 0x65, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 
+	0x61, 0x70, 0x70, 0x6c, 0x69, 0x65, 0x64, 0x20, 0x61, 0x75, 
+	0x74, 0x6f, 0x6d, 0x61, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x6c, 
+	0x79, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x65, 0x61, 
+	0x63, 0x68, 0x20, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x2d, 0x6f, 
+	0x6e, 0x2e, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 
+	0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 
-	0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x22, 0x65, 0x72, 
-	0x72, 0x6f, 0x72, 0x22, 0x2c, 0x20, 0x64, 0x61, 0x74, 0x61, 
-	0x2e, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x7c, 
-	0x7c, 0x20, 0x22, 0x55, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 
-	0x74, 0x6f, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 0x42, 0x6c, 
-	0x75, 0x65, 0x74, 0x6f, 0x6f, 0x74, 0x68, 0x20, 0x73, 0x65, 
-	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x22, 0x29, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x53, 
+	0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x22, 0x65, 0x72, 0x72, 
+	0x6f, 0x72, 0x22, 0x2c, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2e, 
+	0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x7c, 0x7c, 
+	0x20, 0x22, 0x55, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 
+	0x6f, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 0x42, 0x6c, 0x75, 
+	0x65, 0x74, 0x6f, 0x6f, 0x74, 0x68, 0x20, 0x73, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x22, 0x29, 0x3b, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x63, 0x61, 0x74, 
-	0x63, 0x68, 0x20, 0x28, 0x65, 0x29, 0x20, 0x7b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6f, 
-	0x77, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x22, 0x65, 
-	0x72, 0x72, 0x6f, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x55, 0x6e, 
-	0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x72, 
-	0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x20, 0x66, 0x72, 
-	0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x76, 
-	0x69, 0x63, 0x65, 0x2e, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x63, 0x61, 0x74, 0x63, 
+	0x68, 0x20, 0x28, 0x65, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 
+	0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x22, 0x65, 0x72, 
+	0x72, 0x6f, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x55, 0x6e, 0x65, 
+	0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x72, 0x65, 
+	0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x20, 0x66, 0x72, 0x6f, 
+	0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x76, 0x69, 
+	0x63, 0x65, 0x2e, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x63, 0x61, 
-	0x74, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
-	0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 
+	0x20, 0x7d, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x7d, 0x29, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 
-	0x75, 0x73, 0x28, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 
-	0x2c, 0x20, 0x22, 0x4e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 
-	0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x77, 0x68, 0x69, 
-	0x6c, 0x65, 0x20, 0x73, 0x61, 0x76, 0x69, 0x6e, 0x67, 0x20, 
-	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x22, 
-	0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x63, 0x61, 0x74, 
+	0x63, 0x68, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+	0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
-	0x29, 0x3b, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 
-	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 
-	0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 
-	0x22, 0x72, 0x65, 0x73, 0x65, 0x74, 0x2d, 0x62, 0x74, 0x2d, 
-	0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x22, 0x29, 0x2e, 0x61, 
-	0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 
-	0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6c, 0x69, 
-	0x63, 0x6b, 0x22, 0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 
-	0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 
-	0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 0x69, 0x6e, 0x69, 0x74, 
-	0x69, 0x61, 0x6c, 0x53, 0x74, 0x61, 0x74, 0x65, 0x29, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6c, 0x65, 
-	0x61, 0x72, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x29, 
+	0x20, 0x73, 0x68, 0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 0x75, 
+	0x73, 0x28, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x2c, 
+	0x20, 0x22, 0x4e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 
+	0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x77, 0x68, 0x69, 0x6c, 
+	0x65, 0x20, 0x73, 0x61, 0x76, 0x69, 0x6e, 0x67, 0x20, 0x73, 
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x22, 0x29, 
 	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 0xa, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x6d, 0x6f, 0x64, 0x65, 0x43, 0x68, 0x65, 0x63, 0x6b, 
-	0x62, 0x6f, 0x78, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 
-	0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 
-	0x28, 0x22, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x22, 0x2c, 
-	0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
-	0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 
+	0x3b, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 
+	0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 
+	0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 
+	0x72, 0x65, 0x73, 0x65, 0x74, 0x2d, 0x62, 0x74, 0x2d, 0x63, 
+	0x6f, 0x6e, 0x66, 0x69, 0x67, 0x22, 0x29, 0x2e, 0x61, 0x64, 
+	0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 
+	0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6c, 0x69, 0x63, 
+	0x6b, 0x22, 0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x56, 0x69, 0x73, 
-	0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x28, 0x29, 0x3b, 
+	0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x53, 
+	0x74, 0x61, 0x74, 0x65, 0x28, 0x69, 0x6e, 0x69, 0x74, 0x69, 
+	0x61, 0x6c, 0x53, 0x74, 0x61, 0x74, 0x65, 0x29, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6c, 0x65, 0x61, 
+	0x72, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x29, 0x3b, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 0xa, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x61, 0x70, 0x70, 0x6c, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 
-	0x28, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x53, 0x74, 
-	0x61, 0x74, 0x65, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 
-	0x74, 0x63, 0x68, 0x50, 0x61, 0x69, 0x72, 0x69, 0x6e, 0x67, 
-	0x73, 0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x7d, 0x29, 0x28, 0x29, 0x3b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 
-	0x74, 0x3e, 0xa, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 
-	0xa, 0xa, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0xa, 
-};
+	0x6d, 0x6f, 0x64, 0x65, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x62, 
+	0x6f, 0x78, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 
+	0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 
+	0x22, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x22, 0x2c, 0x20, 
+	0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 
+	0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x56, 0x69, 0x73, 0x69, 
+	0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x28, 0x29, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0x29, 0x3b, 0xa, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 
+	0x70, 0x70, 0x6c, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 
+	0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x53, 0x74, 0x61, 
+	0x74, 0x65, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 
+	0x63, 0x68, 0x50, 0x61, 0x69, 0x72, 0x69, 0x6e, 0x67, 0x73, 
+	0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0x29, 0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 
+	0x3e, 0xa, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0xa, 
+	0xa, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0xa, };
 
 static const unsigned char data_index_html[] = {
 	/* /index.html */
 	0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0,
-	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x20, 0x32, 
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x31, 0x20, 0x32, 
 	0x30, 0x30, 0x20, 0x4f, 0x4b, 0xd, 0xa, 0x53, 0x65, 0x72, 
 	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
 	0x70, 0x72, 0x65, 0x2d, 0x30, 0x2e, 0x36, 0x20, 0x28, 0x68, 
@@ -1671,39 +1678,39 @@ static const unsigned char data_index_html[] = {
 	0x64, 0x61, 0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 
 	0xd, 0xa, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 
 	0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 
-	0x2f, 0x68, 0x74, 0x6d, 0x6c, 0xd, 0xa, 0xd, 0xa, 0x3c, 
-	0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 
-	0x74, 0x6d, 0x6c, 0x3e, 0xa, 0x3c, 0x68, 0x74, 0x6d, 0x6c, 
-	0x3e, 0xa, 0xa, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 
-	0x3e, 0x53, 0x69, 0x64, 0x65, 0x63, 0x61, 0x72, 0x54, 0x72, 
-	0x69, 0x64, 0x67, 0x65, 0x20, 0x43, 0x72, 0x6f, 0x69, 0x73, 
-	0x73, 0x61, 0x6e, 0x74, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 
-	0x65, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x69, 
-	0x6e, 0x6b, 0x20, 0x72, 0x65, 0x6c, 0x3d, 0x22, 0x69, 0x63, 
-	0x6f, 0x6e, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 
-	0x64, 0x61, 0x74, 0x61, 0x3a, 0x3b, 0x62, 0x61, 0x73, 0x65, 
-	0x36, 0x34, 0x2c, 0x3d, 0x22, 0x3e, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x68, 0x74, 0x74, 
-	0x70, 0x2d, 0x65, 0x71, 0x75, 0x69, 0x76, 0x3d, 0x22, 0x72, 
-	0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x22, 0x20, 0x63, 0x6f, 
-	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x30, 0x3b, 0x75, 
-	0x72, 0x6c, 0x3d, 0x2f, 0x6d, 0x6e, 0x67, 0x72, 0x5f, 0x68, 
-	0x6f, 0x6d, 0x65, 0x2e, 0x73, 0x68, 0x74, 0x6d, 0x6c, 0x22, 
-	0x3e, 0xa, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0xa, 
-	0xa, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x70, 0x3e, 0x4c, 0x6f, 0x61, 0x64, 0x69, 
-	0x6e, 0x67, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x75, 
-	0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x70, 0x70, 
-	0x2e, 0x20, 0x50, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x77, 
-	0x61, 0x69, 0x74, 0x2e, 0x2e, 0x2e, 0x3c, 0x2f, 0x70, 0x3e, 
-	0xa, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0xa, 0xa, 
-	0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0xa, };
+	0x2f, 0x68, 0x74, 0x6d, 0x6c, 0xd, 0xa, 0x43, 0x6f, 0x6e, 
+	0x74, 0x65, 0x6e, 0x74, 0x2d, 0x45, 0x6e, 0x63, 0x6f, 0x64, 
+	0x69, 0x6e, 0x67, 0x3a, 0x20, 0x67, 0x7a, 0x69, 0x70, 0xd, 
+	0xa, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x4c, 
+	0x65, 0x6e, 0x67, 0x74, 0x68, 0x3a, 0x20, 0x32, 0x31, 0x37, 
+	0xd, 0xa, 0xd, 0xa, 0x1f, 0x8b, 0x8, 00, 00, 00, 
+	00, 00, 0x2, 0x3, 0x2d, 0x8f, 0x31, 0x4f, 0x3, 0x31, 
+	0xc, 0x85, 0xf7, 0xfb, 0x15, 0x21, 0x33, 0xe4, 0x18, 0x10, 
+	0x3, 0x4d, 0x6e, 0x29, 0x6c, 0x48, 0xad, 0x44, 0x17, 0x26, 
+	0xe4, 0x36, 0xee, 0x9d, 0xd5, 0x5c, 0x92, 0x3a, 0x3e, 0x10, 
+	0xff, 0x9e, 0x1c, 0xa9, 0x97, 0x37, 0xf8, 0xbd, 0xef, 0xd9, 
+	0xf6, 0xee, 0x75, 0xb7, 0x3d, 0x7c, 0xee, 0xdf, 0xd4, 0x24, 
+	0x73, 0x18, 0x3a, 0xdb, 0xa4, 0x2a, 0x82, 0x1f, 0x3a, 0x55, 
+	0xc7, 0xa, 0x49, 0xc0, 0xe1, 0x83, 0x3c, 0x9e, 0x80, 0xf, 
+	0x4c, 0x7e, 0x44, 0xb5, 0xe5, 0x44, 0xa5, 0x40, 0x14, 0xdb, 
+	0xb7, 0x75, 0xb3, 0x6, 0x8a, 0x17, 0xc5, 0x18, 0x9c, 0xa6, 
+	0x53, 0x8a, 0x5a, 0x4d, 0x8c, 0x67, 0xa7, 0x3d, 0x8, 0xbc, 
+	0x6c, 0x8e, 0x50, 0xf0, 0xf9, 0xe9, 0xde, 0xe9, 0x9b, 0x77, 
+	0x46, 0x81, 0xda, 0x2a, 0xf9, 0x1, 0xaf, 0xb, 0x7d, 0x3b, 
+	0x5d, 0xbd, 0x8c, 0x65, 0xd2, 0xaa, 0x46, 0x5, 0xa3, 0x38, 
+	0xfd, 0xb8, 0x59, 0x38, 0xb8, 0x7e, 0x8e, 0x23, 0x7f, 0x4d, 
+	0x69, 0x46, 0x53, 0xd6, 0xf3, 0x2a, 0xc0, 0xf6, 0xed, 0xbe, 
+	0xce, 0x1e, 0x93, 0xff, 0xbd, 0x1, 0xf3, 0xf0, 0x9e, 0xc0, 
+	0x53, 0x1c, 0x57, 0xc0, 0x99, 0xc6, 0x85, 0x41, 0x28, 0x45, 
+	0x5, 0x39, 0x1b, 0xb5, 0xf, 0x58, 0xfb, 0xd5, 0xf, 0x90, 
+	0x18, 0x63, 0x6c, 0x9f, 0x57, 0x48, 0xb, 0xaf, 0xb4, 0xff, 
+	0xaf, 0xff, 00, 0x1e, 0xa7, 0x84, 0xf9, 0xd, 0x1, 00, 
+	00, };
 
 static const unsigned char data_styles_css[] = {
 	/* /styles.css */
 	0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x2e, 0x63, 0x73, 0x73, 0,
-	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x20, 0x32, 
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x31, 0x20, 0x32, 
 	0x30, 0x30, 0x20, 0x4f, 0x4b, 0xd, 0xa, 0x53, 0x65, 0x72, 
 	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
 	0x70, 0x72, 0x65, 0x2d, 0x30, 0x2e, 0x36, 0x20, 0x28, 0x68, 
@@ -1712,1596 +1719,442 @@ static const unsigned char data_styles_css[] = {
 	0x64, 0x61, 0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 
 	0xd, 0xa, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 
 	0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 
-	0x2f, 0x63, 0x73, 0x73, 0xd, 0xa, 0xd, 0xa, 0x2f, 0x2a, 
-	0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
-	0x2d, 0x20, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x52, 
-	0x65, 0x73, 0x65, 0x74, 0x20, 0x2f, 0x20, 0x42, 0x61, 0x73, 
-	0x69, 0x63, 0x20, 0x50, 0x61, 0x67, 0x65, 0x20, 0x53, 0x74, 
-	0x79, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x2d, 0x2d, 0x2d, 0x2d, 
-	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x2a, 0x2f, 0xa, 
-	0x68, 0x74, 0x6d, 0x6c, 0x2c, 0x20, 0x62, 0x6f, 0x64, 0x79, 
-	0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 
-	0x67, 0x68, 0x74, 0x3a, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 
-	0x6e, 0x3a, 0x20, 0x30, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 
-	0x3b, 0xa, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 0xa, 0x20, 
-	0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x7b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 
-	0x20, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x66, 0x6c, 0x65, 0x78, 0x2d, 0x64, 0x69, 0x72, 0x65, 
-	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x63, 0x6f, 0x6c, 
-	0x75, 0x6d, 0x6e, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 
-	0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 
-	0x20, 0x23, 0x66, 0x34, 0x66, 0x34, 0x66, 0x39, 0x3b, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 
-	0x20, 0x23, 0x33, 0x33, 0x33, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 
-	0x6c, 0x79, 0x3a, 0x20, 0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 
-	0x20, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 
-	0x66, 0x3b, 0xa, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 0xa, 
-	0x20, 0x20, 0x2f, 0x2a, 0x20, 0x4d, 0x61, 0x69, 0x6e, 0x20, 
-	0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x20, 
-	0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 
-	0x20, 0x61, 0x72, 0x65, 0x61, 0x20, 0x74, 0x68, 0x61, 0x74, 
-	0x20, 0x63, 0x61, 0x6e, 0x20, 0x67, 0x72, 0x6f, 0x77, 0x2f, 
-	0x73, 0x68, 0x72, 0x69, 0x6e, 0x6b, 0x20, 0x2a, 0x2f, 0xa, 
-	0x20, 0x20, 0x2e, 0x6d, 0x61, 0x69, 0x6e, 0x2d, 0x63, 0x6f, 
-	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x7b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x3a, 0x20, 0x31, 0x3b, 
-	0xa, 0x2f, 0x2a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 
-	0x74, 0x68, 0x3a, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3b, 0x20, 
-	0x2a, 0x2f, 0xa, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x78, 
-	0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x38, 0x30, 
-	0x30, 0x70, 0x78, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x6d, 
-	0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x20, 0x61, 
-	0x75, 0x74, 0x6f, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x70, 
-	0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x31, 0x72, 
-	0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x7d, 0xa, 0xa, 0x20, 
-	0x20, 0x2e, 0x6d, 0x61, 0x69, 0x6e, 0x2d, 0x63, 0x6f, 0x6e, 
-	0x74, 0x65, 0x6e, 0x74, 0x2d, 0x66, 0x75, 0x6c, 0x6c, 0x2d, 
-	0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x7b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x3a, 0x20, 0x31, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
-	0x3a, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x6d, 0x61, 0x78, 0x2d, 0x77, 0x69, 0x64, 0x74, 
-	0x68, 0x3a, 0x20, 0x38, 0x30, 0x30, 0x70, 0x78, 0x3b, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 
-	0x3a, 0x20, 0x30, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 
-	0x67, 0x3a, 0x20, 0x31, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 
-	0x20, 0x7d, 0xa, 0xa, 0xa, 0x20, 0x20, 0xa, 0x20, 0x20, 
-	0x2f, 0x2a, 0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
-	0x2d, 0x2d, 0x2d, 0x20, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 
-	0x20, 0x28, 0x42, 0x6c, 0x75, 0x65, 0x20, 0x42, 0x61, 0x6e, 
-	0x6e, 0x65, 0x72, 0x29, 0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
-	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x2a, 0x2f, 0xa, 0x20, 
-	0x20, 0x2e, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 
-	0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 
-	0x72, 0x3a, 0x20, 0x23, 0x30, 0x30, 0x37, 0x38, 0x65, 0x37, 
-	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 
-	0x72, 0x3a, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 
-	0x3a, 0x20, 0x31, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 
-	0x6e, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
-	0x3a, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3b, 0xa, 0x20, 0x20, 
-	0x7d, 0xa, 0x20, 0x20, 0xa, 0x20, 0x20, 0x2f, 0x2a, 0x20, 
-	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
-	0x20, 0x4e, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 
-	0x6e, 0x20, 0x42, 0x61, 0x72, 0x20, 0x2d, 0x2d, 0x2d, 0x2d, 
-	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x2a, 0x2f, 0xa, 
-	0x20, 0x20, 0x2e, 0x6e, 0x61, 0x76, 0x2d, 0x62, 0x61, 0x72, 
-	0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 
-	0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 
-	0x66, 0x66, 0x66, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 
-	0x6f, 0x78, 0x2d, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x3a, 
-	0x20, 0x30, 0x20, 0x32, 0x70, 0x78, 0x20, 0x34, 0x70, 0x78, 
-	0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2c, 0x30, 0x2c, 
-	0x30, 0x2c, 0x30, 0x2e, 0x31, 0x29, 0x3b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 
-	0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x31, 0x65, 0x6d, 
-	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 
-	0x69, 0x6e, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x20, 0x61, 
-	0x75, 0x74, 0x6f, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x6d, 
-	0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x72, 0x69, 0x67, 0x68, 
-	0x74, 0x3a, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 
-	0x31, 0x30, 0x30, 0x25, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x6d, 0x61, 0x78, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 
-	0x20, 0x38, 0x30, 0x30, 0x70, 0x78, 0x3b, 0xa, 0x20, 0x20, 
-	0x7d, 0xa, 0xa, 0x20, 0x20, 0x2e, 0x6e, 0x61, 0x76, 0x2d, 
-	0x6c, 0x69, 0x73, 0x74, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 
-	0x66, 0x6c, 0x65, 0x78, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d, 
-	0x73, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3a, 0x20, 
-	0x30, 0x2e, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x2d, 0x73, 0x74, 0x79, 
-	0x6c, 0x65, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 
-	0x3a, 0x20, 0x30, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x70, 
-	0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 0x2e, 
-	0x35, 0x72, 0x65, 0x6d, 0x20, 0x31, 0x72, 0x65, 0x6d, 0x3b, 
-	0xa, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 0xa, 0x20, 0x20, 
-	0x2e, 0x6e, 0x61, 0x76, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x20, 
-	0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 
-	0x69, 0x6e, 0x3a, 0x20, 0x30, 0x3b, 0xa, 0x20, 0x20, 0x7d, 
-	0xa, 0x20, 0x20, 0xa, 0x20, 0x20, 0x2e, 0x6e, 0x61, 0x76, 
-	0x2d, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x7b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 
-	0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 
-	0x20, 0x30, 0x2e, 0x35, 0x72, 0x65, 0x6d, 0x20, 0x30, 0x2e, 
-	0x37, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x64, 0x65, 0x63, 0x6f, 
-	0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x6e, 0x6f, 
-	0x6e, 0x65, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 
-	0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x33, 0x33, 0x33, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 
-	0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 
-	0x36, 0x70, 0x78, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x66, 
-	0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 
-	0x3a, 0x20, 0x36, 0x30, 0x30, 0x3b, 0xa, 0x20, 0x20, 0x7d, 
-	0xa, 0x20, 0x20, 0xa, 0x20, 0x20, 0x2e, 0x6e, 0x61, 0x76, 
-	0x2d, 0x6c, 0x69, 0x6e, 0x6b, 0x3a, 0x68, 0x6f, 0x76, 0x65, 
-	0x72, 0x2c, 0xa, 0x20, 0x20, 0x2e, 0x6e, 0x61, 0x76, 0x2d, 
-	0x6c, 0x69, 0x6e, 0x6b, 0x3a, 0x66, 0x6f, 0x63, 0x75, 0x73, 
-	0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 
-	0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 
-	0x65, 0x65, 0x66, 0x34, 0x66, 0x66, 0x3b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 
-	0x30, 0x30, 0x37, 0x38, 0x65, 0x37, 0x3b, 0xa, 0x20, 0x20, 
-	0x7d, 0xa, 0x20, 0x20, 0xa, 0x20, 0x20, 0x2e, 0x6e, 0x61, 
-	0x76, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x2e, 0x61, 0x63, 0x74, 
-	0x69, 0x76, 0x65, 0x20, 0x2e, 0x6e, 0x61, 0x76, 0x2d, 0x6c, 
-	0x69, 0x6e, 0x6b, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 
-	0x3a, 0x20, 0x23, 0x30, 0x30, 0x37, 0x38, 0x65, 0x37, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 
-	0x3a, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3b, 0xa, 0x20, 0x20, 
-	0x7d, 0xa, 0x20, 0x20, 0xa, 0x20, 0x20, 0x2e, 0x6e, 0x61, 
-	0x76, 0x2d, 0x62, 0x61, 0x72, 0x20, 0x2e, 0x70, 0x75, 0x72, 
-	0x65, 0x2d, 0x6d, 0x65, 0x6e, 0x75, 0x2d, 0x6c, 0x69, 0x6e, 
-	0x6b, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 
-	0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x33, 0x33, 0x33, 0x3b, 
-	0xa, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 0xa, 0x20, 0x20, 
-	0x2f, 0x2a, 0x20, 0x41, 0x63, 0x74, 0x69, 0x76, 0x65, 0x2f, 
-	0x68, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 
-	0x65, 0x73, 0x20, 0x2a, 0x2f, 0xa, 0x20, 0x20, 0x2e, 0x6e, 
-	0x61, 0x76, 0x2d, 0x62, 0x61, 0x72, 0x20, 0x2e, 0x70, 0x75, 
-	0x72, 0x65, 0x2d, 0x6d, 0x65, 0x6e, 0x75, 0x2d, 0x73, 0x65, 
-	0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x2e, 0x70, 0x75, 
-	0x72, 0x65, 0x2d, 0x6d, 0x65, 0x6e, 0x75, 0x2d, 0x6c, 0x69, 
-	0x6e, 0x6b, 0x2c, 0xa, 0x20, 0x20, 0x2e, 0x6e, 0x61, 0x76, 
-	0x2d, 0x62, 0x61, 0x72, 0x20, 0x2e, 0x70, 0x75, 0x72, 0x65, 
-	0x2d, 0x6d, 0x65, 0x6e, 0x75, 0x2d, 0x6c, 0x69, 0x6e, 0x6b, 
-	0x3a, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x7b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 
-	0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 0x30, 0x30, 0x37, 0x38, 
-	0x65, 0x37, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 
-	0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3b, 
-	0xa, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 0xa, 0x20, 0x20, 
-	0x2f, 0x2a, 0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
-	0x2d, 0x2d, 0x2d, 0x20, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 
-	0x73, 0x69, 0x76, 0x65, 0x20, 0x4d, 0x65, 0x6e, 0x75, 0x20, 
-	0x28, 0x50, 0x75, 0x72, 0x65, 0x29, 0x20, 0x2d, 0x2d, 0x2d, 
-	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x2a, 0x2f, 
-	0xa, 0x20, 0x20, 0x40, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x20, 
-	0x28, 0x6d, 0x61, 0x78, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 
-	0x3a, 0x20, 0x36, 0x30, 0x30, 0x70, 0x78, 0x29, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x6e, 0x61, 0x76, 0x2d, 
-	0x6c, 0x69, 0x73, 0x74, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x2d, 0x64, 0x69, 
-	0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x63, 
-	0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 
-	0x74, 0x65, 0x6d, 0x73, 0x3a, 0x20, 0x66, 0x6c, 0x65, 0x78, 
-	0x2d, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x6e, 
-	0x61, 0x76, 0x2d, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x7b, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 
-	0x68, 0x3a, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 0x7d, 0xa, 0x20, 
-	0x20, 0xa, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x2d, 0x2d, 0x2d, 
-	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x4d, 0x61, 
-	0x69, 0x6e, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 
-	0x20, 0x43, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 
-	0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
-	0x2d, 0x20, 0x2a, 0x2f, 0xa, 0x20, 0x20, 0x2e, 0x63, 0x6f, 
-	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x7b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x6c, 
-	0x65, 0x66, 0x74, 0x3a, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 
-	0x6e, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x61, 
-	0x75, 0x74, 0x6f, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x77, 
-	0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x39, 0x30, 0x25, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x78, 0x2d, 0x77, 
-	0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x38, 0x30, 0x30, 0x70, 
-	0x78, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 
-	0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 
-	0x66, 0x66, 0x66, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 
-	0x6f, 0x78, 0x2d, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x3a, 
-	0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 
-	0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2c, 0x30, 0x2c, 0x30, 
-	0x2c, 0x30, 0x2e, 0x31, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 
-	0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x38, 0x70, 0x78, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 
-	0x6e, 0x67, 0x3a, 0x20, 0x31, 0x65, 0x6d, 0x3b, 0xa, 0x20, 
-	0x20, 0x7d, 0xa, 0x20, 0x20, 0xa, 0x20, 0x20, 0x2f, 0x2a, 
-	0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
-	0x2d, 0x20, 0x46, 0x6f, 0x6f, 0x74, 0x65, 0x72, 0x20, 0x2d, 
-	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 
-	0x2a, 0x2f, 0xa, 0x20, 0x20, 0x2e, 0x66, 0x6f, 0x6f, 0x74, 
-	0x65, 0x72, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x74, 
-	0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 
-	0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 
-	0x7a, 0x65, 0x3a, 0x20, 0x31, 0x34, 0x70, 0x78, 0x3b, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 
-	0x20, 0x23, 0x37, 0x37, 0x37, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 
-	0x31, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x6d, 
-	0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 
-	0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0x20, 0x2f, 0x2a, 0x20, 
-	0x70, 0x75, 0x73, 0x68, 0x20, 0x66, 0x6f, 0x6f, 0x74, 0x65, 
-	0x72, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x20, 0x69, 0x66, 0x20, 
-	0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x69, 0x73, 
-	0x20, 0x73, 0x68, 0x6f, 0x72, 0x74, 0x20, 0x2a, 0x2f, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 
-	0x20, 0x31, 0x30, 0x30, 0x25, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x6d, 0x61, 0x78, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 
-	0x3a, 0x20, 0x38, 0x30, 0x30, 0x70, 0x78, 0x3b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 
-	0x6c, 0x65, 0x66, 0x74, 0x3a, 0x20, 0x61, 0x75, 0x74, 0x6f, 
-	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 
-	0x69, 0x6e, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 
-	0x61, 0x75, 0x74, 0x6f, 0x3b, 0xa, 0x20, 0x20, 0x7d, 0xa, 
-	0x20, 0x20, 0xa, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x2d, 0x2d, 
-	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x53, 
-	0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x53, 0x65, 0x63, 0x74, 
-	0x69, 0x6f, 0x6e, 0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
-	0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x2a, 0x2f, 0xa, 0x20, 0x20, 
-	0x2e, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2d, 0x73, 0x65, 
-	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x7b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x6c, 
-	0x65, 0x66, 0x74, 0x3a, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 
-	0x6e, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x61, 
-	0x75, 0x74, 0x6f, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x77, 
-	0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x39, 0x30, 0x25, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x78, 0x2d, 0x77, 
-	0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x38, 0x30, 0x30, 0x70, 
-	0x78, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 
-	0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 
-	0x66, 0x66, 0x66, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 
-	0x6f, 0x78, 0x2d, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x3a, 
-	0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 
-	0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2c, 0x30, 0x2c, 0x30, 
-	0x2c, 0x30, 0x2e, 0x31, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 
-	0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x38, 0x70, 0x78, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 
-	0x6e, 0x67, 0x3a, 0x20, 0x31, 0x72, 0x65, 0x6d, 0x3b, 0xa, 
-	0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 0xa, 0x20, 0x20, 0x2e, 
-	0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2d, 0x73, 0x65, 0x63, 
-	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x68, 0x32, 0x20, 0x7b, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 
-	0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x30, 0x3b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 
-	0x69, 0x67, 0x6e, 0x3a, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 
-	0x3a, 0x20, 0x23, 0x30, 0x30, 0x37, 0x38, 0x65, 0x37, 0x3b, 
-	0xa, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 0xa, 0x20, 0x20, 
-	0x2f, 0x2a, 0x20, 0x52, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 
-	0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x6c, 0x69, 
-	0x73, 0x74, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x69, 0x6e, 0x67, 
-	0x20, 0x2a, 0x2f, 0xa, 0x20, 0x20, 0x2e, 0x73, 0x79, 0x73, 
-	0x74, 0x65, 0x6d, 0x2d, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x2d, 
-	0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x74, 0x79, 0x70, 0x65, 
-	0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x2d, 
-	0x6c, 0x65, 0x66, 0x74, 0x3a, 0x20, 0x30, 0x3b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 
-	0x20, 0x30, 0x3b, 0xa, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 
-	0xa, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x2e, 0x73, 0x79, 0x73, 
-	0x74, 0x65, 0x6d, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x3a, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x2d, 0x20, 0x54, 0x61, 0x6b, 0x65, 
-	0x73, 0x20, 0x66, 0x75, 0x6c, 0x6c, 0x20, 0x77, 0x69, 0x64, 
-	0x74, 0x68, 0x20, 0x6f, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 
-	0x6c, 0x65, 0x72, 0x20, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 
-	0x73, 0xa, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x20, 0x54, 0x61, 
-	0x6b, 0x65, 0x73, 0x20, 0x68, 0x61, 0x6c, 0x66, 0x20, 0x77, 
-	0x69, 0x64, 0x74, 0x68, 0x20, 0x6f, 0x6e, 0x20, 0x60, 0x73, 
-	0x6d, 0x60, 0x20, 0x6f, 0x72, 0x20, 0x60, 0x6d, 0x64, 0x60, 
-	0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 
-	0x74, 0x73, 0x20, 0x28, 0x77, 0x68, 0x69, 0x63, 0x68, 0x65, 
-	0x76, 0x65, 0x72, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x75, 0x73, 
-	0x65, 0x20, 0x69, 0x6e, 0x20, 0x48, 0x54, 0x4d, 0x4c, 0x29, 
-	0xa, 0x20, 0x20, 0x2a, 0x2f, 0xa, 0x20, 0x20, 0x2e, 0x73, 
-	0x79, 0x73, 0x74, 0x65, 0x6d, 0x2d, 0x69, 0x74, 0x65, 0x6d, 
-	0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 
-	0x64, 0x69, 0x6e, 0x67, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 
-	0x30, 0x2e, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x2d, 
-	0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x30, 0x2e, 
-	0x35, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f, 0x74, 
-	0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 
-	0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x64, 0x64, 0x64, 0x3b, 
-	0x20, 0x2f, 0x2a, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
-	0x61, 0x6c, 0x20, 0x64, 0x69, 0x76, 0x69, 0x64, 0x65, 0x72, 
-	0x20, 0x2a, 0x2f, 0xa, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 
-	0xa, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x4c, 0x61, 0x79, 0x6f, 
-	0x75, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x20, 0x26, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x20, 0x65, 0x61, 
-	0x63, 0x68, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x20, 0x2a, 0x2f, 
-	0xa, 0x20, 0x20, 0x2e, 0x69, 0x74, 0x65, 0x6d, 0x2d, 0x69, 
-	0x6e, 0x6e, 0x65, 0x72, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 
-	0x67, 0x72, 0x69, 0x64, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x67, 0x72, 0x69, 0x64, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 
-	0x61, 0x74, 0x65, 0x2d, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 
-	0x73, 0x3a, 0x20, 0x31, 0x38, 0x30, 0x70, 0x78, 0x20, 0x31, 
-	0x66, 0x72, 0x3b, 0x20, 0x2f, 0x2a, 0x20, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x20, 0x7e, 0x20, 0x31, 0x38, 0x30, 0x70, 0x78, 
-	0x2c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x66, 0x69, 
-	0x6c, 0x6c, 0x73, 0x20, 0x72, 0x65, 0x73, 0x74, 0x20, 0x2a, 
-	0x2f, 0xa, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6c, 0x69, 0x67, 
-	0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a, 0x20, 0x63, 
-	0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x67, 0x61, 0x70, 0x3a, 0x20, 0x30, 0x2e, 0x35, 0x72, 
-	0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 
-	0xa, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x49, 0x63, 0x6f, 0x6e, 
-	0x20, 0x2b, 0x20, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x43, 
-	0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x20, 0x2a, 
-	0x2f, 0xa, 0x20, 0x20, 0x2e, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
-	0x2d, 0x63, 0x65, 0x6c, 0x6c, 0x20, 0x7b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 
-	0x20, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74, 0x65, 
-	0x6d, 0x73, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 
-	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3a, 
-	0x20, 0x30, 0x2e, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 
-	0x20, 0x7d, 0xa, 0x20, 0x20, 0x2e, 0x6c, 0x61, 0x62, 0x65, 
-	0x6c, 0x2d, 0x63, 0x65, 0x6c, 0x6c, 0x20, 0x69, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 
-	0x3a, 0x20, 0x23, 0x30, 0x30, 0x37, 0x38, 0x65, 0x37, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 
-	0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 0x2e, 0x32, 0x72, 
-	0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 
-	0xa, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x56, 0x61, 0x6c, 0x75, 
-	0x65, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x6d, 0x6f, 0x6e, 
-	0x6f, 0x73, 0x70, 0x61, 0x63, 0x65, 0x64, 0x2c, 0x20, 0x62, 
-	0x6f, 0x6c, 0x64, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x2a, 
-	0x2f, 0xa, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x63, 
-	0x65, 0x6c, 0x6c, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
-	0x3a, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x3b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 
-	0x69, 0x6c, 0x79, 0x3a, 0x20, 0x22, 0x43, 0x6f, 0x75, 0x72, 
-	0x69, 0x65, 0x72, 0x20, 0x4e, 0x65, 0x77, 0x22, 0x2c, 0x20, 
-	0x43, 0x6f, 0x75, 0x72, 0x69, 0x65, 0x72, 0x2c, 0x20, 0x6d, 
-	0x6f, 0x6e, 0x6f, 0x73, 0x70, 0x61, 0x63, 0x65, 0x3b, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 
-	0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x62, 0x6f, 0x6c, 
-	0x64, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x74, 0x65, 0x78, 
-	0x74, 0x2d, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x7b, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 
-	0x20, 0x72, 0x65, 0x64, 0x20, 0x2f, 0x2a, 0x20, 0x45, 0x78, 
-	0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6f, 
-	0x72, 0x20, 0x72, 0x65, 0x64, 0x20, 0x2a, 0x2f, 0xa, 0x7d, 
-	0xa, 0xa, 0x2f, 0x2a, 0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
-	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x42, 0x75, 0x74, 0x74, 
-	0x6f, 0x6e, 0x73, 0x20, 0x28, 0x73, 0x68, 0x61, 0x72, 0x65, 
-	0x64, 0x29, 0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
-	0x2d, 0x2d, 0x2d, 0x20, 0x2a, 0x2f, 0xa, 0x2e, 0x62, 0x74, 
-	0x6e, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 
-	0x72, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 
-	0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x30, 0x30, 0x37, 
-	0x38, 0x65, 0x37, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 
-	0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 
-	0x20, 0x23, 0x30, 0x30, 0x37, 0x38, 0x65, 0x37, 0x3b, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 
-	0x20, 0x23, 0x66, 0x66, 0x66, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 
-	0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x36, 0x70, 0x78, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 
-	0x6e, 0x67, 0x3a, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x72, 0x65, 
-	0x6d, 0x20, 0x31, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x20, 
-	0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 
-	0x7a, 0x65, 0x3a, 0x20, 0x31, 0x72, 0x65, 0x6d, 0x3b, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 
-	0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x37, 0x30, 0x30, 
-	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 
-	0x2d, 0x64, 0x65, 0x63, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f, 
-	0x6e, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 
-	0x3a, 0x20, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x66, 
-	0x6c, 0x65, 0x78, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x61, 
-	0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 
-	0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x6a, 0x75, 0x73, 0x74, 0x69, 0x66, 
-	0x79, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 
-	0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3a, 0x20, 0x30, 0x2e, 
-	0x33, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x69, 0x74, 0x69, 0x6f, 
-	0x6e, 0x3a, 0x20, 0x6f, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 
-	0x20, 0x30, 0x2e, 0x31, 0x35, 0x73, 0x20, 0x65, 0x61, 0x73, 
-	0x65, 0x2c, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 
-	0x72, 0x6d, 0x20, 0x30, 0x2e, 0x31, 0x35, 0x73, 0x20, 0x65, 
-	0x61, 0x73, 0x65, 0x2c, 0x20, 0x62, 0x6f, 0x78, 0x2d, 0x73, 
-	0x68, 0x61, 0x64, 0x6f, 0x77, 0x20, 0x30, 0x2e, 0x31, 0x35, 
-	0x73, 0x20, 0x65, 0x61, 0x73, 0x65, 0x3b, 0xa, 0x7d, 0xa, 
-	0xa, 0x2e, 0x62, 0x74, 0x6e, 0x3a, 0x68, 0x6f, 0x76, 0x65, 
-	0x72, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x70, 
-	0x61, 0x63, 0x69, 0x74, 0x79, 0x3a, 0x20, 0x30, 0x2e, 0x39, 
-	0x34, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x62, 0x74, 0x6e, 
-	0x3a, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x7b, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 
-	0x6f, 0x72, 0x6d, 0x3a, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 
-	0x6c, 0x61, 0x74, 0x65, 0x59, 0x28, 0x31, 0x70, 0x78, 0x29, 
-	0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x62, 0x74, 0x6e, 0x3a, 
-	0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x70, 0x61, 0x63, 0x69, 
-	0x74, 0x79, 0x3a, 0x20, 0x30, 0x2e, 0x36, 0x3b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 
-	0x20, 0x6e, 0x6f, 0x74, 0x2d, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 
-	0x65, 0x64, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x62, 0x74, 
-	0x6e, 0x2d, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x61, 0x72, 
-	0x79, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 
-	0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 
-	0x23, 0x66, 0x66, 0x66, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30, 0x30, 
-	0x37, 0x38, 0x65, 0x37, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 
-	0x62, 0x74, 0x6e, 0x2d, 0x64, 0x61, 0x6e, 0x67, 0x65, 0x72, 
-	0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 
-	0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 
-	0x65, 0x66, 0x34, 0x34, 0x34, 0x34, 0x3b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x63, 
-	0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x65, 0x66, 0x34, 
-	0x34, 0x34, 0x34, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x63, 
-	0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x66, 0x66, 0x66, 
-	0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2f, 0x2a, 0x20, 0x2d, 0x2d, 
-	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x42, 
-	0x54, 0x20, 0x50, 0x61, 0x69, 0x72, 0x69, 0x6e, 0x67, 0x20, 
-	0x70, 0x61, 0x67, 0x65, 0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
-	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x2a, 0x2f, 0xa, 0x2e, 
-	0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x6c, 0x69, 0x73, 
-	0x74, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 
-	0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x3b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 
-	0x3a, 0x20, 0x30, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x6c, 
-	0x69, 0x73, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 
-	0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 
-	0x66, 0x6c, 0x65, 0x78, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x66, 0x6c, 0x65, 0x78, 0x2d, 0x64, 0x69, 0x72, 0x65, 0x63, 
-	0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x63, 0x6f, 0x6c, 0x75, 
-	0x6d, 0x6e, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x67, 0x61, 
-	0x70, 0x3a, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x72, 0x65, 0x6d, 
-	0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x64, 0x65, 0x76, 0x69, 
-	0x63, 0x65, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x20, 0x7b, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 
-	0x67, 0x3a, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x72, 0x65, 0x6d, 
-	0x20, 0x31, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x31, 
-	0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 
-	0x65, 0x35, 0x65, 0x37, 0x65, 0x62, 0x3b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 
-	0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x38, 0x70, 0x78, 
-	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 
-	0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 0x66, 
-	0x66, 0x66, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 
-	0x78, 0x2d, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x3a, 0x20, 
-	0x30, 0x20, 0x32, 0x70, 0x78, 0x20, 0x36, 0x70, 0x78, 0x20, 
-	0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2c, 0x20, 0x30, 0x2c, 
-	0x20, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x36, 0x29, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 
-	0x61, 0x79, 0x3a, 0x20, 0x67, 0x72, 0x69, 0x64, 0x3b, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x67, 0x72, 0x69, 0x64, 0x2d, 0x74, 
-	0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x2d, 0x63, 0x6f, 
-	0x6c, 0x75, 0x6d, 0x6e, 0x73, 0x3a, 0x20, 0x31, 0x66, 0x72, 
-	0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x67, 0x61, 0x70, 0x3a, 0x20, 0x30, 0x2e, 0x35, 0x72, 
-	0x65, 0x6d, 0x20, 0x31, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 
-	0x74, 0x65, 0x6d, 0x73, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 
-	0x65, 0x72, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x64, 0x65, 
-	0x76, 0x69, 0x63, 0x65, 0x2d, 0x6d, 0x65, 0x74, 0x61, 0x20, 
-	0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 
-	0x6c, 0x61, 0x79, 0x3a, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x2d, 
-	0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 
-	0x20, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x3b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3a, 0x20, 0x30, 0x2e, 
-	0x32, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 
-	0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x6e, 0x61, 0x6d, 
-	0x65, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 
-	0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 
-	0x20, 0x37, 0x30, 0x30, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x31, 0x31, 
-	0x31, 0x38, 0x32, 0x37, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 
-	0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x61, 0x64, 0x64, 
-	0x72, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 
-	0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 
-	0x20, 0x22, 0x43, 0x6f, 0x75, 0x72, 0x69, 0x65, 0x72, 0x20, 
-	0x4e, 0x65, 0x77, 0x22, 0x2c, 0x20, 0x43, 0x6f, 0x75, 0x72, 
-	0x69, 0x65, 0x72, 0x2c, 0x20, 0x6d, 0x6f, 0x6e, 0x6f, 0x73, 
-	0x70, 0x61, 0x63, 0x65, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x33, 0x37, 
-	0x34, 0x31, 0x35, 0x31, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 
-	0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x74, 0x79, 0x70, 
-	0x65, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 
-	0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 0x2e, 0x32, 
-	0x72, 0x65, 0x6d, 0x20, 0x30, 0x2e, 0x35, 0x72, 0x65, 0x6d, 
-	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 
-	0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 
-	0x20, 0x36, 0x70, 0x78, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 
-	0x3a, 0x20, 0x23, 0x65, 0x65, 0x66, 0x32, 0x66, 0x66, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 
-	0x3a, 0x20, 0x23, 0x34, 0x33, 0x33, 0x38, 0x63, 0x61, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 
-	0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x36, 0x30, 
-	0x30, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 
-	0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x30, 0x2e, 
-	0x39, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x6a, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2d, 0x73, 
-	0x65, 0x6c, 0x66, 0x3a, 0x20, 0x65, 0x6e, 0x64, 0x3b, 0xa, 
-	0x7d, 0xa, 0xa, 0x2e, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 
-	0x2d, 0x74, 0x79, 0x70, 0x65, 0x2e, 0x74, 0x79, 0x70, 0x65, 
-	0x2d, 0x6b, 0x62, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 
-	0x3a, 0x20, 0x23, 0x64, 0x62, 0x65, 0x61, 0x66, 0x65, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 
-	0x3a, 0x20, 0x23, 0x31, 0x64, 0x34, 0x65, 0x64, 0x38, 0x3b, 
-	0xa, 0x7d, 0xa, 0xa, 0x2e, 0x64, 0x65, 0x76, 0x69, 0x63, 
-	0x65, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x2e, 0x74, 0x79, 0x70, 
-	0x65, 0x2d, 0x6d, 0x73, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 
-	0x64, 0x3a, 0x20, 0x23, 0x64, 0x31, 0x66, 0x61, 0x65, 0x35, 
-	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 
-	0x72, 0x3a, 0x20, 0x23, 0x30, 0x34, 0x37, 0x38, 0x35, 0x37, 
-	0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x64, 0x65, 0x76, 0x69, 
-	0x63, 0x65, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x2e, 0x74, 0x79, 
-	0x70, 0x65, 0x2d, 0x67, 0x70, 0x20, 0x7b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 
-	0x6e, 0x64, 0x3a, 0x20, 0x23, 0x66, 0x66, 0x65, 0x64, 0x64, 
-	0x35, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 
-	0x6f, 0x72, 0x3a, 0x20, 0x23, 0x63, 0x32, 0x34, 0x31, 0x30, 
-	0x63, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x61, 0x63, 0x74, 
-	0x69, 0x6f, 0x6e, 0x2d, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 
-	0x73, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 
-	0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x66, 0x6c, 0x65, 
-	0x78, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x65, 
-	0x78, 0x2d, 0x77, 0x72, 0x61, 0x70, 0x3a, 0x20, 0x77, 0x72, 
-	0x61, 0x70, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x67, 0x61, 
-	0x70, 0x3a, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x72, 0x65, 0x6d, 
-	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 
-	0x69, 0x6e, 0x3a, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x72, 0x65, 
-	0x6d, 0x20, 0x30, 0x20, 0x31, 0x72, 0x65, 0x6d, 0x3b, 0xa, 
-	0x7d, 0xa, 0xa, 0x2e, 0x70, 0x61, 0x69, 0x72, 0x69, 0x6e, 
-	0x67, 0x2d, 0x73, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x20, 
-	0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 
-	0x69, 0x6e, 0x3a, 0x20, 0x30, 0x2e, 0x35, 0x72, 0x65, 0x6d, 
-	0x20, 0x30, 0x20, 0x31, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 
-	0x3a, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x72, 0x65, 0x6d, 0x20, 
-	0x30, 0x2e, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x74, 
-	0x6f, 0x70, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 
-	0x6c, 0x69, 0x64, 0x20, 0x23, 0x65, 0x35, 0x65, 0x37, 0x65, 
-	0x62, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 
-	0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 
-	0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 
-	0x64, 0x20, 0x23, 0x65, 0x35, 0x65, 0x37, 0x65, 0x62, 0x3b, 
-	0xa, 0x7d, 0xa, 0xa, 0x2e, 0x70, 0x61, 0x69, 0x72, 0x69, 
-	0x6e, 0x67, 0x2d, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 
-	0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x38, 0x30, 
-	0x30, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 
-	0x6f, 0x72, 0x3a, 0x20, 0x23, 0x31, 0x31, 0x31, 0x38, 0x32, 
-	0x37, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 
-	0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 
-	0x3a, 0x20, 0x30, 0x2e, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 
-	0x2d, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x3a, 0x20, 
-	0x30, 0x2e, 0x30, 0x31, 0x65, 0x6d, 0x3b, 0xa, 0x7d, 0xa, 
-	0xa, 0x2e, 0x70, 0x61, 0x69, 0x72, 0x69, 0x6e, 0x67, 0x2d, 
-	0x6c, 0x69, 0x73, 0x74, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 
-	0x66, 0x6c, 0x65, 0x78, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x66, 0x6c, 0x65, 0x78, 0x2d, 0x64, 0x69, 0x72, 0x65, 0x63, 
-	0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x63, 0x6f, 0x6c, 0x75, 
-	0x6d, 0x6e, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x67, 0x61, 
-	0x70, 0x3a, 0x20, 0x30, 0x2e, 0x33, 0x35, 0x72, 0x65, 0x6d, 
-	0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x70, 0x61, 0x69, 0x72, 
-	0x2d, 0x72, 0x6f, 0x77, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 
-	0x66, 0x6c, 0x65, 0x78, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d, 
-	0x73, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3a, 0x20, 
-	0x30, 0x2e, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x7d, 0xa, 
-	0xa, 0x2e, 0x70, 0x61, 0x69, 0x72, 0x2d, 0x69, 0x63, 0x6f, 
-	0x6e, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 
-	0x64, 0x74, 0x68, 0x3a, 0x20, 0x32, 0x36, 0x70, 0x78, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
-	0x74, 0x3a, 0x20, 0x32, 0x36, 0x70, 0x78, 0x3b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 
-	0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x35, 0x30, 
-	0x25, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 
-	0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x67, 0x72, 0x69, 0x64, 
-	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6c, 0x61, 0x63, 
-	0x65, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a, 0x20, 0x63, 
-	0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 
-	0x68, 0x74, 0x3a, 0x20, 0x38, 0x30, 0x30, 0x3b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 
-	0x23, 0x66, 0x66, 0x66, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 
-	0x20, 0x30, 0x2e, 0x38, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0xa, 
-	0x7d, 0xa, 0xa, 0x2e, 0x70, 0x61, 0x69, 0x72, 0x2d, 0x69, 
-	0x63, 0x6f, 0x6e, 0x2e, 0x6b, 0x62, 0x20, 0x7b, 0x20, 0x62, 
-	0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 
-	0x20, 0x23, 0x32, 0x35, 0x36, 0x33, 0x65, 0x62, 0x3b, 0x20, 
-	0x7d, 0xa, 0x2e, 0x70, 0x61, 0x69, 0x72, 0x2d, 0x69, 0x63, 
-	0x6f, 0x6e, 0x2e, 0x6d, 0x73, 0x20, 0x7b, 0x20, 0x62, 0x61, 
-	0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 
-	0x23, 0x31, 0x30, 0x62, 0x39, 0x38, 0x31, 0x3b, 0x20, 0x7d, 
-	0xa, 0x2e, 0x70, 0x61, 0x69, 0x72, 0x2d, 0x69, 0x63, 0x6f, 
-	0x6e, 0x2e, 0x67, 0x70, 0x20, 0x7b, 0x20, 0x62, 0x61, 0x63, 
-	0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 
-	0x66, 0x39, 0x37, 0x33, 0x31, 0x36, 0x3b, 0x20, 0x7d, 0xa, 
-	0xa, 0x2e, 0x70, 0x61, 0x69, 0x72, 0x2d, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x66, 
-	0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 
-	0x3a, 0x20, 0x37, 0x30, 0x30, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x31, 
-	0x31, 0x31, 0x38, 0x32, 0x37, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x6d, 0x69, 0x6e, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 
-	0x3a, 0x20, 0x31, 0x31, 0x30, 0x70, 0x78, 0x3b, 0xa, 0x7d, 
-	0xa, 0xa, 0x2e, 0x70, 0x61, 0x69, 0x72, 0x2d, 0x76, 0x61, 
-	0x6c, 0x75, 0x65, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x31, 0x31, 
-	0x31, 0x38, 0x32, 0x37, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 
-	0x70, 0x61, 0x69, 0x72, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x2e, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x20, 0x7b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 
-	0x23, 0x36, 0x62, 0x37, 0x32, 0x38, 0x30, 0x3b, 0xa, 0x7d, 
-	0xa, 0xa, 0x40, 0x6b, 0x65, 0x79, 0x66, 0x72, 0x61, 0x6d, 
-	0x65, 0x73, 0x20, 0x70, 0x75, 0x6c, 0x73, 0x65, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x30, 0x25, 0x20, 0x7b, 0x20, 
-	0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x3a, 
-	0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x6c, 0x61, 0x74, 0x65, 
-	0x59, 0x28, 0x30, 0x29, 0x3b, 0x20, 0x6f, 0x70, 0x61, 0x63, 
-	0x69, 0x74, 0x79, 0x3a, 0x20, 0x30, 0x2e, 0x33, 0x3b, 0x20, 
-	0x7d, 0xa, 0x20, 0x20, 0x20, 0x20, 0x35, 0x30, 0x25, 0x20, 
-	0x7b, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 
-	0x6d, 0x3a, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x6c, 0x61, 
-	0x74, 0x65, 0x59, 0x28, 0x2d, 0x35, 0x70, 0x78, 0x29, 0x3b, 
-	0x20, 0x6f, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3a, 0x20, 
-	0x31, 0x3b, 0x20, 0x7d, 0xa, 0x20, 0x20, 0x20, 0x20, 0x31, 
-	0x30, 0x30, 0x25, 0x20, 0x7b, 0x20, 0x74, 0x72, 0x61, 0x6e, 
-	0x73, 0x66, 0x6f, 0x72, 0x6d, 0x3a, 0x20, 0x74, 0x72, 0x61, 
-	0x6e, 0x73, 0x6c, 0x61, 0x74, 0x65, 0x59, 0x28, 0x30, 0x29, 
-	0x3b, 0x20, 0x6f, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3a, 
-	0x20, 0x30, 0x2e, 0x33, 0x3b, 0x20, 0x7d, 0xa, 0x7d, 0xa, 
-	0xa, 0x2e, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x2d, 
-	0x73, 0x74, 0x72, 0x69, 0x70, 0x20, 0x7b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 
-	0x20, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x66, 0x6c, 
-	0x65, 0x78, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6c, 
-	0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a, 
-	0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3a, 0x20, 0x30, 0x2e, 
-	0x33, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 
-	0x68, 0x74, 0x3a, 0x20, 0x37, 0x30, 0x30, 0x3b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 
-	0x23, 0x33, 0x37, 0x34, 0x31, 0x35, 0x31, 0x3b, 0xa, 0x7d, 
-	0xa, 0xa, 0x2e, 0x70, 0x75, 0x6c, 0x73, 0x65, 0x2d, 0x64, 
-	0x6f, 0x74, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x77, 
-	0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x30, 0x70, 0x78, 
-	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 
-	0x68, 0x74, 0x3a, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3b, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 
-	0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x35, 
-	0x30, 0x25, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 
-	0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 
-	0x23, 0x33, 0x62, 0x38, 0x32, 0x66, 0x36, 0x3b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x6f, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 
-	0x3a, 0x20, 0x30, 0x2e, 0x33, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x61, 0x6e, 0x69, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 
-	0x3a, 0x20, 0x70, 0x75, 0x6c, 0x73, 0x65, 0x20, 0x31, 0x2e, 
-	0x32, 0x73, 0x20, 0x69, 0x6e, 0x66, 0x69, 0x6e, 0x69, 0x74, 
-	0x65, 0x20, 0x65, 0x61, 0x73, 0x65, 0x2d, 0x69, 0x6e, 0x2d, 
-	0x6f, 0x75, 0x74, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x70, 
-	0x75, 0x6c, 0x73, 0x65, 0x2d, 0x64, 0x6f, 0x74, 0x3a, 0x6e, 
-	0x74, 0x68, 0x2d, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x32, 
-	0x29, 0x20, 0x7b, 0x20, 0x61, 0x6e, 0x69, 0x6d, 0x61, 0x74, 
-	0x69, 0x6f, 0x6e, 0x2d, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x3a, 
-	0x20, 0x30, 0x2e, 0x32, 0x73, 0x3b, 0x20, 0x7d, 0xa, 0x2e, 
-	0x70, 0x75, 0x6c, 0x73, 0x65, 0x2d, 0x64, 0x6f, 0x74, 0x3a, 
-	0x6e, 0x74, 0x68, 0x2d, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x28, 
-	0x33, 0x29, 0x20, 0x7b, 0x20, 0x61, 0x6e, 0x69, 0x6d, 0x61, 
-	0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x64, 0x65, 0x6c, 0x61, 0x79, 
-	0x3a, 0x20, 0x30, 0x2e, 0x34, 0x73, 0x3b, 0x20, 0x7d, 0xa, 
-	0xa, 0x40, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x20, 0x28, 0x6d, 
-	0x61, 0x78, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 
-	0x36, 0x34, 0x30, 0x70, 0x78, 0x29, 0x20, 0x7b, 0xa, 0x20, 
-	0x20, 0x20, 0x20, 0x2e, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 
-	0x2d, 0x63, 0x61, 0x72, 0x64, 0x20, 0x7b, 0x20, 0x67, 0x72, 
-	0x69, 0x64, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 
-	0x65, 0x2d, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x73, 0x3a, 
-	0x20, 0x31, 0x66, 0x72, 0x3b, 0x20, 0x7d, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x2e, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 
-	0x74, 0x79, 0x70, 0x65, 0x20, 0x7b, 0x20, 0x6a, 0x75, 0x73, 
-	0x74, 0x69, 0x66, 0x79, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 
-	0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3b, 0x20, 0x7d, 0xa, 
-	0x7d, 0xa, 0xa, 0xa, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x2d, 
-	0x77, 0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x7b, 0xa, 
-	0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 
-	0x20, 0x23, 0x66, 0x66, 0x39, 0x38, 0x30, 0x30, 0x3b, 0x20, 
-	0x2f, 0x2a, 0x20, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 
-	0x20, 0x77, 0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x6f, 
-	0x72, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x2a, 0x2f, 0xa, 0x7d, 
-	0xa, 0xa, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x73, 0x75, 
-	0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x7b, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 
-	0x34, 0x63, 0x61, 0x66, 0x35, 0x30, 0x3b, 0x20, 0x2f, 0x2a, 
-	0x20, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x73, 
-	0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x67, 0x72, 0x65, 
-	0x65, 0x6e, 0x20, 0x2a, 0x2f, 0xa, 0x7d, 0xa, 0xa, 0x2e, 
-	0x74, 0x65, 0x78, 0x74, 0x2d, 0x69, 0x6e, 0x66, 0x6f, 0x20, 
-	0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 
-	0x72, 0x3a, 0x20, 0x23, 0x32, 0x31, 0x39, 0x36, 0x66, 0x33, 
-	0x3b, 0x20, 0x2f, 0x2a, 0x20, 0x45, 0x78, 0x61, 0x6d, 0x70, 
-	0x6c, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x20, 0x62, 0x6c, 
-	0x75, 0x65, 0x20, 0x2a, 0x2f, 0xa, 0x7d, 0xa, 0xa, 0x2f, 
-	0x2a, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 
-	0x42, 0x61, 0x6e, 0x6e, 0x65, 0x72, 0x20, 0x53, 0x74, 0x79, 
-	0x6c, 0x69, 0x6e, 0x67, 0x20, 0x2a, 0x2f, 0xa, 0x2e, 0x62, 
-	0x61, 0x6e, 0x6e, 0x65, 0x72, 0x20, 0x7b, 0xa, 0x20, 0x20, 
-	0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x31, 
-	0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x62, 0x6f, 0x72, 
-	0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 
-	0x3a, 0x20, 0x34, 0x70, 0x78, 0x3b, 0xa, 0x20, 0x20, 0x70, 
-	0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x72, 
-	0x65, 0x6c, 0x61, 0x74, 0x69, 0x76, 0x65, 0x3b, 0xa, 0x20, 
-	0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 
-	0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x31, 0x72, 0x65, 0x6d, 
-	0x3b, 0xa, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 
-	0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 
-	0x64, 0x3b, 0xa, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 
-	0x61, 0x79, 0x3a, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0xa, 
-	0x20, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74, 
-	0x65, 0x6d, 0x73, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 
-	0x72, 0x3b, 0xa, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3a, 0x20, 
-	0x30, 0x2e, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0x20, 0x2f, 0x2a, 
-	0x20, 0x53, 0x70, 0x61, 0x63, 0x65, 0x20, 0x62, 0x65, 0x74, 
-	0x77, 0x65, 0x65, 0x6e, 0x20, 0x69, 0x63, 0x6f, 0x6e, 0x20, 
-	0x61, 0x6e, 0x64, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x2a, 
-	0x2f, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x62, 0x61, 0x6e, 0x6e, 
-	0x65, 0x72, 0x2d, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 
-	0x6e, 0x3a, 0x20, 0x61, 0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74, 
-	0x65, 0x3b, 0xa, 0x20, 0x20, 0x74, 0x6f, 0x70, 0x3a, 0x20, 
-	0x31, 0x30, 0x70, 0x78, 0x3b, 0xa, 0x20, 0x20, 0x72, 0x69, 
-	0x67, 0x68, 0x74, 0x3a, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3b, 
-	0xa, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 
-	0x75, 0x6e, 0x64, 0x3a, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 
-	0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x3b, 0xa, 0x20, 0x20, 
-	0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x6e, 0x6f, 
-	0x6e, 0x65, 0x3b, 0xa, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 
-	0x6f, 0x72, 0x3a, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 
-	0x72, 0x3b, 0xa, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 
-	0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 0x2e, 0x32, 0x72, 
-	0x65, 0x6d, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x62, 0x61, 
-	0x6e, 0x6e, 0x65, 0x72, 0x2d, 0x63, 0x6c, 0x6f, 0x73, 0x65, 
-	0x3a, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x7b, 0xa, 0x20, 
-	0x20, 0x6f, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3a, 0x20, 
-	0x30, 0x2e, 0x38, 0x3b, 0x20, 0x2f, 0x2a, 0x20, 0x53, 0x75, 
-	0x62, 0x74, 0x6c, 0x65, 0x20, 0x68, 0x6f, 0x76, 0x65, 0x72, 
-	0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x20, 0x2a, 0x2f, 
-	0xa, 0x7d, 0xa, 0xa, 0x2f, 0x2a, 0x20, 0x53, 0x70, 0x65, 
-	0x63, 0x69, 0x66, 0x69, 0x63, 0x20, 0x42, 0x61, 0x6e, 0x6e, 
-	0x65, 0x72, 0x20, 0x54, 0x79, 0x70, 0x65, 0x73, 0x20, 0x2a, 
-	0x2f, 0xa, 0x2e, 0x62, 0x61, 0x6e, 0x6e, 0x65, 0x72, 0x2d, 
-	0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x7b, 0xa, 0x20, 0x20, 
-	0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 
-	0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x66, 
-	0x64, 0x65, 0x63, 0x65, 0x61, 0x3b, 0x20, 0x2f, 0x2a, 0x20, 
-	0x4c, 0x69, 0x67, 0x68, 0x74, 0x20, 0x72, 0x65, 0x64, 0x20, 
-	0x2a, 0x2f, 0xa, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 
-	0x3a, 0x20, 0x23, 0x62, 0x39, 0x31, 0x63, 0x31, 0x63, 0x3b, 
-	0x20, 0x2f, 0x2a, 0x20, 0x44, 0x61, 0x72, 0x6b, 0x20, 0x72, 
-	0x65, 0x64, 0x20, 0x2a, 0x2f, 0xa, 0x20, 0x20, 0x62, 0x6f, 
-	0x72, 0x64, 0x65, 0x72, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 
-	0x3a, 0x20, 0x23, 0x66, 0x63, 0x61, 0x35, 0x61, 0x35, 0x3b, 
-	0x20, 0x2f, 0x2a, 0x20, 0x4d, 0x65, 0x64, 0x69, 0x75, 0x6d, 
-	0x20, 0x72, 0x65, 0x64, 0x20, 0x2a, 0x2f, 0xa, 0x7d, 0xa, 
-	0xa, 0x2e, 0x62, 0x61, 0x6e, 0x6e, 0x65, 0x72, 0x2d, 0x77, 
-	0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x7b, 0xa, 0x20, 
-	0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 
-	0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 
-	0x66, 0x65, 0x66, 0x33, 0x63, 0x37, 0x3b, 0x20, 0x2f, 0x2a, 
-	0x20, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x20, 0x79, 0x65, 0x6c, 
-	0x6c, 0x6f, 0x77, 0x20, 0x2a, 0x2f, 0xa, 0x20, 0x20, 0x63, 
-	0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x38, 0x35, 0x34, 
-	0x64, 0x30, 0x65, 0x3b, 0x20, 0x2f, 0x2a, 0x20, 0x44, 0x61, 
-	0x72, 0x6b, 0x20, 0x67, 0x6f, 0x6c, 0x64, 0x20, 0x2a, 0x2f, 
-	0xa, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 
-	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x66, 0x63, 
-	0x64, 0x33, 0x34, 0x64, 0x3b, 0x20, 0x2f, 0x2a, 0x20, 0x4d, 
-	0x65, 0x64, 0x69, 0x75, 0x6d, 0x20, 0x67, 0x6f, 0x6c, 0x64, 
-	0x20, 0x2a, 0x2f, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x62, 0x61, 
-	0x6e, 0x6e, 0x65, 0x72, 0x2d, 0x69, 0x6e, 0x66, 0x6f, 0x20, 
-	0x7b, 0xa, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 
-	0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 
-	0x3a, 0x20, 0x23, 0x64, 0x62, 0x65, 0x61, 0x66, 0x65, 0x3b, 
-	0x20, 0x2f, 0x2a, 0x20, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x20, 
-	0x62, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x2f, 0xa, 0x20, 0x20, 
-	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x31, 0x65, 
-	0x34, 0x30, 0x61, 0x66, 0x3b, 0x20, 0x2f, 0x2a, 0x20, 0x44, 
-	0x61, 0x72, 0x6b, 0x20, 0x62, 0x6c, 0x75, 0x65, 0x20, 0x2a, 
-	0x2f, 0xa, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 
-	0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x39, 
-	0x33, 0x63, 0x35, 0x66, 0x64, 0x3b, 0x20, 0x2f, 0x2a, 0x20, 
-	0x4d, 0x65, 0x64, 0x69, 0x75, 0x6d, 0x20, 0x62, 0x6c, 0x75, 
-	0x65, 0x20, 0x2a, 0x2f, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x62, 
-	0x61, 0x6e, 0x6e, 0x65, 0x72, 0x2d, 0x73, 0x75, 0x63, 0x63, 
-	0x65, 0x73, 0x73, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x62, 0x61, 
-	0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 
-	0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x64, 0x63, 0x66, 
-	0x63, 0x65, 0x37, 0x3b, 0x20, 0x2f, 0x2a, 0x20, 0x4c, 0x69, 
-	0x67, 0x68, 0x74, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x20, 
-	0x2a, 0x2f, 0xa, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 
-	0x3a, 0x20, 0x23, 0x30, 0x36, 0x35, 0x66, 0x34, 0x36, 0x3b, 
-	0x20, 0x2f, 0x2a, 0x20, 0x44, 0x61, 0x72, 0x6b, 0x20, 0x67, 
-	0x72, 0x65, 0x65, 0x6e, 0x20, 0x2a, 0x2f, 0xa, 0x20, 0x20, 
-	0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x63, 0x6f, 0x6c, 
-	0x6f, 0x72, 0x3a, 0x20, 0x23, 0x36, 0x65, 0x65, 0x37, 0x62, 
-	0x37, 0x3b, 0x20, 0x2f, 0x2a, 0x20, 0x4d, 0x65, 0x64, 0x69, 
-	0x75, 0x6d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x20, 0x2a, 
-	0x2f, 0xa, 0x7d, 0xa, 0xa, 0x2f, 0x2a, 0x20, 0x2d, 0x2d, 
-	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x4d, 
-	0x6f, 0x64, 0x65, 0x20, 0x43, 0x61, 0x72, 0x64, 0x73, 0x20, 
-	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
-	0x20, 0x2a, 0x2f, 0xa, 0x2e, 0x6d, 0x6f, 0x64, 0x65, 0x2d, 
-	0x67, 0x72, 0x69, 0x64, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x64, 
-	0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x67, 0x72, 
-	0x69, 0x64, 0x3b, 0xa, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3a, 
-	0x20, 0x31, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x6d, 
-	0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x31, 0x72, 0x65, 
-	0x6d, 0x20, 0x30, 0x3b, 0xa, 0x20, 0x20, 0x67, 0x72, 0x69, 
-	0x64, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 
-	0x2d, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x73, 0x3a, 0x20, 
-	0x31, 0x66, 0x72, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x6d, 
-	0x6f, 0x64, 0x65, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 
-	0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3b, 
-	0xa, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 
-	0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x31, 0x30, 
-	0x70, 0x78, 0x3b, 0xa, 0x20, 0x20, 0x62, 0x6f, 0x78, 0x2d, 
-	0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x3a, 0x20, 0x30, 0x20, 
-	0x30, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 
-	0x61, 0x28, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2e, 
-	0x30, 0x38, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x70, 0x61, 0x64, 
-	0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x31, 0x72, 0x65, 0x6d, 
-	0x3b, 0xa, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 
-	0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 
-	0x64, 0x20, 0x23, 0x65, 0x35, 0x65, 0x37, 0x65, 0x62, 0x3b, 
-	0xa, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 
-	0x3a, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0xa, 0x20, 0x20, 
-	0x66, 0x6c, 0x65, 0x78, 0x2d, 0x64, 0x69, 0x72, 0x65, 0x63, 
-	0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x63, 0x6f, 0x6c, 0x75, 
-	0x6d, 0x6e, 0x3b, 0xa, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3a, 
-	0x20, 0x30, 0x2e, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 
-	0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x69, 0x74, 0x69, 0x6f, 
-	0x6e, 0x3a, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 
-	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x20, 0x30, 0x2e, 0x32, 0x73, 
-	0x20, 0x65, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x62, 0x6f, 0x78, 
-	0x2d, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x20, 0x30, 0x2e, 
-	0x32, 0x73, 0x20, 0x65, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x74, 
-	0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x30, 
-	0x2e, 0x32, 0x73, 0x20, 0x65, 0x61, 0x73, 0x65, 0x3b, 0xa, 
-	0x7d, 0xa, 0xa, 0x2e, 0x6d, 0x6f, 0x64, 0x65, 0x2d, 0x63, 
-	0x61, 0x72, 0x64, 0x3a, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x20, 
-	0x7b, 0xa, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 
-	0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30, 
-	0x30, 0x37, 0x38, 0x65, 0x37, 0x3b, 0xa, 0x20, 0x20, 0x62, 
-	0x6f, 0x78, 0x2d, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x3a, 
-	0x20, 0x30, 0x20, 0x36, 0x70, 0x78, 0x20, 0x31, 0x36, 0x70, 
-	0x78, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2c, 0x31, 
-	0x32, 0x30, 0x2c, 0x32, 0x33, 0x31, 0x2c, 0x30, 0x2e, 0x31, 
-	0x35, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6e, 
-	0x73, 0x66, 0x6f, 0x72, 0x6d, 0x3a, 0x20, 0x74, 0x72, 0x61, 
-	0x6e, 0x73, 0x6c, 0x61, 0x74, 0x65, 0x59, 0x28, 0x2d, 0x32, 
-	0x70, 0x78, 0x29, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x6d, 
-	0x6f, 0x64, 0x65, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x2e, 0x61, 
-	0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x7b, 0xa, 0x20, 0x20, 
-	0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x63, 0x6f, 0x6c, 
-	0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30, 0x63, 0x39, 0x65, 0x36, 
-	0x63, 0x3b, 0xa, 0x20, 0x20, 0x62, 0x6f, 0x78, 0x2d, 0x73, 
-	0x68, 0x61, 0x64, 0x6f, 0x77, 0x3a, 0x20, 0x30, 0x20, 0x38, 
-	0x70, 0x78, 0x20, 0x31, 0x38, 0x70, 0x78, 0x20, 0x72, 0x67, 
-	0x62, 0x61, 0x28, 0x31, 0x32, 0x2c, 0x20, 0x31, 0x35, 0x38, 
-	0x2c, 0x20, 0x31, 0x30, 0x38, 0x2c, 0x20, 0x30, 0x2e, 0x32, 
-	0x29, 0x3b, 0xa, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 
-	0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x6c, 0x69, 0x6e, 
-	0x65, 0x61, 0x72, 0x2d, 0x67, 0x72, 0x61, 0x64, 0x69, 0x65, 
-	0x6e, 0x74, 0x28, 0x31, 0x33, 0x35, 0x64, 0x65, 0x67, 0x2c, 
-	0x20, 0x23, 0x65, 0x36, 0x66, 0x66, 0x66, 0x35, 0x20, 0x30, 
-	0x25, 0x2c, 0x20, 0x23, 0x66, 0x37, 0x66, 0x66, 0x66, 0x62, 
-	0x20, 0x31, 0x30, 0x30, 0x25, 0x29, 0x3b, 0xa, 0x7d, 0xa, 
-	0xa, 0x2e, 0x6d, 0x6f, 0x64, 0x65, 0x2d, 0x63, 0x61, 0x72, 
-	0x64, 0x20, 0x68, 0x33, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x6d, 
-	0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x3b, 0xa, 
-	0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 
-	0x30, 0x30, 0x37, 0x38, 0x65, 0x37, 0x3b, 0xa, 0x7d, 0xa, 
-	0xa, 0x2e, 0x6d, 0x6f, 0x64, 0x65, 0x2d, 0x63, 0x61, 0x72, 
-	0x64, 0x20, 0x70, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x6d, 0x61, 
-	0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x3b, 0xa, 0x20, 
-	0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x34, 
-	0x34, 0x34, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x6d, 0x6f, 
-	0x64, 0x65, 0x2d, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 
-	0x7b, 0xa, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 
-	0x79, 0x3a, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0xa, 0x20, 
-	0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74, 0x65, 
-	0x6d, 0x73, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 
-	0x3b, 0xa, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3a, 0x20, 0x30, 
-	0x2e, 0x37, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x7d, 0xa, 
-	0xa, 0x2e, 0x6d, 0x6f, 0x64, 0x65, 0x2d, 0x69, 0x63, 0x6f, 
-	0x6e, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 
-	0x68, 0x3a, 0x20, 0x35, 0x32, 0x70, 0x78, 0x3b, 0xa, 0x20, 
-	0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x35, 
-	0x32, 0x70, 0x78, 0x3b, 0xa, 0x20, 0x20, 0x62, 0x6f, 0x72, 
-	0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 
-	0x3a, 0x20, 0x31, 0x32, 0x70, 0x78, 0x3b, 0xa, 0x20, 0x20, 
-	0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 
-	0x2d, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x3a, 0x20, 0x6e, 
-	0x6f, 0x2d, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x3b, 0xa, 
-	0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 
-	0x6e, 0x64, 0x2d, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 
-	0x6e, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 
-	0xa, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 
-	0x75, 0x6e, 0x64, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 
-	0x33, 0x32, 0x70, 0x78, 0x20, 0x33, 0x32, 0x70, 0x78, 0x3b, 
-	0xa, 0x20, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x2d, 0x73, 0x68, 
-	0x72, 0x69, 0x6e, 0x6b, 0x3a, 0x20, 0x30, 0x3b, 0xa, 0x20, 
-	0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 
-	0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 
-	0x65, 0x65, 0x66, 0x34, 0x66, 0x66, 0x3b, 0xa, 0x7d, 0xa, 
-	0xa, 0x2e, 0x6d, 0x6f, 0x64, 0x65, 0x2d, 0x69, 0x63, 0x6f, 
-	0x6e, 0x2e, 0x75, 0x73, 0x62, 0x20, 0x7b, 0xa, 0x20, 0x20, 
-	0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 
-	0x2d, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x3a, 0x20, 0x75, 0x72, 
-	0x6c, 0x28, 0x22, 0x64, 0x61, 0x74, 0x61, 0x3a, 0x69, 0x6d, 
-	0x61, 0x67, 0x65, 0x2f, 0x73, 0x76, 0x67, 0x2b, 0x78, 0x6d, 
-	0x6c, 0x3b, 0x75, 0x74, 0x66, 0x38, 0x2c, 0x3c, 0x73, 0x76, 
-	0x67, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3d, 0x27, 0x68, 
-	0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 
-	0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x32, 0x30, 0x30, 
-	0x30, 0x2f, 0x73, 0x76, 0x67, 0x27, 0x20, 0x76, 0x69, 0x65, 
-	0x77, 0x42, 0x6f, 0x78, 0x3d, 0x27, 0x30, 0x20, 0x30, 0x20, 
-	0x32, 0x34, 0x20, 0x32, 0x34, 0x27, 0x20, 0x66, 0x69, 0x6c, 
-	0x6c, 0x3d, 0x27, 0x6e, 0x6f, 0x6e, 0x65, 0x27, 0x20, 0x73, 
-	0x74, 0x72, 0x6f, 0x6b, 0x65, 0x3d, 0x27, 0x25, 0x32, 0x33, 
-	0x30, 0x30, 0x37, 0x38, 0x65, 0x37, 0x27, 0x20, 0x73, 0x74, 
-	0x72, 0x6f, 0x6b, 0x65, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 
-	0x3d, 0x27, 0x32, 0x27, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 
-	0x65, 0x2d, 0x6c, 0x69, 0x6e, 0x65, 0x63, 0x61, 0x70, 0x3d, 
-	0x27, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x27, 0x20, 0x73, 0x74, 
-	0x72, 0x6f, 0x6b, 0x65, 0x2d, 0x6c, 0x69, 0x6e, 0x65, 0x6a, 
-	0x6f, 0x69, 0x6e, 0x3d, 0x27, 0x72, 0x6f, 0x75, 0x6e, 0x64, 
-	0x27, 0x3e, 0x3c, 0x70, 0x61, 0x74, 0x68, 0x20, 0x64, 0x3d, 
-	0x27, 0x4d, 0x31, 0x32, 0x20, 0x33, 0x76, 0x33, 0x27, 0x2f, 
-	0x3e, 0x3c, 0x70, 0x61, 0x74, 0x68, 0x20, 0x64, 0x3d, 0x27, 
-	0x4d, 0x31, 0x32, 0x20, 0x38, 0x76, 0x33, 0x27, 0x2f, 0x3e, 
-	0x3c, 0x70, 0x61, 0x74, 0x68, 0x20, 0x64, 0x3d, 0x27, 0x4d, 
-	0x31, 0x32, 0x20, 0x31, 0x31, 0x68, 0x33, 0x6c, 0x2d, 0x33, 
-	0x20, 0x35, 0x2d, 0x33, 0x2d, 0x35, 0x68, 0x33, 0x7a, 0x27, 
-	0x2f, 0x3e, 0x3c, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x20, 
-	0x63, 0x78, 0x3d, 0x27, 0x31, 0x32, 0x27, 0x20, 0x63, 0x79, 
-	0x3d, 0x27, 0x31, 0x39, 0x27, 0x20, 0x72, 0x3d, 0x27, 0x32, 
-	0x27, 0x2f, 0x3e, 0x3c, 0x70, 0x61, 0x74, 0x68, 0x20, 0x64, 
-	0x3d, 0x27, 0x4d, 0x38, 0x20, 0x38, 0x6c, 0x2d, 0x32, 0x20, 
-	0x32, 0x20, 0x32, 0x20, 0x32, 0x27, 0x2f, 0x3e, 0x3c, 0x70, 
-	0x61, 0x74, 0x68, 0x20, 0x64, 0x3d, 0x27, 0x4d, 0x31, 0x36, 
-	0x20, 0x38, 0x6c, 0x32, 0x20, 0x32, 0x2d, 0x32, 0x20, 0x32, 
-	0x27, 0x2f, 0x3e, 0x3c, 0x2f, 0x73, 0x76, 0x67, 0x3e, 0x22, 
-	0x29, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x6d, 0x6f, 0x64, 
-	0x65, 0x2d, 0x69, 0x63, 0x6f, 0x6e, 0x2e, 0x62, 0x6c, 0x75, 
-	0x65, 0x74, 0x6f, 0x6f, 0x74, 0x68, 0x20, 0x7b, 0xa, 0x20, 
-	0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 
-	0x64, 0x2d, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x3a, 0x20, 0x75, 
-	0x72, 0x6c, 0x28, 0x22, 0x64, 0x61, 0x74, 0x61, 0x3a, 0x69, 
-	0x6d, 0x61, 0x67, 0x65, 0x2f, 0x73, 0x76, 0x67, 0x2b, 0x78, 
-	0x6d, 0x6c, 0x3b, 0x75, 0x74, 0x66, 0x38, 0x2c, 0x3c, 0x73, 
-	0x76, 0x67, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3d, 0x27, 
-	0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 
-	0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x32, 0x30, 
-	0x30, 0x30, 0x2f, 0x73, 0x76, 0x67, 0x27, 0x20, 0x76, 0x69, 
-	0x65, 0x77, 0x42, 0x6f, 0x78, 0x3d, 0x27, 0x30, 0x20, 0x30, 
-	0x20, 0x32, 0x34, 0x20, 0x32, 0x34, 0x27, 0x20, 0x66, 0x69, 
-	0x6c, 0x6c, 0x3d, 0x27, 0x6e, 0x6f, 0x6e, 0x65, 0x27, 0x20, 
-	0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x3d, 0x27, 0x25, 0x32, 
-	0x33, 0x30, 0x30, 0x37, 0x38, 0x65, 0x37, 0x27, 0x20, 0x73, 
-	0x74, 0x72, 0x6f, 0x6b, 0x65, 0x2d, 0x77, 0x69, 0x64, 0x74, 
-	0x68, 0x3d, 0x27, 0x32, 0x27, 0x20, 0x73, 0x74, 0x72, 0x6f, 
-	0x6b, 0x65, 0x2d, 0x6c, 0x69, 0x6e, 0x65, 0x63, 0x61, 0x70, 
-	0x3d, 0x27, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x27, 0x20, 0x73, 
-	0x74, 0x72, 0x6f, 0x6b, 0x65, 0x2d, 0x6c, 0x69, 0x6e, 0x65, 
-	0x6a, 0x6f, 0x69, 0x6e, 0x3d, 0x27, 0x72, 0x6f, 0x75, 0x6e, 
-	0x64, 0x27, 0x3e, 0x3c, 0x70, 0x61, 0x74, 0x68, 0x20, 0x64, 
-	0x3d, 0x27, 0x4d, 0x31, 0x32, 0x20, 0x33, 0x6c, 0x36, 0x20, 
-	0x35, 0x2d, 0x36, 0x20, 0x35, 0x20, 0x36, 0x20, 0x35, 0x2d, 
-	0x36, 0x20, 0x35, 0x56, 0x33, 0x7a, 0x27, 0x2f, 0x3e, 0x3c, 
-	0x70, 0x61, 0x74, 0x68, 0x20, 0x64, 0x3d, 0x27, 0x4d, 0x31, 
-	0x32, 0x20, 0x31, 0x33, 0x4c, 0x36, 0x20, 0x38, 0x27, 0x2f, 
-	0x3e, 0x3c, 0x70, 0x61, 0x74, 0x68, 0x20, 0x64, 0x3d, 0x27, 
-	0x4d, 0x31, 0x32, 0x20, 0x31, 0x33, 0x4c, 0x36, 0x20, 0x31, 
-	0x38, 0x27, 0x2f, 0x3e, 0x3c, 0x2f, 0x73, 0x76, 0x67, 0x3e, 
-	0x22, 0x29, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x6d, 0x6f, 
-	0x64, 0x65, 0x2d, 0x69, 0x63, 0x6f, 0x6e, 0x2e, 0x6e, 0x61, 
-	0x74, 0x69, 0x76, 0x65, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x62, 
-	0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 
-	0x69, 0x6d, 0x61, 0x67, 0x65, 0x3a, 0x20, 0x75, 0x72, 0x6c, 
-	0x28, 0x22, 0x64, 0x61, 0x74, 0x61, 0x3a, 0x69, 0x6d, 0x61, 
-	0x67, 0x65, 0x2f, 0x73, 0x76, 0x67, 0x2b, 0x78, 0x6d, 0x6c, 
-	0x3b, 0x75, 0x74, 0x66, 0x38, 0x2c, 0x3c, 0x73, 0x76, 0x67, 
-	0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3d, 0x27, 0x68, 0x74, 
-	0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 
-	0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x32, 0x30, 0x30, 0x30, 
-	0x2f, 0x73, 0x76, 0x67, 0x27, 0x20, 0x76, 0x69, 0x65, 0x77, 
-	0x42, 0x6f, 0x78, 0x3d, 0x27, 0x30, 0x20, 0x30, 0x20, 0x32, 
-	0x34, 0x20, 0x32, 0x34, 0x27, 0x20, 0x66, 0x69, 0x6c, 0x6c, 
-	0x3d, 0x27, 0x6e, 0x6f, 0x6e, 0x65, 0x27, 0x20, 0x73, 0x74, 
-	0x72, 0x6f, 0x6b, 0x65, 0x3d, 0x27, 0x25, 0x32, 0x33, 0x30, 
-	0x30, 0x37, 0x38, 0x65, 0x37, 0x27, 0x20, 0x73, 0x74, 0x72, 
-	0x6f, 0x6b, 0x65, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 
-	0x27, 0x32, 0x27, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 
-	0x2d, 0x6c, 0x69, 0x6e, 0x65, 0x63, 0x61, 0x70, 0x3d, 0x27, 
-	0x72, 0x6f, 0x75, 0x6e, 0x64, 0x27, 0x20, 0x73, 0x74, 0x72, 
-	0x6f, 0x6b, 0x65, 0x2d, 0x6c, 0x69, 0x6e, 0x65, 0x6a, 0x6f, 
-	0x69, 0x6e, 0x3d, 0x27, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x27, 
-	0x3e, 0x3c, 0x72, 0x65, 0x63, 0x74, 0x20, 0x78, 0x3d, 0x27, 
-	0x35, 0x27, 0x20, 0x79, 0x3d, 0x27, 0x35, 0x27, 0x20, 0x77, 
-	0x69, 0x64, 0x74, 0x68, 0x3d, 0x27, 0x31, 0x34, 0x27, 0x20, 
-	0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x27, 0x31, 0x34, 
-	0x27, 0x20, 0x72, 0x78, 0x3d, 0x27, 0x32, 0x27, 0x20, 0x72, 
-	0x79, 0x3d, 0x27, 0x32, 0x27, 0x2f, 0x3e, 0x3c, 0x70, 0x61, 
-	0x74, 0x68, 0x20, 0x64, 0x3d, 0x27, 0x4d, 0x39, 0x20, 0x39, 
-	0x68, 0x36, 0x76, 0x36, 0x48, 0x39, 0x7a, 0x27, 0x2f, 0x3e, 
-	0x3c, 0x70, 0x61, 0x74, 0x68, 0x20, 0x64, 0x3d, 0x27, 0x4d, 
-	0x37, 0x20, 0x33, 0x76, 0x34, 0x27, 0x2f, 0x3e, 0x3c, 0x70, 
-	0x61, 0x74, 0x68, 0x20, 0x64, 0x3d, 0x27, 0x4d, 0x31, 0x37, 
-	0x20, 0x33, 0x76, 0x34, 0x27, 0x2f, 0x3e, 0x3c, 0x70, 0x61, 
-	0x74, 0x68, 0x20, 0x64, 0x3d, 0x27, 0x4d, 0x37, 0x20, 0x31, 
-	0x37, 0x76, 0x34, 0x27, 0x2f, 0x3e, 0x3c, 0x70, 0x61, 0x74, 
-	0x68, 0x20, 0x64, 0x3d, 0x27, 0x4d, 0x31, 0x37, 0x20, 0x31, 
-	0x37, 0x76, 0x34, 0x27, 0x2f, 0x3e, 0x3c, 0x2f, 0x73, 0x76, 
-	0x67, 0x3e, 0x22, 0x29, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x40, 
-	0x6d, 0x65, 0x64, 0x69, 0x61, 0x20, 0x28, 0x6d, 0x69, 0x6e, 
-	0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x36, 0x34, 
-	0x30, 0x70, 0x78, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x2e, 
-	0x6d, 0x6f, 0x64, 0x65, 0x2d, 0x67, 0x72, 0x69, 0x64, 0x20, 
-	0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x67, 0x72, 0x69, 0x64, 
-	0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x2d, 
-	0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x73, 0x3a, 0x20, 0x72, 
-	0x65, 0x70, 0x65, 0x61, 0x74, 0x28, 0x33, 0x2c, 0x20, 0x31, 
-	0x66, 0x72, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x7d, 0xa, 0x7d, 
-	0xa, 0xa, 0x2f, 0x2a, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 
-	0x41, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x49, 0x63, 
-	0x6f, 0x6e, 0x20, 0x53, 0x74, 0x79, 0x6c, 0x69, 0x6e, 0x67, 
-	0x20, 0x2a, 0x2f, 0xa, 0x2e, 0x62, 0x61, 0x6e, 0x6e, 0x65, 
-	0x72, 0x2d, 0x69, 0x63, 0x6f, 0x6e, 0x20, 0x7b, 0xa, 0x20, 
-	0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 
-	0x3a, 0x20, 0x31, 0x2e, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0x20, 
-	0x2f, 0x2a, 0x20, 0x4c, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 
-	0x69, 0x63, 0x6f, 0x6e, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 
-	0x2a, 0x2f, 0xa, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 
-	0x6e, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x30, 
-	0x2e, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x7d, 0xa, 0xa, 
-	0x2f, 0x2a, 0x20, 0x41, 0x70, 0x70, 0x20, 0x4c, 0x69, 0x73, 
-	0x74, 0x20, 0x53, 0x74, 0x79, 0x6c, 0x69, 0x6e, 0x67, 0x20, 
-	0x2a, 0x2f, 0xa, 0x2e, 0x61, 0x70, 0x70, 0x2d, 0x6c, 0x69, 
-	0x73, 0x74, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x70, 0x61, 0x64, 
-	0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 0x72, 0x65, 0x6d, 
-	0x3b, 0xa, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 
-	0x3a, 0x20, 0x30, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 
-	0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x30, 0x30, 
-	0x25, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x61, 0x70, 0x70, 
-	0x2d, 0x72, 0x6f, 0x77, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x6d, 
-	0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 
-	0x20, 0x31, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x6d, 
-	0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 
-	0x6f, 0x6d, 0x3a, 0x20, 0x31, 0x72, 0x65, 0x6d, 0x3b, 0xa, 
-	0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x2d, 
-	0x6c, 0x65, 0x66, 0x74, 0x3a, 0x20, 0x30, 0x3b, 0xa, 0x20, 
-	0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x2d, 0x72, 
-	0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x30, 0x3b, 0xa, 0x20, 
-	0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x2d, 0x62, 
-	0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x31, 0x72, 0x65, 
-	0x6d, 0x3b, 0xa, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 
-	0x6e, 0x67, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x31, 0x72, 
-	0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 
-	0x68, 0x3a, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3b, 0xa, 0x20, 
-	0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74, 0x65, 
-	0x6d, 0x73, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 
-	0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x61, 0x70, 0x70, 0x2d, 
-	0x72, 0x6f, 0x77, 0x3a, 0x6e, 0x74, 0x68, 0x2d, 0x63, 0x68, 
-	0x69, 0x6c, 0x64, 0x28, 0x6f, 0x64, 0x64, 0x29, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 
-	0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 
-	0x20, 0x23, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3b, 0x20, 
-	0x2f, 0x2a, 0x20, 0x57, 0x68, 0x69, 0x74, 0x65, 0x20, 0x62, 
-	0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 
-	0x66, 0x6f, 0x72, 0x20, 0x6f, 0x64, 0x64, 0x20, 0x72, 0x6f, 
-	0x77, 0x73, 0x20, 0x2a, 0x2f, 0xa, 0x7d, 0xa, 0xa, 0x2f, 
-	0x2a, 0x20, 0x2e, 0x61, 0x70, 0x70, 0x2d, 0x72, 0x6f, 0x77, 
-	0x3a, 0x6e, 0x74, 0x68, 0x2d, 0x63, 0x68, 0x69, 0x6c, 0x64, 
-	0x28, 0x65, 0x76, 0x65, 0x6e, 0x29, 0x20, 0x7b, 0xa, 0x20, 
-	0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 
-	0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 
-	0x66, 0x34, 0x66, 0x34, 0x66, 0x39, 0x3b, 0x20, 0x2f, 0x2a, 
-	0x20, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x20, 0x67, 0x72, 0x61, 
-	0x79, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 0x76, 0x65, 0x6e, 
-	0x20, 0x72, 0x6f, 0x77, 0x73, 0x20, 0x2a, 0x2f, 0xa, 0x7d, 
-	0x20, 0x2a, 0x2f, 0xa, 0xa, 0x2e, 0x61, 0x70, 0x70, 0x2d, 
-	0x69, 0x6d, 0x61, 0x67, 0x65, 0x20, 0x7b, 0xa, 0x20, 0x20, 
-	0x66, 0x6c, 0x65, 0x78, 0x3a, 0x20, 0x30, 0x20, 0x30, 0x20, 
-	0x61, 0x75, 0x74, 0x6f, 0x3b, 0x20, 0x2f, 0x2a, 0x20, 0x46, 
-	0x69, 0x78, 0x65, 0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
-	0x20, 0x66, 0x6f, 0x72, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 
-	0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 
-	0x20, 0x2a, 0x2f, 0xa, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 
-	0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x20, 0x63, 0x65, 
-	0x6e, 0x74, 0x65, 0x72, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 
-	0x61, 0x70, 0x70, 0x2d, 0x74, 0x68, 0x75, 0x6d, 0x62, 0x6e, 
-	0x61, 0x69, 0x6c, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x77, 0x69, 
-	0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3b, 
-	0xa, 0x20, 0x20, 0x6d, 0x61, 0x78, 0x2d, 0x77, 0x69, 0x64, 
-	0x74, 0x68, 0x3a, 0x20, 0x32, 0x35, 0x36, 0x70, 0x78, 0x3b, 
-	0xa, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 
-	0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0xa, 0x20, 0x20, 0x62, 
-	0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 
-	0x75, 0x73, 0x3a, 0x20, 0x34, 0x70, 0x78, 0x3b, 0xa, 0x20, 
-	0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x2d, 0x66, 0x69, 
-	0x74, 0x3a, 0x20, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x3b, 0xa, 
-	0x7d, 0xa, 0xa, 0x2f, 0x2a, 0x20, 0x4d, 0x69, 0x64, 0x64, 
-	0x6c, 0x65, 0x3a, 0x20, 0x41, 0x70, 0x70, 0x20, 0x44, 0x65, 
-	0x74, 0x61, 0x69, 0x6c, 0x73, 0x20, 0x2a, 0x2f, 0xa, 0x2e, 
-	0x61, 0x70, 0x70, 0x2d, 0x64, 0x65, 0x74, 0x61, 0x69, 0x6c, 
-	0x73, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x66, 0x6c, 0x65, 0x78, 
-	0x3a, 0x20, 0x31, 0x20, 0x31, 0x20, 0x61, 0x75, 0x74, 0x6f, 
-	0x3b, 0x20, 0x2f, 0x2a, 0x20, 0x46, 0x6c, 0x65, 0x78, 0x69, 
-	0x62, 0x6c, 0x65, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x66, 
-	0x6f, 0x72, 0x20, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x20, 
-	0x70, 0x61, 0x6e, 0x65, 0x6c, 0x20, 0x2a, 0x2f, 0xa, 0x20, 
-	0x20, 0x6f, 0x76, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x3a, 
-	0x20, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x3b, 0x20, 0x2f, 
-	0x2a, 0x20, 0x50, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x20, 
-	0x6f, 0x76, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x20, 0x66, 
-	0x6f, 0x72, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x74, 0x65, 
-	0x78, 0x74, 0x20, 0x2a, 0x2f, 0xa, 0x7d, 0xa, 0xa, 0x2e, 
-	0x61, 0x70, 0x70, 0x2d, 0x64, 0x65, 0x74, 0x61, 0x69, 0x6c, 
-	0x73, 0x20, 0x68, 0x33, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x64, 
-	0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x69, 0x6e, 
-	0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 
-	0x3b, 0xa, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 
-	0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x20, 0x30, 0x72, 0x65, 
-	0x6d, 0x3b, 0xa, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 
-	0x6e, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x31, 
-	0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x6d, 0x61, 0x72, 
-	0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x30, 
-	0x2e, 0x32, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x6d, 
-	0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 
-	0x6f, 0x6d, 0x3a, 0x20, 0x30, 0x2e, 0x35, 0x72, 0x65, 0x6d, 
-	0x3b, 0xa, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 
-	0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 0x2e, 0x32, 0x72, 0x65, 
-	0x6d, 0x3b, 0xa, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 
-	0x3a, 0x20, 0x23, 0x33, 0x33, 0x33, 0x3b, 0xa, 0x7d, 0xa, 
-	0xa, 0x2e, 0x61, 0x70, 0x70, 0x2d, 0x64, 0x65, 0x74, 0x61, 
-	0x69, 0x6c, 0x73, 0x20, 0x68, 0x34, 0x20, 0x7b, 0xa, 0x20, 
-	0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 
-	0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x62, 0x6c, 0x6f, 
-	0x63, 0x6b, 0x3b, 0xa, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 
-	0x69, 0x6e, 0x3a, 0x20, 0x30, 0x3b, 0xa, 0x20, 0x20, 0x66, 
-	0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 
-	0x30, 0x2e, 0x39, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 
-	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x33, 0x33, 
-	0x33, 0x3b, 0xa, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 
-	0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x20, 0x22, 0x43, 
-	0x6f, 0x75, 0x72, 0x69, 0x65, 0x72, 0x20, 0x4e, 0x65, 0x77, 
-	0x22, 0x2c, 0x20, 0x43, 0x6f, 0x75, 0x72, 0x69, 0x65, 0x72, 
-	0x2c, 0x20, 0x6d, 0x6f, 0x6e, 0x6f, 0x73, 0x70, 0x61, 0x63, 
-	0x65, 0x3b, 0xa, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 
-	0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x62, 0x6f, 
-	0x6c, 0x64, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0xa, 0x2e, 0x61, 
-	0x70, 0x70, 0x2d, 0x64, 0x65, 0x74, 0x61, 0x69, 0x6c, 0x73, 
-	0x20, 0x70, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x6d, 0x61, 0x72, 
-	0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x30, 
-	0x3b, 0xa, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 
-	0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x20, 0x30, 0x72, 0x65, 
-	0x6d, 0x3b, 0xa, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 
-	0x6e, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x31, 
-	0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x6d, 0x61, 0x72, 
-	0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 
-	0x3a, 0x20, 0x31, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 
-	0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 
-	0x20, 0x31, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x63, 
-	0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x35, 0x35, 0x35, 
-	0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x61, 0x70, 0x70, 0x2d, 
-	0x72, 0x6f, 0x77, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 
-	0x2d, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 
-	0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 
-	0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 
-	0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x66, 0x66, 0x65, 0x36, 
-	0x65, 0x36, 0x3b, 0x20, 0x2f, 0x2a, 0x20, 0x6c, 0x69, 0x67, 
-	0x68, 0x74, 0x20, 0x72, 0x65, 0x64, 0x20, 0x2a, 0x2f, 0xa, 
-	0x20, 0x20, 0x7d, 0xa, 0xa, 0x2e, 0x74, 0x61, 0x67, 0x73, 
-	0x2d, 0x72, 0x6f, 0x77, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x64, 
-	0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x66, 0x6c, 
-	0x65, 0x78, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x2f, 0x2a, 0x20, 0x50, 0x75, 0x74, 0x20, 0x62, 0x6f, 0x74, 
-	0x68, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x73, 0x20, 0x6f, 0x6e, 
-	0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 
-	0x2a, 0x2f, 0xa, 0x20, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x2d, 
-	0x77, 0x72, 0x61, 0x70, 0x3a, 0x20, 0x77, 0x72, 0x61, 0x70, 
-	0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x4c, 
-	0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x20, 0x77, 0x72, 
-	0x61, 0x70, 0x20, 0x69, 0x66, 0x20, 0x73, 0x63, 0x72, 0x65, 
-	0x65, 0x6e, 0x20, 0x69, 0x73, 0x20, 0x74, 0x6f, 0x6f, 0x20, 
-	0x6e, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x20, 0x2a, 0x2f, 0xa, 
-	0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x2d, 
-	0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x31, 0x72, 
-	0x65, 0x6d, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x74, 0x61, 
-	0x67, 0x73, 0x2d, 0x72, 0x6f, 0x77, 0x20, 0x75, 0x6c, 0x20, 
-	0x7b, 0xa, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 
-	0x3a, 0x20, 0x30, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x52, 0x65, 
-	0x6d, 0x6f, 0x76, 0x65, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 
-	0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x20, 0x73, 0x6f, 
-	0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x6c, 0x69, 0x6e, 0x65, 
-	0x20, 0x75, 0x70, 0x20, 0x2a, 0x2f, 0xa, 0x20, 0x20, 0x70, 
-	0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 0x3b, 
-	0xa, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 
-	0x3a, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x4b, 0x65, 0x65, 
-	0x70, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6c, 0x69, 0x73, 
-	0x74, 0xe2, 0x80, 0x99, 0x73, 0x20, 0x69, 0x74, 0x65, 0x6d, 
-	0x73, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x72, 0x6f, 0x77, 
-	0x20, 0x2a, 0x2f, 0xa, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3a, 
-	0x20, 0x30, 0x2e, 0x32, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 
-	0x20, 0x53, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x20, 0x62, 
-	0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 0x65, 0x61, 0x63, 
-	0x68, 0x20, 0x74, 0x61, 0x67, 0x20, 0x2a, 0x2f, 0xa, 0x7d, 
-	0xa, 0xa, 0x75, 0x6c, 0x2e, 0x61, 0x70, 0x70, 0x2d, 0x74, 
-	0x61, 0x67, 0x73, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x6c, 0x69, 
-	0x73, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x74, 
-	0x79, 0x70, 0x65, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 
-	0xa, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 
-	0x3a, 0x20, 0x30, 0x3b, 0xa, 0x20, 0x20, 0x6d, 0x61, 0x72, 
-	0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x30, 
-	0x3b, 0xa, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 
-	0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x30, 
-	0x3b, 0xa, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 
-	0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x20, 0x30, 0x72, 0x65, 
-	0x6d, 0x3b, 0xa, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 
-	0x6e, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x30, 
-	0x2e, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x64, 
-	0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x66, 0x6c, 
-	0x65, 0x78, 0x3b, 0xa, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3a, 
-	0x20, 0x30, 0x2e, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x7d, 
-	0xa, 0xa, 0x75, 0x6c, 0x2e, 0x61, 0x70, 0x70, 0x2d, 0x74, 
-	0x61, 0x67, 0x73, 0x20, 0x6c, 0x69, 0x20, 0x7b, 0xa, 0x20, 
-	0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 
-	0x64, 0x3a, 0x20, 0x23, 0x44, 0x30, 0x44, 0x30, 0x44, 0x30, 
-	0x3b, 0xa, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 
-	0x20, 0x23, 0x33, 0x33, 0x33, 0x3b, 0xa, 0x20, 0x20, 0x70, 
-	0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 0x2e, 
-	0x32, 0x35, 0x72, 0x65, 0x6d, 0x20, 0x30, 0x2e, 0x32, 0x35, 
-	0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x62, 0x6f, 0x72, 
-	0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 
-	0x3a, 0x20, 0x34, 0x70, 0x78, 0x3b, 0xa, 0x20, 0x20, 0x66, 
-	0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 
-	0x30, 0x2e, 0x37, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x7d, 0xa, 
-	0xa, 0x75, 0x6c, 0x2e, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 
-	0x2d, 0x74, 0x61, 0x67, 0x73, 0x20, 0x7b, 0xa, 0x20, 0x20, 
-	0x6c, 0x69, 0x73, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 
-	0x2d, 0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 
-	0x65, 0x3b, 0xa, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 
-	0x6e, 0x67, 0x3a, 0x20, 0x30, 0x3b, 0xa, 0x20, 0x20, 0x6d, 
-	0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 
-	0x20, 0x30, 0x3b, 0xa, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 
-	0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 
-	0x20, 0x30, 0x3b, 0xa, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 
-	0x69, 0x6e, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x20, 0x30, 
-	0x2e, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x6d, 
-	0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x72, 0x69, 0x67, 0x68, 
-	0x74, 0x3a, 0x20, 0x31, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 
-	0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 
-	0x66, 0x6c, 0x65, 0x78, 0x3b, 0xa, 0x20, 0x20, 0x67, 0x61, 
-	0x70, 0x3a, 0x20, 0x30, 0x2e, 0x35, 0x72, 0x65, 0x6d, 0x3b, 
-	0xa, 0x7d, 0xa, 0xa, 0x75, 0x6c, 0x2e, 0x64, 0x65, 0x76, 
-	0x69, 0x63, 0x65, 0x2d, 0x74, 0x61, 0x67, 0x73, 0x20, 0x6c, 
-	0x69, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 
-	0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 0x65, 
-	0x35, 0x37, 0x33, 0x37, 0x33, 0x3b, 0xa, 0x20, 0x20, 0x63, 
-	0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x77, 0x68, 0x69, 0x74, 
-	0x65, 0x3b, 0xa, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 
-	0x6e, 0x67, 0x3a, 0x20, 0x30, 0x2e, 0x32, 0x35, 0x72, 0x65, 
-	0x6d, 0x20, 0x30, 0x2e, 0x32, 0x35, 0x72, 0x65, 0x6d, 0x3b, 
-	0xa, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 
-	0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x34, 0x70, 
-	0x78, 0x3b, 0xa, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 
-	0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x30, 0x2e, 0x37, 0x72, 
-	0x65, 0x6d, 0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2f, 0x2a, 0x20, 
-	0x52, 0x69, 0x67, 0x68, 0x74, 0x2d, 0x68, 0x61, 0x6e, 0x64, 
-	0x20, 0x73, 0x69, 0x64, 0x65, 0x3a, 0x20, 0x42, 0x75, 0x74, 
-	0x74, 0x6f, 0x6e, 0x73, 0x20, 0x2a, 0x2f, 0xa, 0x2e, 0x61, 
-	0x70, 0x70, 0x2d, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
-	0x20, 0x7b, 0xa, 0x20, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x3a, 
-	0x20, 0x30, 0x20, 0x30, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 
-	0x20, 0x2f, 0x2a, 0x20, 0x46, 0x69, 0x78, 0x65, 0x64, 0x20, 
-	0x73, 0x69, 0x7a, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x62, 
-	0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x63, 0x6f, 0x6e, 0x74, 
-	0x61, 0x69, 0x6e, 0x65, 0x72, 0x20, 0x2a, 0x2f, 0xa, 0x20, 
-	0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 
-	0x66, 0x6c, 0x65, 0x78, 0x3b, 0xa, 0x20, 0x20, 0x66, 0x6c, 
-	0x65, 0x78, 0x2d, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 
-	0x6f, 0x6e, 0x3a, 0x20, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 
-	0x3b, 0x20, 0x2f, 0x2a, 0x20, 0x53, 0x74, 0x61, 0x63, 0x6b, 
-	0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x73, 0x20, 0x76, 
-	0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x6c, 0x79, 0x20, 
-	0x2a, 0x2f, 0xa, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3a, 0x20, 
-	0x30, 0x2e, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 
-	0x6a, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2d, 0x63, 0x6f, 
-	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x20, 0x63, 0x65, 0x6e, 
-	0x74, 0x65, 0x72, 0x3b, 0x20, 0x2f, 0x2a, 0x20, 0x6f, 0x72, 
-	0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x2c, 0x20, 0x73, 
-	0x70, 0x61, 0x63, 0x65, 0x2d, 0x62, 0x65, 0x74, 0x77, 0x65, 
-	0x65, 0x6e, 0x2c, 0x20, 0x65, 0x74, 0x63, 0x2e, 0x20, 0x2a, 
-	0x2f, 0xa, 0x20, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 
-	0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a, 0x20, 0x66, 0x6c, 0x65, 
-	0x78, 0x2d, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3b, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x68, 0x6f, 0x77, 0x20, 
-	0x74, 0x6f, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x20, 0x68, 
-	0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x6c, 
-	0x79, 0x20, 0x2a, 0x2f, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x61, 
-	0x70, 0x70, 0x2d, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
-	0x20, 0x2e, 0x70, 0x75, 0x72, 0x65, 0x2d, 0x62, 0x75, 0x74, 
-	0x74, 0x6f, 0x6e, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x77, 0x69, 
-	0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3b, 
-	0xa, 0x7d, 0xa, 0xa, 0x2e, 0x61, 0x70, 0x70, 0x2d, 0x61, 
-	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x2e, 0x62, 0x75, 
-	0x74, 0x74, 0x6f, 0x6e, 0x2d, 0x64, 0x65, 0x6c, 0x65, 0x74, 
-	0x65, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 
-	0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 
-	0x6f, 0x72, 0x3a, 0x20, 0x23, 0x65, 0x35, 0x37, 0x33, 0x37, 
-	0x33, 0x3b, 0xa, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 
-	0x3a, 0x20, 0x77, 0x68, 0x69, 0x74, 0x65, 0x3b, 0xa, 0x7d, 
-	0xa, 0xa, 0x2e, 0x61, 0x70, 0x70, 0x2d, 0x61, 0x63, 0x74, 
-	0x69, 0x6f, 0x6e, 0x73, 0x20, 0x2e, 0x62, 0x75, 0x74, 0x74, 
-	0x6f, 0x6e, 0x2d, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x3a, 
-	0x68, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x7b, 0xa, 0x20, 0x20, 
-	0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 
-	0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x63, 
-	0x36, 0x32, 0x38, 0x32, 0x38, 0x3b, 0xa, 0x7d, 0xa, 0xa, 
-	0x5b, 0x78, 0x2d, 0x63, 0x6c, 0x6f, 0x61, 0x6b, 0x5d, 0x20, 
-	0x7b, 0x20, 0xa, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 
-	0x61, 0x79, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x20, 0x21, 
-	0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x61, 0x6e, 0x74, 0x3b, 
-	0x20, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x6d, 0x6f, 0x64, 0x61, 
-	0x6c, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x70, 0x6f, 0x73, 0x69, 
-	0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x66, 0x69, 0x78, 0x65, 
-	0x64, 0x3b, 0xa, 0x20, 0x20, 0x74, 0x6f, 0x70, 0x3a, 0x20, 
-	0x30, 0x3b, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x20, 0x30, 
-	0x3b, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x30, 
-	0x3b, 0x20, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 
-	0x30, 0x3b, 0xa, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 
-	0x61, 0x79, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0xa, 
-	0x20, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74, 
-	0x65, 0x6d, 0x73, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 
-	0x72, 0x3b, 0xa, 0x20, 0x20, 0x6a, 0x75, 0x73, 0x74, 0x69, 
-	0x66, 0x79, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 
-	0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0xa, 
-	0x20, 0x20, 0x7a, 0x2d, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x3a, 
-	0x20, 0x39, 0x39, 0x39, 0x3b, 0x20, 0x2f, 0x2a, 0x20, 0x41, 
-	0x62, 0x6f, 0x76, 0x65, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 
-	0x74, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x6c, 0x73, 0x65, 
-	0x20, 0x2a, 0x2f, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x6d, 0x6f, 
-	0x64, 0x61, 0x6c, 0x5b, 0x78, 0x2d, 0x73, 0x68, 0x6f, 0x77, 
-	0x3d, 0x22, 0x73, 0x68, 0x6f, 0x77, 0x44, 0x65, 0x6c, 0x65, 
-	0x74, 0x65, 0x4d, 0x6f, 0x64, 0x61, 0x6c, 0x22, 0x5d, 0x20, 
-	0x7b, 0xa, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 
-	0x79, 0x3a, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0xa, 0x7d, 
-	0xa, 0x2e, 0x6d, 0x6f, 0x64, 0x61, 0x6c, 0x5b, 0x78, 0x2d, 
-	0x73, 0x68, 0x6f, 0x77, 0x3d, 0x22, 0x73, 0x68, 0x6f, 0x77, 
-	0x4c, 0x61, 0x75, 0x6e, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x61, 
-	0x6c, 0x22, 0x5d, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x64, 0x69, 
-	0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x66, 0x6c, 0x65, 
-	0x78, 0x3b, 0xa, 0x7d, 0xa, 0x2e, 0x6d, 0x6f, 0x64, 0x61, 
-	0x6c, 0x5b, 0x78, 0x2d, 0x73, 0x68, 0x6f, 0x77, 0x3d, 0x22, 
-	0x73, 0x68, 0x6f, 0x77, 0x49, 0x6e, 0x66, 0x6f, 0x4d, 0x6f, 
-	0x64, 0x61, 0x6c, 0x22, 0x5d, 0x20, 0x7b, 0xa, 0x20, 0x20, 
-	0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x66, 
-	0x6c, 0x65, 0x78, 0x3b, 0xa, 0x7d, 0xa, 0x2e, 0x6d, 0x6f, 
-	0x64, 0x61, 0x6c, 0x5b, 0x78, 0x2d, 0x73, 0x68, 0x6f, 0x77, 
-	0x3d, 0x22, 0x73, 0x68, 0x6f, 0x77, 0x45, 0x72, 0x72, 0x6f, 
-	0x72, 0x4d, 0x6f, 0x64, 0x61, 0x6c, 0x22, 0x5d, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 
-	0x3a, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0xa, 0x7d, 0xa, 
-	0x2e, 0x6d, 0x6f, 0x64, 0x61, 0x6c, 0x5b, 0x78, 0x2d, 0x73, 
-	0x68, 0x6f, 0x77, 0x3d, 0x22, 0x73, 0x68, 0x6f, 0x77, 0x43, 
-	0x6f, 0x6e, 0x66, 0x69, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 
-	0x6e, 0x4d, 0x6f, 0x64, 0x61, 0x6c, 0x22, 0x5d, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 
-	0x3a, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0xa, 0x7d, 0xa, 
-	0xa, 0x2e, 0x6d, 0x6f, 0x64, 0x61, 0x6c, 0x2d, 0x6f, 0x76, 
-	0x65, 0x72, 0x6c, 0x61, 0x79, 0x20, 0x7b, 0xa, 0x20, 0x20, 
-	0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 
-	0x66, 0x69, 0x78, 0x65, 0x64, 0x3b, 0xa, 0x20, 0x20, 0x74, 
-	0x6f, 0x70, 0x3a, 0x20, 0x30, 0x3b, 0xa, 0x20, 0x20, 0x6c, 
-	0x65, 0x66, 0x74, 0x3a, 0x20, 0x30, 0x3b, 0xa, 0x20, 0x20, 
-	0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x30, 0x30, 
-	0x25, 0x3b, 0xa, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
-	0x74, 0x3a, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3b, 0xa, 0x20, 
-	0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 
-	0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x72, 
-	0x67, 0x62, 0x61, 0x28, 0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20, 
-	0x30, 0x2c, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x3b, 0xa, 0x20, 
-	0x20, 0x7a, 0x2d, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x3a, 0x20, 
-	0x31, 0x30, 0x30, 0x30, 0x3b, 0xa, 0x7d, 0xa, 0x2e, 0x6d, 
-	0x6f, 0x64, 0x61, 0x6c, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x65, 
-	0x6e, 0x74, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x70, 0x6f, 0x73, 
-	0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x66, 0x69, 0x78, 
-	0x65, 0x64, 0x3b, 0xa, 0x20, 0x20, 0x74, 0x6f, 0x70, 0x3a, 
-	0x20, 0x35, 0x30, 0x25, 0x3b, 0xa, 0x20, 0x20, 0x6c, 0x65, 
-	0x66, 0x74, 0x3a, 0x20, 0x35, 0x30, 0x25, 0x3b, 0xa, 0x20, 
-	0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 
-	0x3a, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x6c, 0x61, 0x74, 
-	0x65, 0x28, 0x2d, 0x35, 0x30, 0x25, 0x2c, 0x20, 0x2d, 0x35, 
-	0x30, 0x25, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x62, 0x61, 0x63, 
-	0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 
-	0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3b, 
-	0xa, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 
-	0x3a, 0x20, 0x32, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 
-	0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 
-	0x69, 0x75, 0x73, 0x3a, 0x20, 0x38, 0x70, 0x78, 0x3b, 0xa, 
-	0x20, 0x20, 0x62, 0x6f, 0x78, 0x2d, 0x73, 0x68, 0x61, 0x64, 
-	0x6f, 0x77, 0x3a, 0x20, 0x30, 0x20, 0x32, 0x70, 0x78, 0x20, 
-	0x31, 0x30, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 
-	0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 
-	0x2e, 0x31, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x7a, 0x2d, 0x69, 
-	0x6e, 0x64, 0x65, 0x78, 0x3a, 0x20, 0x31, 0x30, 0x30, 0x31, 
-	0x3b, 0xa, 0x20, 0x20, 0x6d, 0x61, 0x78, 0x2d, 0x77, 0x69, 
-	0x64, 0x74, 0x68, 0x3a, 0x20, 0x39, 0x30, 0x25, 0x3b, 0xa, 
-	0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x34, 
-	0x30, 0x30, 0x70, 0x78, 0x3b, 0xa, 0x7d, 0xa, 0x2e, 0x6d, 
-	0x6f, 0x64, 0x61, 0x6c, 0x2d, 0x62, 0x75, 0x74, 0x74, 0x6f, 
-	0x6e, 0x73, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x6d, 0x61, 0x72, 
-	0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x31, 
-	0x2e, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x20, 0x20, 0x74, 
-	0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 
-	0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3b, 0xa, 0x7d, 0xa, 
-	0xa, 0x2e, 0x6d, 0x6f, 0x64, 0x61, 0x6c, 0x2d, 0x62, 0x75, 
-	0x74, 0x74, 0x6f, 0x6e, 0x73, 0x20, 0x2e, 0x70, 0x75, 0x72, 
-	0x65, 0x2d, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x2b, 
-	0x20, 0x2e, 0x70, 0x75, 0x72, 0x65, 0x2d, 0x62, 0x75, 0x74, 
-	0x74, 0x6f, 0x6e, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x6d, 0x61, 
-	0x72, 0x67, 0x69, 0x6e, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 
-	0x20, 0x30, 0x2e, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0xa, 0x7d, 
-	0xa, 0xa, 0x2f, 0x2a, 0x20, 0x4d, 0x6f, 0x64, 0x61, 0x6c, 
-	0x20, 0x49, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 
-	0x6f, 0x6e, 0x20, 0x49, 0x63, 0x6f, 0x6e, 0x20, 0x2a, 0x2f, 
-	0xa, 0x2e, 0x6d, 0x6f, 0x64, 0x61, 0x6c, 0x2d, 0x69, 0x6e, 
-	0x66, 0x6f, 0x2d, 0x69, 0x63, 0x6f, 0x6e, 0x20, 0x7b, 0xa, 
-	0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 
-	0x30, 0x30, 0x37, 0x38, 0x65, 0x37, 0x3b, 0x20, 0x2f, 0x2a, 
-	0x20, 0x42, 0x6c, 0x75, 0x65, 0x20, 0x74, 0x6f, 0x6e, 0x65, 
-	0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x20, 
-	0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x69, 
-	0x6e, 0x67, 0x20, 0x69, 0x63, 0x6f, 0x6e, 0x73, 0x20, 0x2a, 
-	0x2f, 0xa, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 
-	0x69, 0x7a, 0x65, 0x3a, 0x20, 0x32, 0x72, 0x65, 0x6d, 0x3b, 
-	0x20, 0x2f, 0x2a, 0x20, 0x4c, 0x61, 0x72, 0x67, 0x65, 0x72, 
-	0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 
-	0x65, 0x6d, 0x70, 0x68, 0x61, 0x73, 0x69, 0x73, 0x20, 0x2a, 
-	0x2f, 0xa, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 
-	0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x31, 0x72, 
-	0x65, 0x6d, 0x3b, 0x20, 0x2f, 0x2a, 0x20, 0x53, 0x70, 0x61, 
-	0x63, 0x65, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 
-	0x20, 0x69, 0x63, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 
-	0x74, 0x65, 0x78, 0x74, 0x20, 0x2a, 0x2f, 0xa, 0x7d, 0xa, 
-	0xa, 0x2f, 0x2a, 0x20, 0x4d, 0x6f, 0x64, 0x61, 0x6c, 0x20, 
-	0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x49, 0x63, 0x6f, 0x6e, 
-	0x20, 0x2a, 0x2f, 0xa, 0x2e, 0x6d, 0x6f, 0x64, 0x61, 0x6c, 
-	0x2d, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2d, 0x69, 0x63, 0x6f, 
-	0x6e, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 
-	0x72, 0x3a, 0x20, 0x23, 0x62, 0x39, 0x31, 0x63, 0x31, 0x63, 
-	0x3b, 0x20, 0x2f, 0x2a, 0x20, 0x52, 0x65, 0x64, 0x20, 0x74, 
-	0x6f, 0x6e, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x69, 
-	0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 0x69, 
-	0x73, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x72, 0x72, 0x6f, 
-	0x72, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x20, 0x2a, 0x2f, 
-	0xa, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 
-	0x7a, 0x65, 0x3a, 0x20, 0x32, 0x72, 0x65, 0x6d, 0x3b, 0x20, 
-	0x2f, 0x2a, 0x20, 0x4c, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 
-	0x73, 0x69, 0x7a, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 
-	0x6d, 0x70, 0x68, 0x61, 0x73, 0x69, 0x73, 0x20, 0x2a, 0x2f, 
-	0xa, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 
-	0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x31, 0x72, 0x65, 
-	0x6d, 0x3b, 0x20, 0x2f, 0x2a, 0x20, 0x53, 0x70, 0x61, 0x63, 
-	0x65, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 
-	0x69, 0x63, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 
-	0x65, 0x78, 0x74, 0x20, 0x2a, 0x2f, 0xa, 0x7d, 0xa, 0xa, 
-	0x2f, 0x2a, 0x20, 0x53, 0x70, 0x69, 0x6e, 0x6e, 0x65, 0x72, 
-	0x20, 0x53, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x20, 0x2a, 0x2f, 
-	0xa, 0x2e, 0x73, 0x70, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x20, 
-	0x7b, 0xa, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 
-	0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 0x36, 0x70, 0x78, 0x3b, 
-	0xa, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 
-	0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x62, 0x6f, 0x6c, 0x64, 
-	0x3b, 0xa, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 
-	0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 
-	0x65, 0x72, 0x3b, 0xa, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 
-	0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x31, 0x30, 
-	0x70, 0x78, 0x3b, 0xa, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 
-	0x6c, 0x61, 0x79, 0x3a, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 
-	0x3b, 0xa, 0x7d, 0xa, 0xa, 0x2f, 0x2a, 0x20, 0x54, 0x61, 
-	0x62, 0x6c, 0x65, 0x20, 0x72, 0x6f, 0x77, 0x20, 0x68, 0x6f, 
-	0x76, 0x65, 0x72, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 
-	0x20, 0x2a, 0x2f, 0xa, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x2e, 
-	0x70, 0x75, 0x72, 0x65, 0x2d, 0x74, 0x61, 0x62, 0x6c, 0x65, 
-	0x2e, 0x70, 0x75, 0x72, 0x65, 0x2d, 0x74, 0x61, 0x62, 0x6c, 
-	0x65, 0x2d, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x65, 0x64, 
-	0x20, 0x74, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x74, 0x72, 0x3a, 
-	0x68, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x7b, 0xa, 0x20, 0x20, 
-	0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 
-	0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x65, 
-	0x30, 0x66, 0x30, 0x66, 0x66, 0x3b, 0x20, 0x2f, 0x2a, 0x20, 
-	0x4c, 0x69, 0x67, 0x68, 0x74, 0x20, 0x62, 0x6c, 0x75, 0x65, 
-	0x20, 0x6f, 0x6e, 0x20, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x20, 
-	0x2a, 0x2f, 0xa, 0x7d, 0xa, 0xa, 0x2e, 0x70, 0x75, 0x72, 
-	0x65, 0x2d, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x2d, 0x77, 
-	0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x7b, 0xa, 0x20, 
-	0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 
-	0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 
-	0x65, 0x35, 0x37, 0x33, 0x37, 0x33, 0x3b, 0x20, 0x2f, 0x2a, 
-	0x20, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x20, 0x72, 0x65, 0x64, 
-	0x20, 0x2a, 0x2f, 0xa, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 
-	0x72, 0x3a, 0x20, 0x77, 0x68, 0x69, 0x74, 0x65, 0x3b, 0xa, 
-	0x7d, 0xa, 0xa, 0x2e, 0x70, 0x75, 0x72, 0x65, 0x2d, 0x62, 
-	0x75, 0x74, 0x74, 0x6f, 0x6e, 0x2d, 0x77, 0x61, 0x72, 0x6e, 
-	0x69, 0x6e, 0x67, 0x3a, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x20, 
-	0x7b, 0xa, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 
-	0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 
-	0x3a, 0x20, 0x23, 0x63, 0x36, 0x32, 0x38, 0x32, 0x38, 0x3b, 
-	0x20, 0x2f, 0x2a, 0x20, 0x44, 0x61, 0x72, 0x6b, 0x20, 0x72, 
-	0x65, 0x64, 0x20, 0x2a, 0x2f, 0xa, 0x7d, 0xa, };
-
-static const unsigned char data_error_shtml[] = {
-	/* /error.shtml */
-	0x2f, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2e, 0x73, 0x68, 0x74, 0x6d, 0x6c, 0,
-	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x20, 0x32, 
-	0x30, 0x30, 0x20, 0x4f, 0x4b, 0xd, 0xa, 0x53, 0x65, 0x72, 
-	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
-	0x70, 0x72, 0x65, 0x2d, 0x30, 0x2e, 0x36, 0x20, 0x28, 0x68, 
+	0x2f, 0x63, 0x73, 0x73, 0xd, 0xa, 0x43, 0x6f, 0x6e, 0x74, 
+	0x65, 0x6e, 0x74, 0x2d, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x69, 
+	0x6e, 0x67, 0x3a, 0x20, 0x67, 0x7a, 0x69, 0x70, 0xd, 0xa, 
+	0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x4c, 0x65, 
+	0x6e, 0x67, 0x74, 0x68, 0x3a, 0x20, 0x34, 0x32, 0x32, 0x34, 
+	0xd, 0xa, 0xd, 0xa, 0x1f, 0x8b, 0x8, 00, 00, 00, 
+	00, 00, 0x2, 0x3, 0xdd, 0x3b, 0xed, 0x6e, 0xe4, 0xc6, 
+	0x91, 0xff, 0xf7, 0x29, 0xfa, 0xd6, 0xf0, 0x49, 0xb2, 0xc5, 
+	0x11, 0xc9, 0xf9, 0x94, 0x94, 0xd, 0x62, 0xaf, 0xed, 0xd8, 
+	0xb8, 0xdd, 0xc0, 0xf0, 0x2e, 0x12, 0x1c, 0x82, 00, 0xee, 
+	0x21, 0x9b, 0x43, 0x5a, 0x1c, 0x92, 0x68, 0x92, 0x1a, 0x8d, 
+	0x85, 0xd, 0xf2, 0x1a, 0x79, 0xbd, 0x7b, 0x92, 0x54, 0xf5, 
+	0x7, 0xd9, 0xdd, 0x24, 0x67, 0xa5, 0x4d, 0xe, 0x87, 0x8b, 
+	0xb4, 0x9a, 0x9d, 0x69, 0x76, 0x57, 0x57, 0x55, 0xd7, 0x77, 
+	0xf5, 0x5c, 0x7d, 0x41, 0xbc, 0xee, 0x87, 0xfc, 0x3e, 0x2f, 
+	0xb7, 0x34, 0x27, 0x3f, 0xb1, 0x9a, 0x35, 0xe4, 0x8a, 0x7c, 
+	0x4d, 0xeb, 0x2c, 0x22, 0x3f, 0xd2, 0x1d, 0x23, 0xef, 0x9a, 
+	0x63, 0x9e, 0x15, 0x3b, 0x73, 0xf2, 0x17, 0x57, 0x2f, 0xd2, 
+	0x66, 0x9f, 0x5f, 0x92, 0x6d, 0x19, 0x1f, 0xc9, 0xe3, 0xb, 
+	0x2, 0x3f, 0x29, 0xcb, 0x76, 0x69, 0x73, 0x43, 0x2, 0xdf, 
+	0xff, 0xfc, 0x56, 0x8c, 0xec, 0x29, 0xdf, 0x65, 0xc5, 0xd, 
+	0xf1, 0xe5, 0xc7, 0x8a, 0xc6, 0x31, 0xc0, 0x51, 0x9f, 0x3f, 
+	0xc0, 0x1f, 0xfc, 0x33, 00, 0xc4, 0x59, 0x5d, 0xe5, 0xf4, 
+	0x78, 0x43, 0x92, 0x9c, 0x3d, 0xc8, 0x25, 0xf8, 0xce, 0x8b, 
+	0x33, 0xce, 0xa2, 0x26, 0x2b, 0x1, 0x52, 0x54, 0xe6, 0xed, 
+	0xbe, 0x90, 0xcf, 0xb6, 0x34, 0xba, 0xdb, 0xf1, 0xb2, 0x2d, 
+	0xe2, 0x1b, 0xf2, 0x59, 0xb2, 0x80, 0xdf, 0x6b, 0xf9, 00, 
+	0x26, 0x95, 0x1c, 0xc6, 0xe6, 0xf3, 0xb9, 0x82, 0x52, 0x16, 
+	0x8d, 0x97, 0xd0, 0x7d, 0x96, 0x3, 0xf0, 0xaf, 0x78, 0x46, 
+	0x1, 0xf1, 0x9a, 0x16, 0xb5, 0x57, 0x33, 0x9e, 0x25, 0x6, 
+	0x32, 0x57, 0x5f, 0x90, 0xb7, 0x34, 0x2b, 00, 0x42, 0xd1, 
+	0xc0, 0xff, 0x8c, 0x93, 0x92, 0x8b, 0xf, 0xac, 0x68, 0x8, 
+	0xe5, 0x8c, 0x92, 0x26, 0xa5, 0xd, 0x89, 0x68, 0x41, 0x60, 
+	0xe7, 0xc3, 0x55, 0x9d, 0xf2, 0xac, 0xb8, 0x43, 0x6e, 0x10, 
+	0x32, 0xdb, 0xc3, 0xa, 0x4f, 0x4f, 0x7e, 0xec, 0xd0, 0x7, 
+	0x86, 0xdc, 0xbe, 00, 0xc0, 0xf0, 0x73, 0xc8, 0xe2, 0x26, 
+	0x55, 0xc, 0x92, 0x8b, 0x90, 0x47, 0xf, 0x9e, 0x1a, 0xdf, 
+	0xf8, 0x7e, 0xf5, 0xe0, 0x70, 0x8e, 0xd0, 0xb6, 0x29, 0x1d, 
+	0xf6, 0x5, 0x9c, 0xed, 0x25, 0xd2, 0xee, 0xb6, 0x5e, 0xd2, 
+	0xe6, 0xb9, 0x4, 0xe7, 0x62, 0xe0, 0xee, 0xff, 0x2f, 0xd8, 
+	0xbc, 0xe3, 0x99, 0x21, 0x18, 0xdf, 0x33, 0x1a, 0x3, 0xdb, 
+	0xce, 0xbf, 0xce, 0x5b, 0x6, 0x32, 0x54, 00, 0xf, 0x2f, 
+	0x1c, 0xc1, 0x1, 0x9c, 0x53, 0x39, 0xeb, 0xd1, 0x39, 0x47, 
+	0x4f, 0x9f, 0x9c, 0xef, 0xaf, 0x37, 0x6c, 0x6d, 0x9f, 0x66, 
+	0x92, 0x24, 0x2e, 0x2a, 0x12, 0x13, 0x42, 0x1a, 0xf6, 0xd0, 
+	0x78, 0x34, 0xcf, 0x76, 0x28, 0x21, 0xc0, 0x6, 0xc6, 0x47, 
+	0xe9, 0xfd, 0x30, 0x86, 0xf0, 0x1f, 0xe8, 0x7d, 0xb6, 0xa3, 
+	0x28, 0x5d, 0x80, 0x2e, 0x1f, 0xa2, 0x5a, 0xd0, 0x7b, 0x6f, 
+	0x4b, 0x87, 0xb8, 0x9a, 0x18, 0x6d, 0xcb, 0x7, 0xaf, 0x4e, 
+	0x69, 0x5c, 0x1e, 0x90, 0x69, 0x61, 0xf5, 0x40, 0x16, 0xf0, 
+	0xc7, 0x77, 0x5b, 0x7a, 0xee, 0x5f, 0x8a, 0xdf, 0x59, 0x70, 
+	0x61, 0xf2, 0xd6, 0xdb, 0x96, 0x4d, 0x53, 0xee, 0xd, 0x12, 
+	0xd4, 0x78, 0xce, 0x12, 0xd0, 0xa0, 0x9e, 0xed, 0x6a, 0x98, 
+	0x4b, 0xcd, 0xea, 0xc7, 0x9f, 0x74, 0x92, 0x52, 0x3e, 0x90, 
+	0x80, 0x3c, 0xab, 0x9b, 0x69, 0x25, 0x13, 0x9c, 0xf3, 0xb2, 
+	0x86, 0xed, 0x6b, 0x9b, 0x7f, 0x3b, 0x5a, 0x1, 0x41, 0xb3, 
+	0x25, 0xd7, 0x58, 0x22, 0x1c, 0xaf, 0x6, 0x73, 0xc0, 0x6e, 
+	0x48, 0x51, 0x16, 0xec, 0x23, 0x6a, 0x2e, 0x56, 0x1a, 0x12, 
+	0x23, 0xd8, 0x2f, 0x10, 0xc2, 0xcd, 0x14, 0x42, 0xd6, 0x6a, 
+	0x73, 0x4e, 0x8e, 0xaa, 0xe5, 0x20, 0xbd, 0xcd, 0xcb, 0xe8, 
+	0x6e, 0x7c, 0x1b, 0x7f, 0xb6, 0xee, 0x11, 0x15, 0x12, 0x11, 
+	0xb3, 0xa8, 0xe4, 0x54, 0x1a, 0x8e, 0x1e, 0xdb, 0x81, 0x75, 
+	0xd8, 0x96, 0x1c, 0x84, 0xd1, 0xe3, 0x34, 0xce, 0x5a, 0x60, 
+	0xc0, 0x4a, 0xab, 0x81, 0xb0, 0x1a, 0x7, 0x65, 0xd4, 0x56, 
+	0xfe, 0x28, 0x7e, 0x37, 0x69, 0x79, 0xcf, 0xf8, 0xa5, 0x35, 
+	0x94, 0x94, 0x51, 0x5b, 0x8f, 0xc9, 0xb, 0x63, 0x60, 0xa3, 
+	0x12, 0x1b, 0x8b, 0x5e, 0xd2, 0x5d, 0xf6, 0xcc, 0x28, 0xd8, 
+	0xbc, 0x7b, 0x36, 0xe0, 0x85, 0x5, 0xf2, 0x84, 0xa2, 0x98, 
+	0xf0, 0x50, 0x80, 0x67, 0x55, 0xcb, 0x99, 0xb7, 0x67, 0x45, 
+	0x6b, 0x42, 0x73, 0xb8, 0xd1, 0xab, 0xc8, 0x57, 0x62, 0xf7, 
+	0x2b, 0x41, 0x1f, 0xa9, 0x1b, 0xda, 0xb0, 0xda, 0xd1, 0x8, 
+	0x3, 0x60, 0xcd, 0x72, 0xb0, 0xd0, 0x2c, 0x76, 0x37, 0xb9, 
+	0x3c, 0x81, 0x80, 0x64, 0xdd, 0xa7, 0x11, 0x65, 0xab, 0x30, 
+	0xb8, 0xac, 0xaa, 0x2c, 0x6a, 0x64, 0xd6, 0x5b, 0x80, 0x4e, 
+	0xce, 0x7f, 0x84, 0x8d, 0x86, 0x56, 0xe7, 0x77, 0x7b, 0x16, 
+	0x67, 0x94, 0x9c, 0x1b, 0xaa, 0xb2, 0x42, 0x55, 0xb9, 0x50, 
+	0x38, 0xb8, 0x9a, 0x72, 0xda, 0xfb, 0x38, 0x6a, 0x23, 0xa6, 
+	0x2, 0x9b, 0x78, 0x23, 0x1f, 0x7f, 0x30, 0x41, 0x76, 0xdc, 
+	0x1e, 0x51, 0xdc, 0xf, 0x53, 0x54, 0x9, 0x47, 0xf4, 0x5a, 
+	0xb9, 0x93, 0xd7, 0x9d, 0x43, 0x1a, 0x18, 0x28, 0xdb, 0xe3, 
+	0x7c, 0x9a, 0x1d, 0xb9, 0x3e, 0xed, 0x10, 0x9e, 0x62, 0xf5, 
+	0x7c, 0xa0, 0x69, 0xca, 0xe8, 0x39, 0x1a, 0xb6, 0xd1, 0x70, 
+	0x5d, 0x4b, 0x3e, 0xca, 0x87, 0xef, 0xca, 0xb2, 0x19, 0xa3, 
+	0x3b, 0x91, 0xe3, 0x8f, 0x27, 0x3d, 0x80, 0xd0, 0xe1, 0x3a, 
+	0xfb, 0x15, 0xec, 0x55, 0xb0, 0xd0, 0xdb, 0x6a, 0x99, 0x5a, 
+	0xaf, 0xd7, 0x53, 0x1e, 0x45, 0xf1, 0xab, 0x29, 0x2b, 0xc5, 
+	0x2d, 0x44, 0xaa, 0x6a, 0xeb, 0x94, 0xa8, 0x6d, 0x81, 0xea, 
+	0x82, 0x64, 0x49, 0x17, 0x1c, 0x64, 0x35, 0xa9, 0xd3, 0x92, 
+	0x37, 0xda, 0xad, 0x3f, 0xcb, 0xd5, 0x3e, 0xf1, 0xb8, 0x46, 
+	0xd9, 0xf3, 0xee, 0x58, 0xa3, 0x2d, 0x7d, 0x27, 0x65, 0x74, 
+	0xc8, 0xa6, 0x5a, 0x3c, 0x7, 0xd, 0x95, 0xcf, 0xff, 0x5f, 
+	0x4b, 0x89, 0xe3, 0x48, 0x1c, 0xd2, 0xd2, 0xd0, 0xa6, 0x4e, 
+	0x1c, 0x9e, 0x3f, 0x8c, 0x10, 0x90, 0xea, 0x8f, 0x18, 0x61, 
+	0x60, 0xf1, 0x4f, 0x6c, 0xf, 0xf6, 0x89, 0xc4, 0x2c, 0xa1, 
+	0x6d, 0xde, 0x8, 0xcf, 0x47, 0x6a, 0x15, 0x8, 0x5b, 0x9c, 
+	0x35, 0x2c, 0x46, 0xef, 0x1e, 0xbd, 0xe6, 0x58, 0x59, 0x3e, 
+	0x52, 0x11, 0xa1, 0x58, 0xee, 0xdf, 0x4e, 0xba, 0x3e, 0xd8, 
+	0x5a, 0x3c, 0xfb, 0x96, 0x46, 0x69, 0xb7, 0x7, 0x1a, 0x99, 
+	0x1b, 0x31, 0xec, 0x91, 0xf7, 0xf4, 0xe, 0x4c, 0x31, 0x6, 
+	0x7a, 0xf2, 0x5c, 0x8, 0x90, 0x5e, 0xef, 0x69, 0x9e, 0xa3, 
+	0x9d, 0x8e, 0x38, 0x63, 0x45, 0x6d, 0xcd, 0x4c, 0x69, 0x9e, 
+	0xf4, 0x33, 0x7f, 0xae, 0xf7, 0x3f, 0x63, 0x50, 0xfb, 0xf3, 
+	0x3e, 0xfe, 0x99, 0x6c, 0x21, 0xa2, 0xbd, 0xab, 0xca, 0xac, 
+	0x68, 0x6a, 0x72, 0x7e, 0x48, 0xb3, 0x28, 0x65, 0x68, 0x92, 
+	0x8f, 0x65, 0x4b, 0xda, 0x9a, 0x11, 0xb0, 0x3f, 0xdf, 0xbf, 
+	0x7f, 0xfb, 0xe6, 0x2, 0xc0, 0x59, 0x14, 0x1b, 0xce, 0x5b, 
+	0x93, 0x25, 0x79, 0x6d, 0x44, 0xa, 0xfa, 0x81, 0xe, 0x74, 
+	0xcc, 0x67, 0xea, 0xa0, 0xbb, 0x18, 0x8, 0x4, 0xa2, 0x2e, 
+	0xf3, 0x2c, 0x26, 0x9f, 0xc5, 0x71, 0x2c, 0x34, 0xad, 0xac, 
+	0xf0, 0x44, 0x21, 0x1b, 0x89, 0xb3, 0xfb, 0xc, 0x23, 0x45, 
+	0xb1, 0x7f, 0xcf, 0xa1, 0x37, 0x14, 0x70, 0x6c, 0x40, 0x17, 
+	0x39, 0xc9, 0xe9, 0x96, 0xe5, 0xe4, 0x3f, 0xc9, 0x3d, 0xc5, 
+	0x88, 0xf3, 0x90, 0x35, 0x29, 0xa0, 0xcd, 0x90, 0x79, 0x2, 
+	0x4d, 0x89, 0x78, 0x26, 0xd0, 0xc6, 0x60, 0xd4, 0xd, 0x28, 
+	0x76, 0x3c, 0x8b, 0x55, 0xb0, 0x3, 0xef, 0x3c, 0x98, 0x7, 
+	0xe3, 0xd, 0xf3, 0xa4, 0xa9, 0x7, 0x31, 0xc, 0x36, 0x28, 
+	0xb0, 0x41, 0xc2, 0x5, 0x62, 0x72, 0xb7, 0xbf, 0xca, 0xd1, 
+	0x4b, 0xb5, 0x69, 0x92, 0xe5, 0x79, 0x4d, 0x38, 0xab, 0x3b, 
+	0xed, 0x7f, 0x6a, 0x44, 0xd5, 0x53, 0xf4, 0x3, 0x18, 0x12, 
+	0xf2, 0x25, 0x10, 0x86, 0xf0, 0x7b, 0x6b, 0x2f, 0xd1, 0x17, 
+	0xbb, 0x7a, 0x11, 0x83, 0x23, 0xff, 0xa7, 0x83, 0xb8, 0xf, 
+	0xe, 0xc0, 0xcc, 0x9, 0x4, 0x4c, 0xe7, 0x6b, 0x5a, 0xcf, 
+	0x59, 0x38, 0xc0, 0xf9, 0x8f, 0x82, 0x7a, 0x60, 0x37, 0x25, 
+	0xfb, 0xb2, 0x28, 0xeb, 0x8a, 0x46, 0x2c, 0xc6, 0x94, 0x30, 
+	0x8f, 0xc5, 0x52, 0xc4, 0x7e, 0x26, 0x58, 0x64, 0xe2, 0x3e, 
+	0xae, 0x8a, 0x56, 0x8a, 0xf6, 0xf2, 0x75, 0xd9, 0xf2, 0xc, 
+	0xc8, 0xff, 0x3, 0x3b, 0xbc, 0xbc, 0x24, 0xea, 0xd3, 0x65, 
+	0xbf, 0xcb, 0x48, 0x80, 0x86, 0xbb, 0xde, 0xbe, 0x80, 0x90, 
+	0x77, 0x26, 0x36, 0x60, 0x9c, 0x97, 0xdc, 0x26, 0x8d, 0x43, 
+	0x7c, 0x2, 0x58, 0x7f, 0xfb, 0x40, 0xe1, 0x8c, 0x19, 0x91, 
+	0x33, 0x70, 0x10, 0xd0, 0x84, 0x75, 0xb6, 0x59, 0xfd, 0xba, 
+	0x5, 0xe1, 0x2c, 0x40, 0x2d, 0xc0, 0x76, 0xc1, 0x1c, 0x37, 
+	0x9a, 0x98, 0x6d, 0x1b, 0x6d, 0x4b, 0xa5, 0x34, 0x5b, 0x62, 
+	0x6c, 0xf2, 0xf0, 0xa9, 0x91, 0xcd, 0x74, 0x1c, 0x6a, 0x4, 
+	0xba, 0x2b, 0x2b, 0xa0, 0x6, 0x18, 0x2d, 0xaf, 0x11, 0x88, 
+	0xd0, 0xe1, 0x31, 0x9f, 0xd7, 0xcd, 0xb4, 0x78, 0xb5, 0xf6, 
+	0xfd, 0x8f, 0x86, 0xc9, 0x9d, 0x88, 0x65, 0x5, 0xd8, 0x3c, 
+	0xe6, 0x3d, 0x41, 0xd2, 0x7e, 0x69, 0xeb, 0x26, 0x4b, 0x8e, 
+	0x3a, 0x19, 0x1d, 0x15, 0xc3, 0xb9, 0x11, 0xa3, 0x73, 0x48, 
+	0xc1, 0x33, 0xb9, 0x6f, 0x9, 0xa7, 0x9a, 0x35, 0x47, 0x98, 
+	0x10, 0x2c, 0x6b, 0x50, 0xdf, 0x9a, 0x5d, 0xca, 0xe7, 0xa0, 
+	0xe2, 0x7b, 0x6b, 0xb4, 0xf7, 0x27, 0xc6, 0xb0, 0x3c, 0x78, 
+	0x38, 0x13, 0x2b, 0xa8, 0x54, 0x40, 0x71, 0xdb, 0xeb, 0x45, 
+	0x3f, 0x45, 0xc5, 0xd5, 0x8f, 0x3d, 0x12, 0xb8, 0xc9, 0x8d, 
+	0x7c, 0x8b, 0xca, 0xff, 0xdf, 0xe7, 0x70, 0x96, 0x17, 0xfd, 
+	0x2, 0x60, 0x5, 0xdd, 0xe6, 0x20, 0x28, 0x3, 0xb0, 0x2b, 
+	0xfb, 0x18, 0x8a, 0x12, 0x25, 0x3b, 0x2f, 0xf, 0x2c, 0xee, 
+	0x56, 0xa3, 0x7b, 0x2a, 0x8b, 0x98, 0xf2, 0xe3, 0xc9, 0x14, 
+	0xd2, 0x55, 0x3f, 0xbd, 0x3a, 0xa6, 0xc5, 0x6e, 0x3c, 0x4a, 
+	0x86, 0x64, 0x2, 0x7e, 0x2c, 0xd1, 0xd1, 0x40, 0xcc, 0x47, 
+	0x96, 0x98, 0xd, 0xc5, 0xfc, 0x3d, 0xf9, 0x91, 0x66, 0x1c, 
+	0x9d, 0x5a, 0x85, 0xa5, 0x1e, 0x47, 0xca, 0x63, 0x76, 0x9f, 
+	0x45, 0xcc, 0x74, 0x71, 0x27, 0x4b, 0x3a, 0x53, 0x9, 0xe2, 
+	0x33, 0xb, 0x3b, 0x4a, 0x54, 0x54, 0x3a, 0x87, 0x9c, 0x50, 
+	0x78, 0x44, 0x94, 0xc7, 0xb6, 0xe3, 0xe9, 0xe6, 0x19, 0xa2, 
+	0x3e, 0xa2, 0x90, 0x6c, 0xc9, 0xd6, 0x6c, 0x7b, 0x3a, 0xcc, 
+	0x78, 0x6a, 0x6a, 0xbf, 0xea, 0xe3, 0x17, 0xa2, 0xfe, 0xcd, 
+	0xfc, 0xd5, 0xc5, 0xed, 0x73, 0xfd, 0x4a, 0xc2, 0x8d, 0x8, 
+	0xcb, 0x30, 0xd2, 0x6, 0x25, 0xa3, 0x9a, 0x66, 0xf0, 0x63, 
+	0xcf, 0x1a, 0xfa, 0x69, 0xb5, 0x33, 0xb5, 0x5f, 0xe8, 0x72, 
+	0xb8, 0xa0, 0x7b, 0xad, 0x19, 0xe3, 0x16, 0x43, 0x8b, 0x53, 
+	0x10, 0x4, 0x9b, 0x70, 0x6d, 0xad, 0x85, 0x13, 0xe1, 0xe6, 
+	0xda, 0x67, 0x5a, 0xf3, 0x2e, 0x13, 0x5d, 0x2f, 0x82, 0x65, 
+	0x60, 0x41, 0xc6, 0x60, 0x6a, 0x78, 0xee, 0xa1, 0xcc, 0xfa, 
+	0x7, 0x71, 0xc5, 0xc0, 0x80, 0xba, 0x49, 0x78, 0xe8, 0x2a, 
+	0xdd, 0x62, 0x3e, 0xdf, 0x44, 0x74, 0x3a, 0xeb, 0xb7, 0x6c, 
+	0x2a, 0x18, 0x93, 0x7e, 0x4b, 0x6d, 0xf2, 0x20, 0x1, 0x4e, 
+	0x6e, 0x8, 0x2b, 0xe2, 0x1, 0xde, 0x33, 0x7c, 0xf1, 0xee, 
+	0xb6, 0x63, 0x2a, 0x1c, 0x6f, 0x19, 0x4d, 0x1c, 0xf2, 0x83, 
+	0x78, 0xc1, 0xe2, 0xcd, 0x4, 0x98, 0xfd, 0x68, 0x5d, 0x21, 
+	0xe, 0x12, 0xca, 0x96, 0x8e, 0x1d, 0x59, 0xac, 0x37, 0xcb, 
+	0xf5, 0x4, 0x98, 0x5d, 0x35, 0x6e, 0x8b, 0x58, 0x1c, 0x3b, 
+	0x60, 0xa2, 0x70, 0x11, 0xf8, 0x91, 0x4, 0x43, 0x85, 0x1c, 
+	0x79, 0x5b, 0xe5, 0x19, 0x4f, 0xcb, 0xdd, 0x81, 0xa3, 0x84, 
+	0xe1, 0xeb, 0x98, 0x4e, 0x5b, 0x96, 0x44, 0x29, 0xb0, 0xaf, 
+	0x4, 0x1f, 0xb7, 0xaa, 0xa4, 0x4d, 0xf2, 0xea, 0x76, 0xbf, 
+	0xef, 0x2d, 0x67, 0xbf, 0xc2, 0x5a, 0x30, 0x6a, 0xe, 0x46, 
+	0xe4, 0x42, 0xc4, 0xa8, 0xa7, 0x8d, 0xc2, 0x48, 0x48, 0xaa, 
+	0x67, 0x99, 0x68, 0x35, 0x59, 0x93, 0x8f, 0xaa, 0xc9, 0x66, 
+	0x4a, 0x4d, 0x46, 0x4a, 0x7f, 0x56, 0x5d, 0x8d, 0x35, 0xa0, 
+	0xdb, 0x1e, 0x6a, 0x83, 0xa2, 0xc2, 0xf, 0x5c, 0x5e, 0x9c, 
+	0xae, 0xe1, 0x3d, 0x41, 0xd9, 0xe7, 0x4b, 0x8b, 0xbf, 0x1e, 
+	0x7, 0x17, 0xfa, 0x4f, 0x86, 0x93, 0x1d, 0xac, 0x2c, 0xea, 
+	0x72, 0x4b, 0x95, 0x18, 0x86, 0x9d, 0xfa, 0xe9, 0xbe, 0x40, 
+	0x3f, 0xe2, 0x28, 0xea, 0x52, 0xe7, 0x95, 0x23, 0xd6, 0x13, 
+	0x3e, 0x83, 0xe8, 0x8e, 0xe0, 0x71, 0x9a, 0xef, 0x9d, 0xfd, 
+	0xb6, 0x14, 0x77, 0x33, 0x82, 0xf5, 0xc, 0x55, 0xd3, 0x56, 
+	0x84, 0x70, 0xb9, 0x9a, 0xc3, 0x91, 0x43, 0xa4, 0x6b, 0x4c, 
+	0x43, 0xd5, 0xb3, 0xa7, 0x5, 0xfe, 0xf6, 0x7a, 0x13, 0x38, 
+	0xd3, 0x50, 0xb5, 0x1c, 0xb5, 0xba, 0x5e, 0xcf, 0x83, 0x15, 
+	0x4e, 0x53, 0xf3, 0x64, 0xe, 0xf1, 0x1c, 0x23, 0x2b, 0xa4, 
+	0x7, 0x44, 0x47, 0x17, 0x15, 0x2, 0x91, 0x73, 0x77, 00, 
+	0x65, 0x16, 0xf2, 0x38, 0x69, 0x9f, 0xfb, 0x49, 0x33, 0x70, 
+	0x43, 0xcd, 0xd1, 0x99, 0xba, 0xda, 0xae, 0xc3, 0x8d, 0x2f, 
+	0xa6, 0xfe, 0xee, 0x8e, 0x1d, 0x13, 0xe, 0x3e, 0xa0, 0x26, 
+	0x55, 0x9b, 0xd7, 0x1a, 0xa8, 0xff, 0x39, 0x10, 0x35, 0x1e, 
+	0x29, 0xf9, 0x17, 0xb7, 0x66, 0x40, 0x34, 0xbf, 0x55, 0x95, 
+	0xaf, 0xe5, 0x89, 0x35, 0xde, 0x12, 0xc3, 0xab, 0x7e, 0x59, 
+	0xa0, 0x17, 0x61, 0xb5, 0xe4, 0x59, 0x3b, 0x21, 0x75, 0x9c, 
+	0x25, 0x90, 0x7a, 0xa5, 0x10, 0x75, 0xf0, 0xac, 0x72, 0x5, 
+	0xfa, 0xe9, 0xc1, 0xeb, 0x30, 0x3e, 0x3d, 0x7d, 0x36, 0xa6, 
+	0x9b, 0x12, 0xbc, 0xf2, 0xe2, 0xb2, 0xb1, 0x55, 0x20, 0xf0, 
+	0x5d, 0x15, 0xe8, 0x47, 0xa6, 0x54, 0xc0, 0x12, 0x9d, 0xf9, 
+	0x76, 0x13, 0x26, 0x2a, 0xc6, 0xb4, 0x48, 0x97, 0xa4, 0x14, 
+	0xd9, 0x5e, 0x85, 0xed, 0xf2, 0xb0, 0x20, 0x47, 0xab, 0x81, 
+	0xe2, 0x24, 0x2b, 0x80, 0x3e, 0x11, 0x17, 0x43, 0xce, 0xeb, 
+	0x41, 0xa2, 0xec, 0x60, 0x79, 0x53, 0x34, 0xa9, 0x17, 0xa5, 
+	0x59, 0x1e, 0x9f, 0x87, 0x17, 0xc0, 0xef, 0xe, 0x10, 0xa4, 
+	0x2, 0x82, 0x6b, 0xe0, 0x5b, 0x6b, 0x29, 0xd7, 0x23, 0x4b, 
+	0xe6, 0x13, 0x4b, 0x16, 0x62, 0xc9, 0x8b, 0xb1, 0x2a, 0xeb, 
+	0xc2, 0xac, 0xb2, 0x5a, 0xb1, 0xdc, 0x89, 0xe8, 0x48, 0xb, 
+	0x85, 0x1d, 0x4, 0x38, 0x1e, 0x57, 0x56, 0x5c, 0xa5, 0x24, 
+	0xa8, 0xcc, 0xef, 0x40, 0x79, 0x81, 0xf1, 0xec, 0xa3, 0x63, 
+	0x10, 0xae, 0xd1, 0x48, 0x98, 0x9, 0xa0, 0x9e, 0x8, 0xc9, 
+	0xf, 0xc4, 0xd8, 0x2a, 0xb, 0x94, 0x30, 0xea, 0x36, 0x8a, 
+	0x58, 0x5d, 0x3b, 0x30, 0x16, 0x11, 0x4d, 0x96, 0x36, 0xc, 
+	0x3d, 0x71, 0x87, 0x75, 0x17, 0xb, 0x4, 0x9c, 0x43, 0xe9, 
+	0xac, 0xf, 0x83, 0xeb, 0x55, 0x32, 0xb7, 0xd6, 0x8b, 0x59, 
+	0x5b, 0x54, 0xdf, 0x2e, 0x9, 0xfd, 0x3d, 0x83, 0xc4, 0x9f, 
+	0xe6, 0xaa, 0x79, 0xd6, 0x35, 0x5f, 0x45, 0xd2, 0x49, 0xbb, 
+	0x12, 0xc6, 0xa0, 0x28, 0xe6, 0x8, 0x94, 0x2a, 0x76, 0x56, 
+	0xa5, 0xce, 0xb0, 0x38, 0x9c, 0x13, 0xe6, 0x3d, 0x38, 0xea, 
+	0x36, 0xa1, 0x2c, 0x10, 0x86, 0xf7, 0xc3, 0xc1, 0x81, 0x6f, 
+	0x98, 0xd0, 0x20, 0xd3, 0x2f, 0x20, 0x85, 0xef, 0x30, 0xb2, 
+	0x23, 0x5b, 0xd6, 0x1c, 0x90, 0x33, 0xc2, 0x3f, 0xd0, 0x22, 
+	0x16, 0x19, 0xa7, 0xe6, 0x93, 0x24, 0xc7, 0x8b, 0xf2, 0x52, 
+	0x59, 0x9a, 0x1e, 0x5b, 0xba, 0x5, 0x4, 0xda, 0x46, 0x60, 
+	0x2b, 0xfd, 0xb6, 0xd2, 0x1c, 0x6e, 0x2b, 0x92, 0xa9, 0x2e, 
+	0xc2, 0x56, 0x54, 0x90, 0xad, 0x17, 0x8d, 0x49, 0x8d, 0x4e, 
+	0x43, 0x46, 0x72, 0xe5, 0x91, 0xfa, 0x86, 0x8b, 0x97, 0x91, 
+	0x50, 0x1a, 0x1a, 0xb8, 0x91, 0x24, 0xb6, 0x5b, 0x8c, 0x3, 
+	0xe4, 0xc, 0x6, 0xe1, 0x53, 0xd4, 0xf4, 0xc7, 0xf8, 0xae, 
+	0x62, 0x51, 0x96, 0x64, 0x91, 0x3e, 0xc7, 0xf7, 0x20, 0xbe, 
+	0xb5, 0x71, 0x8a, 0x46, 0x85, 0x62, 0xa4, 0x1, 0x9a, 0x40, 
+	0x52, 0xce, 0xa8, 0xd8, 0xe5, 0xd, 0x52, 0xac, 0xeb, 0x14, 
+	0xbd, 0x30, 0x6d, 0xaf, 0x83, 0x28, 0x88, 0xc4, 0x8c, 0x6f, 
+	0x28, 0xbf, 0xeb, 0x27, 0x38, 0xb9, 0x60, 0x12, 0xd1, 0x25, 
+	0x5d, 0x8a, 0x79, 0x6f, 0x41, 0x33, 0xdb, 0xbd, 0x51, 0xf2, 
+	0xd0, 0xa8, 0x98, 0x2a, 0x33, 0x86, 0xc, 0x4b, 0xe6, 0xd1, 
+	0xda, 0x40, 0xe6, 0xc8, 0x30, 0xc9, 0xb5, 0xf1, 0xd9, 0x2c, 
+	0x17, 0xb1, 0xcf, 0x7a, 0x7c, 0x76, 0x58, 0x5, 0x1a, 0x47, 
+	0x28, 0x9e, 0x2f, 0x62, 0x13, 0x21, 0x3d, 0xd5, 0xc0, 0xa8, 
+	0xd3, 0x9e, 0x11, 0x74, 0x54, 0xd4, 0xdc, 0xa3, 0xa3, 0xf5, 
+	0xc7, 0xf0, 0x7e, 0x6c, 0xe1, 0xd3, 0xa4, 0x47, 0xa6, 0x9f, 
+	0xe1, 0x20, 0x73, 0x3d, 0x8f, 0x96, 0x89, 0x85, 0x8c, 0xa1, 
+	0x8c, 0x1a, 0x19, 0xd3, 0x1a, 0x8c, 0xe1, 0x13, 0x25, 0x11, 
+	0x33, 0xd9, 0xd3, 0x19, 0x3, 0x23, 0x1c, 0x5f, 0x2d, 0x93, 
+	0xc5, 0xca, 0xe0, 0x4e, 0x3f, 0xc5, 0xc1, 0x68, 0xc5, 0xd8, 
+	0x7a, 0xbb, 0xb6, 0xd8, 0x63, 0xd8, 0x16, 0xa7, 0x45, 0x54, 
+	0xc6, 0x8c, 0xbc, 0x6, 0x43, 0x5a, 0xbb, 0x89, 0xfb, 0x1e, 
+	0x9e, 0x78, 0x68, 0x5b, 0x5, 0xd2, 0x83, 0xb8, 0x4a, 0x28, 
+	0xab, 0x56, 0x7b, 0x1d, 0x56, 0x7, 0x22, 0x6e, 0x16, 0x8f, 
+	0xa7, 0x8d, 0xb2, 0xe0, 0x8b, 0x80, 0xde, 0x25, 0xe3, 0x63, 
+	0x89, 0xb3, 0x63, 0x8d, 0x3a, 0x75, 0xfd, 0x68, 0x33, 0xc0, 
+	0xdf, 0x88, 0x4c, 0x7a, 0xc2, 0xbc, 0x4d, 0xc4, 0xef, 0x3, 
+	0x1b, 0x35, 0x1d, 0xd, 0x3b, 0xd5, 0x50, 0xb3, 0x6, 0x65, 
+	0x1e, 0x84, 0x70, 0x81, 0x63, 0x15, 0xa7, 0x70, 0xac, 0x3a, 
+	0x15, 0x9a, 0x55, 0xa8, 0x8e, 0x39, 0x86, 0xe9, 0x70, 0xce, 
+	0xb8, 0x2f, 0x3, 0xda, 0xc, 0xc1, 0xd2, 0x42, 0x60, 0xd4, 
+	0x17, 0x82, 0xd0, 0xbf, 0xc, 0xe7, 0x1, 0xf6, 0x48, 0x96, 
+	0x17, 0x1d, 0xba, 0xc3, 0x78, 0x2a, 0xec, 0xca, 0x55, 0xdd, 
+	0xe6, 0x33, 0xa3, 0xca, 0xe5, 0xee, 0x1e, 0x5d, 0xb3, 0x55, 
+	0x34, 0xdc, 0x7d, 0x83, 0xbb, 0x6f, 0xf4, 0xee, 0x41, 0x78, 
+	0x49, 0x82, 0xe5, 0x6, 0x5e, 0xfc, 0xd, 0x96, 0x38, 0xc2, 
+	0xb, 0xd7, 0xde, 0x62, 0x64, 0x45, 0x39, 0x48, 0x19, 0x1c, 
+	0x32, 0xd8, 0xdc, 0xf3, 0x60, 0xbe, 0x8c, 0xd9, 0xee, 0x12, 
+	0xe, 0x66, 0x5, 0x52, 0xb0, 0x84, 0xa8, 0x11, 0xde, 0x27, 
+	0x6b, 0x78, 0xbf, 0x15, 0x91, 0x9d, 0x8b, 0x22, 0x49, 0xe7, 
+	0x2, 0x3d, 0xab, 0xa4, 0x34, 0x56, 0x7, 0xeb, 0x57, 0x54, 
+	0xd3, 0xb, 0x44, 0xc1, 0xab, 0x9b, 0x6d, 0x5c, 0x30, 0x79, 
+	0xa6, 0x3, 0x33, 0xaa, 0x4e, 0x2, 0x52, 0x97, 0xd9, 0xa8, 
+	0x60, 0x66, 0x19, 0x4a, 0x51, 0xd6, 0x21, 0x9d, 0xfe, 0xec, 
+	0x4a, 0x7c, 0xe8, 0x3a, 0x28, 0x8f, 0xb3, 0x8a, 0xd1, 0x6, 
+	0x1d, 0x92, 0x7a, 0xeb, 0x3c, 0xef, 0xbd, 0x5f, 0x8f, 0x94, 
+	0xf1, 0x58, 0xfa, 0xa9, 0x39, 0x96, 0xa0, 0xe6, 0xa, 0xb8, 
+	0x6c, 0x3a, 0x8b, 0x3b, 0x48, 0x8a, 0x1b, 0x23, 0xe6, 0x49, 
+	0xdf, 0x3a, 0xb0, 0x28, 0x9a, 0xb5, 0xf5, 0xd6, 0xb5, 0x67, 
+	0x10, 0xd1, 0xed, 0x60, 0x87, 0x96, 0xe7, 0xe7, 0x2f, 0x63, 
+	0xda, 0xd0, 0x1b, 0x31, 0x70, 0x55, 0xdf, 0xef, 0xbe, 0x7c, 
+	0xd8, 0xe7, 0xb7, 0x6d, 0x93, 0x6c, 0x2e, 0x7f, 0x3, 0x9f, 
+	0x8, 0x7c, 0x2a, 0xea, 0x57, 0x67, 0x69, 0xd3, 0x54, 0x37, 
+	0x57, 0x57, 0x87, 0xc3, 0x61, 0x76, 0x98, 0xcf, 0x4a, 0xbe, 
+	0xbb, 0xa, 0x7d, 0xdf, 0xc7, 0xf9, 0x67, 0xe4, 0x3e, 0x63, 
+	0x87, 0xaf, 0xcb, 0x87, 0x57, 0x67, 0xa8, 0xe5, 0xe1, 0x2, 
+	0xfe, 0x9d, 0x89, 0x36, 0xc9, 0xab, 0x33, 0x74, 0xc7, 0x67, 
+	0x10, 0xb7, 0xf1, 0xf2, 0x8e, 0xbd, 0x3a, 0xfb, 0x3c, 0x9c, 
+	0xcb, 0x93, 0xd6, 0x43, 0x32, 0x66, 0x7c, 0x75, 0x16, 0x76, 
+	0x3, 0x28, 0x66, 0x11, 0xad, 0x5e, 0x9d, 0x9, 0x2c, 0xad, 
+	0xe1, 0x5f, 0xc0, 0x95, 0xeb, 0xf1, 0xdf, 0xfe, 0xa6, 0xa2, 
+	0x4d, 0x4a, 0xe2, 0x57, 0x67, 0x6f, 0x83, 0x90, 0xcc, 0xef, 
+	0xe7, 0x67, 0x57, 0xf6, 0xd0, 0x66, 0x38, 0x14, 0x4, 0xe9, 
+	0x3c, 0xf7, 0xe6, 0x64, 0xe9, 0xcd, 0xbd, 0x65, 0x3a, 0xff, 
+	0x15, 0x9f, 0x47, 0x19, 0x8f, 0xc0, 0xa9, 0x47, 0x80, 0x7b, 
+	00, 0x48, 0x44, 0x47, 0xf8, 0xff, 0xfa, 0x8c, 0x70, 0x44, 
+	0xc9, 0x5c, 0xbe, 0x21, 0x9b, 0xdc, 0xb, 0x89, 0xf8, 0xb5, 
+	0xe1, 0xae, 0xe0, 0x9, 0xc, 0x7a, 0xea, 0x1, 0x32, 0xe4, 
+	0xb7, 0x2f, 0x2f, 0xdc, 0x3, 0x40, 0x3f, 0xd3, 0x94, 0xa5, 
+	0xba, 0xa8, 0xf5, 0xef, 0x7a, 0xc, 0xf9, 0xa, 0x98, 0xb, 
+	0x7f, 0x44, 0xfd, 0xff, 0x47, 0xc9, 0x64, 0xeb, 0x10, 0xe6, 
+	0x6f, 0x80, 0x63, 0xa3, 0xa3, 0xc1, 0xe6, 0x4, 0x3, 0xb, 
+	0xda, 0x1b, 0xb8, 0x7f, 0x1f, 0xee, 0xa1, 0xcb, 0x22, 0xb0, 
+	0xe5, 0xf2, 0x8c, 0x1c, 0xc5, 0xab, 0x2, 0x15, 0xc0, 0xde, 
+	0xd2, 0xe4, 0xc8, 0xf7, 0xfc, 0x41, 0x80, 0xe7, 0x47, 0x57, 
+	0x2e, 0xaf, 0xc9, 0x75, 0xba, 0xba, 0x5f, 0x7d, 0x7f, 0x6d, 
+	0x33, 0x7a, 0xd, 0x2a, 0xb1, 0xb0, 0x99, 0x3c, 0x1c, 0x5a, 
+	0x93, 0x60, 0x3d, 0x9c, 0xa5, 0xc7, 0xcc, 0x73, 0xe8, 0xb2, 
+	0xbc, 0xbe, 0x2a, 0x61, 0x64, 0x79, 0x4e, 0xf8, 0x31, 0x19, 
+	0x50, 0x48, 0x33, 0x78, 0x3e, 0xbf, 0xc4, 0xd0, 0xe2, 0x42, 
+	0x36, 0x17, 0x65, 0x90, 0xf3, 0x1d, 0xb6, 0xf, 0xbf, 0x3a, 
+	0xb0, 0xba, 0xdc, 0x33, 0xd9, 0x1b, 0x1d, 0xe6, 0x41, 0xbd, 
+	0x69, 0xb6, 0xe2, 0xf8, 0x2e, 0x3, 0x79, 0x3, 0x6e, 0x2, 
+	0x7c, 0x80, 0x98, 0x85, 0xf, 0x65, 0xb8, 0x65, 0xdf, 0x71, 
+	0x30, 0xa, 0x59, 0x78, 0xe7, 0xa9, 0xaa, 0x20, 0x84, 0xab, 
+	0x1b, 0x6b, 0x33, 0x5a, 0x55, 0x7d, 0xed, 0xad, 0xaf, 0x33, 
+	0x3a, 0xc1, 0x93, 0xfe, 0x6c, 0xdd, 0xfb, 0x10, 0x55, 0x53, 
+	0x58, 0xae, 0x2b, 0x6d, 0xe6, 0xc5, 0x4, 0x3b, 0xfa, 0x1a, 
+	0xe4, 0x62, 0x23, 0xf7, 0x5, 0xf4, 0x90, 0x46, 0xdd, 0x1c, 
+	0x9b, 0x5a, 0x6e, 0x6d, 0xe5, 0xdc, 0x49, 0x99, 0xec, 0x2e, 
+	0x28, 0x94, 0x8d, 0x9c, 0xbf, 0x8c, 0xe3, 0x8b, 0xc9, 0xec, 
+	0x40, 0xfc, 0x8, 0x8e, 0xff, 0x29, 0xc5, 0xc2, 0x43, 0x3f, 
+	0x47, 0x34, 0xe8, 0x61, 0x2d, 0x1, 0x68, 0x75, 0x1f, 0xc1, 
+	0x8e, 0x6c, 0xc0, 0xee, 0x59, 0x31, 0xbd, 0x83, 0xbc, 0xdb, 
+	0x6b, 0x6, 0xd8, 0xf4, 0x28, 0x60, 0xe3, 0xb2, 0x1e, 0x38, 
+	0xbe, 0x48, 0xec, 0x85, 0xd2, 0x4b, 0xd1, 0x10, 0xf7, 0x5f, 
+	0x7d, 0x7d, 0x97, 0x15, 0x61, 0x7c, 0x97, 0x3d, 0x40, 0x6, 
+	0x24, 0x6f, 0x44, 0x20, 0x10, 0x39, 0x39, 0xb2, 0x7b, 0xee, 
+	0x63, 0x17, 0x8a, 0x34, 0x6f, 0x9a, 0xb4, 0xdd, 0x6f, 0xb, 
+	0x9a, 0xe5, 0x66, 0x5c, 0xa0, 0xb9, 0x6a, 0xd4, 0x3d, 0xc2, 
+	0xe5, 0xca, 0x8e, 0x15, 0x74, 0xbf, 0x67, 0x3c, 0x57, 0x2f, 
+	0xb7, 0xbf, 0x80, 0xf2, 0x7b, 0x49, 0x86, 0x9d, 0x53, 0xc, 
+	0x1d, 0xb5, 0x58, 0xbe, 0xcd, 0xe2, 0x18, 0x1b, 0x6a, 0x28, 
+	0x9e, 0xdf, 0x30, 0xc0, 0x32, 0xaf, 0x3b, 0xc9, 0x8c, 0xd5, 
+	0xe7, 0x9e, 0xd6, 00, 0x7e, 0x7b, 0x5a, 0x61, 0x28, 0xdb, 
+	0x62, 0xa1, 0x2, 0x15, 00, 0xa9, 0xdd, 0xb, 0x60, 0x20, 
+	0x20, 0x5, 0xcb, 0x25, 0xa9, 0xb8, 0x55, 0x92, 0x63, 0xc, 
+	0x98, 0xc2, 0x33, 0x56, 0x88, 0x85, 0x3f, 0x72, 0xe4, 0x6d, 
+	0xd3, 0x3d, 0x94, 0x77, 0x2d, 0x4a, 0xd0, 0x9, 0x33, 0x83, 
+	0x37, 0x31, 0x50, 0xd1, 0x9c, 0x5b, 0x7a, 0xeb, 0x6e, 0x6c, 
+	0x5a, 0x77, 0x8e, 0x6c, 0xf5, 0xd1, 0x22, 0xed, 0xe8, 0x84, 
+	0xba, 0x54, 0x12, 0x8e, 0x6b, 0x4a, 0x1f, 0xc4, 0x8f, 0x5e, 
+	0x53, 0xb0, 0x2e, 0x36, 0xe, 0x70, 0x5d, 0x3c, 0x5, 0x57, 
+	0xa5, 0x63, 0x76, 0xef, 0x67, 0xc, 0xfc, 0xa7, 0x34, 0xbc, 
+	0xc6, 0x2f, 0x2f, 0xd8, 0x68, 0x56, 0x3, 0xab, 0xe1, 0x7f, 
+	0x1a, 0x27, 0x5d, 0xf3, 0x30, 0x72, 0x45, 0x40, 0x13, 0xb4, 
+	0x5c, 0x2e, 0x2d, 0x2b, 0x30, 0x6b, 0xab, 0x18, 0x8d, 0x36, 
+	0xbd, 0x7, 0x94, 0xb0, 0xd, 0x3e, 0x7d, 0x6b, 0x3b, 0x49, 
+	0xd8, 0x8a, 0xc9, 0x24, 0x37, 0xb7, 0x8b, 0x16, 0xa2, 0x2a, 
+	0x46, 0x77, 0x75, 0x67, 0x9, 0xed, 0xa0, 0x5c, 0x5e, 0x8d, 
+	0x14, 0x62, 0xd7, 0x42, 0x3a, 0x8f, 0x41, 0x11, 0x5a, 0xdc, 
+	0x1a, 0x2f, 0x2c, 0x81, 0xa7, 0x15, 0x99, 0x86, 0x4, 0xe4, 
+	0xf6, 0x96, 0xf4, 0xba, 0x37, 0xac, 0x21, 0x4d, 0xa, 0xf9, 
+	0x2b, 0x8e, 0xe2, 0xbd, 0x3c, 0x79, 0x13, 0xa, 0xaf, 0xe5, 
+	0x41, 0x90, 0x45, 0xa, 0xca, 0xb9, 0x2e, 0x58, 0x8c, 0x9b, 
+	0x4c, 0xb, 0xc3, 0x36, 0x77, 0xf2, 0xc, 0xd2, 0xff, 0xf4, 
+	0x57, 0xc3, 0x40, 0xf, 0x38, 0x55, 0x93, 0x20, 0x27, 0xc5, 
+	0xfd, 0x8f, 0x12, 0xd5, 0xb6, 0xb2, 0xb6, 0x52, 0xc7, 0x36, 
+	0x45, 0xf3, 0x7f, 0x31, 0x56, 0xc9, 0x1b, 0x4b, 0x48, 0xf4, 
+	0xff, 0xfc, 0xed, 0xef, 0xb5, 0xb8, 0xba, 0x54, 0xcb, 0x9b, 
+	0x35, 0x1d, 0xde, 0xba, 0x65, 0x2b, 0xfd, 0x9b, 0x81, 0xce, 
+	0x3b, 0xd9, 0x35, 0xea, 0x6a, 0x6d, 0x2, 0x14, 0xd0, 0xa2, 
+	0x94, 0xb4, 0xcd, 0xa5, 0xd1, 0x2, 0xe2, 0x4, 0x55, 0x93, 
+	0x97, 0xd4, 0x6c, 0x6c, 0xa7, 0xa4, 0xae, 0x53, 0xbf, 0x27, 
+	0x4a, 0x62, 0xaf, 0xa6, 0x83, 0x44, 0xcc, 0x6d, 0x25, 0x99, 
+	0x98, 0xe6, 0xd9, 0xb0, 0xb6, 0xf0, 0x8d, 0x8f, 0xbf, 0x23, 
+	0xda, 0x67, 0x36, 0x85, 0x55, 0xf7, 0x2f, 0x5c, 0x9e, 0xac, 
+	0x8b, 0x5a, 0x3a, 0xbd, 0x36, 0x10, 0xd0, 0xc5, 0xe6, 0xff, 
+	0x7d, 0x6e, 0x75, 0x7c, 0x19, 0xd7, 0xdc, 0xa7, 0x70, 0xcb, 
+	0x44, 0x76, 0x8c, 0x61, 0x6c, 0xb9, 0x9e, 0xaf, 0xe7, 0x6, 
+	0xc3, 0xe, 0xe8, 0xa0, 0xff, 0x95, 0x1c, 0x43, 0x6d, 0x40, 
+	0xbc, 0xbd, 0x14, 0x8b, 0xbb, 0x75, 0x16, 0xc3, 0x63, 0x7d, 
+	0x75, 0x4a, 0xbb, 0x28, 0xd9, 0x37, 0xae, 0x4f, 0xbb, 0xe3, 
+	0xce, 0x3f, 0xc9, 0xf6, 0xb2, 0xeb, 0x8e, 0x9f, 0x5a, 0xe1, 
+	0x11, 0xfa, 0xd0, 00, 0xf, 0x88, 0x6e, 0x53, 0x83, 0xff, 
+	0x6a, 0xb2, 0x88, 0xe6, 0xf9, 0xd1, 0x52, 0x23, 0x4d, 0xec, 
+	0xd4, 0x9d, 0x25, 0x71, 0xb, 0x91, 0xab, 0x4f, 0x97, 0x44, 
+	0x98, 0x6d, 0x4f, 0x69, 0xd8, 0x25, 0x61, 0x4d, 0x34, 0x93, 
+	0xe0, 0xa6, 0x2e, 0x81, 0x6b, 0xe5, 0x4c, 0x41, 0x7d, 0x9b, 
+	0x52, 0x4e, 0x83, 0xf, 0x3c, 0xfb, 0x15, 0x9, 0x53, 0xd8, 
+	0x68, 0x33, 0xab, 0x39, 0x24, 0x6f, 0xc8, 0x2b, 0xe, 0x3c, 
+	0x4e, 0x45, 0x93, 0xdd, 0x6c, 0x39, 0x11, 0x3b, 0x30, 0xac, 
+	0x61, 0x53, 0xc1, 0xd3, 0x94, 0xc, 0x9c, 0x86, 0x66, 0xd6, 
+	0xae, 0x86, 0x30, 0xa3, 0x55, 0xb8, 0x9, 0xe5, 0x1d, 0x85, 
+	0x3f, 0x3f, 0x60, 0x9d, 0x9c, 0xde, 0xfd, 0x85, 0x3c, 0x12, 
+	0xf3, 0x9c, 0x50, 0x4d, 0xc8, 0x7f, 0x64, 0xfb, 0xaa, 0xe4, 
+	0xd, 0x2d, 0x80, 0x1f, 0x3a, 0x7b, 0xa3, 0xb9, 0x53, 0xea, 
+	0x4f, 0xf0, 0xfc, 0xbb, 0x3a, 0x3f, 0xd8, 0x5a, 0x1d, 0xf2, 
+	0x92, 0x2e, 0xd0, 0x25, 0x96, 0x1a, 0x59, 0x7b, 0x9c, 0x28, 
+	0xe8, 0x9c, 0xb8, 0x8e, 0xf6, 0xab, 0x97, 0x15, 0x31, 0x4a, 
+	0xe2, 0xf5, 0xb5, 0x8c, 0x2b, 0xbf, 0xda, 0xa, 0x8b, 0xe, 
+	0x34, 0x1f, 0xf1, 0x2, 0xe9, 0x8e, 0x30, 0x6c, 0xa8, 0xa9, 
+	0x23, 0x12, 0x58, 0xff, 0x19, 0x2b, 0x2d, 0xe5, 0xe1, 0xd5, 
+	0x4b, 0x7c, 0xfd, 0x46, 0x30, 0xe9, 0x2d, 0x8e, 0xbf, 0xfc, 
+	0xcb, 0x58, 0x95, 0xe9, 0xc3, 0xd8, 0xaa, 0x37, 0xb4, 0x2d, 
+	0xa2, 0xf4, 0xb9, 0xab, 0x7e, 0x28, 0x92, 0xf2, 0xb9, 0x6b, 
+	0xbe, 0xc5, 0xde, 0xc2, 0x73, 0x17, 0xbd, 0x2e, 0x8b, 0x24, 
+	0xe3, 0xb2, 0xad, 0x77, 0x72, 0xad, 0x5a, 0xec, 0xa1, 0x88, 
+	0xc0, 0x83, 0x8f, 0x9c, 0x27, 0x1a, 0xd1, 0x3e, 0x89, 0x71, 
+	0xa2, 0x65, 0xf7, 0x3b, 0x83, 0x43, 0x61, 0x73, 0xaf, 0x5a, 
+	0xc9, 0x42, 0x68, 0x77, 0x80, 0xb0, 0xd0, 0xef, 0xe9, 0xb1, 
+	0xbe, 0x7e, 0x37, 0x85, 0x92, 0xea, 0xb5, 0x4a, 0xa4, 0xd4, 
+	0x87, 0xb1, 0xc2, 0xea, 0xb9, 0xb7, 0xc4, 0x12, 0x26, 0xbe, 
+	0x5e, 0xdc, 0x4e, 0xe6, 0x3e, 0x96, 0x35, 0xd, 0xc7, 0x4d, 
+	0xe8, 0x66, 0xac, 0xfa, 0x8d, 0x85, 0x3c, 0xb3, 0xfe, 0xdd, 
+	0x51, 0x18, 0xc, 0x28, 0xc, 0x9c, 0xc4, 0x42, 0x5d, 0xc4, 
+	0x57, 0x9f, 0x16, 0xbe, 0xba, 0xe, 0xa0, 0x78, 0x60, 0x5e, 
+	0xd0, 0xb1, 0x32, 0xce, 0xbe, 0xea, 0x6d, 0x24, 0x37, 0x42, 
+	0xc9, 0xcc, 0x53, 0xd5, 0xcb, 0x2d, 0x63, 0xf4, 0xe5, 0xd0, 
+	0x36, 0x8d, 0x7a, 0x33, 0x95, 0xb0, 0x8, 0x35, 0x47, 0xc1, 
+	0x55, 0xe2, 0x24, 0x53, 0x78, 0xd5, 0x98, 0x80, 0x3d, 0xb0, 
+	0xbd, 0xd3, 0xa7, 0xef, 0x4e, 0xcd, 0x17, 0xf5, 0x51, 0x7c, 
+	0x7d, 0xb0, 0x41, 0x1b, 0x2, 00, 0x22, 0xa1, 0x91, 0x10, 
+	0x5e, 0x41, 0xc8, 0x5, 0xee, 0x18, 0x3f, 0xe0, 0x5a, 0xf5, 
+	0x7d, 0x24, 0xc3, 0x31, 0x85, 0x4e, 0xea, 0xdf, 0x39, 0x15, 
+	0xb6, 0xaf, 0x52, 0x5a, 0x67, 0xf5, 0x58, 0x9, 0x20, 0x78, 
+	0x7a, 0xc7, 0xb2, 0x23, 0x4d, 0xe8, 0x97, 0x4b, 0x94, 0x68, 
+	0xe8, 0xd, 0xa9, 0x32, 0x1a, 0x75, 0x3f, 0x81, 0xa3, 0x3b, 
+	0x41, 0x94, 0xec, 0x8, 0xca, 0xfe, 0xc3, 0xff, 0x1, 0x69, 
+	0xef, 0xaa, 0xac, 0xeb, 0x38, 0xab, 0x56, 0x65, 0x5d, 0xf5, 
+	0x97, 0xe6, 0xcd, 0x9c, 0x61, 0x65, 0xc4, 0x4, 0x76, 0xe, 
+	0x33, 0xf5, 0x55, 0x1c, 0x4b, 0x10, 0x55, 0x37, 0xc8, 0xfd, 
+	0x56, 0x9f, 0x44, 0xe3, 0xbd, 0x48, 0x32, 0x30, 0xec, 0x75, 
+	0x1b, 0xab, 0xd, 0x3e, 0x91, 0x72, 0xe8, 0xbe, 0xf5, 0xa4, 
+	0xc6, 0x21, 0x7f, 0xc5, 0x17, 0x8a, 0x1b, 0x7e, 0xda, 0x83, 
+	0x31, 0x3f, 0xf1, 0x55, 0xd1, 0xc2, 0xe8, 0x21, 0xe2, 0x97, 
+	0x48, 0xc4, 0x2a, 0x65, 0xf8, 0xd, 0x91, 0xff, 0x58, 0x8f, 
+	0x54, 0xb9, 0xd9, 0xe9, 0x86, 0xad, 0xe1, 0x76, 0x47, 0xc0, 
+	0x3e, 0xc9, 0xdf, 0xba, 0xbd, 0xde, 0xf, 0x2f, 0xfe, 0x1, 
+	0xd0, 0x89, 0x63, 0xaa, 0xc2, 0x3d, 00, 00, };
+
+static const unsigned char data_error_shtml[] = {
+	/* /error.shtml */
+	0x2f, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2e, 0x73, 0x68, 0x74, 0x6d, 0x6c, 0,
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x20, 0x32, 
+	0x30, 0x30, 0x20, 0x4f, 0x4b, 0xd, 0xa, 0x53, 0x65, 0x72, 
+	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
+	0x70, 0x72, 0x65, 0x2d, 0x30, 0x2e, 0x36, 0x20, 0x28, 0x68, 
 	0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 
 	0x73, 0x69, 0x63, 0x73, 0x2e, 0x73, 0x65, 0x2f, 0x7e, 0x61, 
 	0x64, 0x61, 0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 
@@ -3537,7 +2390,7 @@ static const unsigned char data_error_shtml[] = {
 static const unsigned char data_404_html[] = {
 	/* /404.html */
 	0x2f, 0x34, 0x30, 0x34, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0,
-	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x20, 0x34, 
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x31, 0x20, 0x34, 
 	0x30, 0x34, 0x20, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x6e, 0x6f, 
 	0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0xd, 0xa, 0x53, 
 	0x65, 0x72, 0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 
@@ -3547,45 +2400,37 @@ static const unsigned char data_404_html[] = {
 	0x7e, 0x61, 0x64, 0x61, 0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 
 	0x2f, 0x29, 0xd, 0xa, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 
 	0x74, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 
-	0x78, 0x74, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0xd, 0xa, 0xd, 
-	0xa, 0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 
-	0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0xa, 0x3c, 0x68, 0x74, 
-	0x6d, 0x6c, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x3d, 0x22, 0x65, 
-	0x6e, 0x22, 0x3e, 0xa, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 
-	0xa, 0x20, 0x20, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x63, 
-	0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 0x22, 0x55, 0x54, 
-	0x46, 0x2d, 0x38, 0x22, 0x3e, 0xa, 0x20, 0x20, 0x3c, 0x6d, 
-	0x65, 0x74, 0x61, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
-	0x76, 0x69, 0x65, 0x77, 0x70, 0x6f, 0x72, 0x74, 0x22, 0x20, 
-	0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x77, 
-	0x69, 0x64, 0x74, 0x68, 0x3d, 0x64, 0x65, 0x76, 0x69, 0x63, 
-	0x65, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x20, 0x69, 
-	0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x2d, 0x73, 0x63, 0x61, 
-	0x6c, 0x65, 0x3d, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0xa, 0x20, 
-	0x20, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x68, 0x74, 0x74, 
-	0x70, 0x2d, 0x65, 0x71, 0x75, 0x69, 0x76, 0x3d, 0x22, 0x72, 
-	0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x22, 0x20, 0x63, 0x6f, 
-	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x30, 0x3b, 0x75, 
-	0x72, 0x6c, 0x3d, 0x2f, 0x6d, 0x6e, 0x67, 0x72, 0x5f, 0x68, 
-	0x6f, 0x6d, 0x65, 0x2e, 0x73, 0x68, 0x74, 0x6d, 0x6c, 0x22, 
-	0x3e, 0xa, 0x20, 0x20, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 
-	0x3e, 0x52, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 
-	0x6e, 0x67, 0x2e, 0x2e, 0x2e, 0x3c, 0x2f, 0x74, 0x69, 0x74, 
-	0x6c, 0x65, 0x3e, 0xa, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 
-	0x3e, 0xa, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0xa, 0x20, 
-	0x20, 0x3c, 0x70, 0x3e, 0x50, 0x61, 0x67, 0x65, 0x20, 0x6e, 
-	0x6f, 0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x2e, 0x20, 
-	0x52, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6e, 
-	0x67, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 
-	0x6f, 0x6d, 0x65, 0x20, 0x70, 0x61, 0x67, 0x65, 0x2e, 0x2e, 
-	0x2e, 0x3c, 0x2f, 0x70, 0x3e, 0xa, 0x20, 0x20, 0x3c, 0x70, 
-	0x3e, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 
-	0x2f, 0x6d, 0x6e, 0x67, 0x72, 0x5f, 0x68, 0x6f, 0x6d, 0x65, 
-	0x2e, 0x73, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x47, 0x6f, 
-	0x20, 0x74, 0x6f, 0x20, 0x68, 0x6f, 0x6d, 0x65, 0x3c, 0x2f, 
-	0x61, 0x3e, 0x3c, 0x2f, 0x70, 0x3e, 0xa, 0x3c, 0x2f, 0x62, 
-	0x6f, 0x64, 0x79, 0x3e, 0xa, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 
-	0x6c, 0x3e, 0xa, };
+	0x78, 0x74, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0xd, 0xa, 0x43, 
+	0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x45, 0x6e, 0x63, 
+	0x6f, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x67, 0x7a, 0x69, 
+	0x70, 0xd, 0xa, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 
+	0x2d, 0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3a, 0x20, 0x32, 
+	0x35, 0x33, 0xd, 0xa, 0xd, 0xa, 0x1f, 0x8b, 0x8, 00, 
+	00, 00, 00, 00, 0x2, 0x3, 0x65, 0x90, 0x3b, 0x4f, 
+	0xc4, 0x30, 0x10, 0x84, 0xfb, 0xfc, 0x8a, 0xc5, 0x35, 0xb1, 
+	0x8f, 0xe, 0x9, 0x3b, 0xd, 0xaf, 0x92, 0x13, 0x3a, 0xa, 
+	0x2a, 0x64, 0xe2, 0xbd, 0xd8, 0x92, 0x5f, 0x38, 0x9b, 0x9c, 
+	0xf8, 0xf7, 0xc4, 0x9, 0x12, 0x91, 0xa8, 0x2c, 0xcf, 0xce, 
+	0x37, 0x3b, 0xb6, 0xbc, 0x7a, 0x78, 0xb9, 0x3f, 0xbd, 0x1f, 
+	0x1f, 0xc1, 0x52, 0xf0, 0x5d, 0x23, 0xeb, 0x1, 0x5e, 0xc7, 
+	0x41, 0x31, 0x8c, 0xac, 0xa, 0xa8, 0x4d, 0xd7, 00, 0xc8, 
+	0x80, 0xa4, 0xa1, 0xb7, 0xba, 0x8c, 0x48, 0x8a, 0xbd, 0x9d, 
+	0x9e, 0xda, 0x5b, 0xf6, 0x37, 0x88, 0x3a, 0xa0, 0x62, 0xb3, 
+	0xc3, 0x4b, 0x4e, 0x85, 0x18, 0xf4, 0x29, 0x12, 0xc6, 0xc5, 
+	0x78, 0x71, 0x86, 0xac, 0x32, 0x38, 0xbb, 0x1e, 0xdb, 0xf5, 
+	0x72, 0xd, 0x2e, 0x3a, 0x72, 0xda, 0xb7, 0x63, 0xaf, 0x3d, 
+	0xaa, 0x1b, 0x7e, 0xd8, 0x5, 0x59, 0xa2, 0xdc, 0xe2, 0xd7, 
+	0xe4, 0x66, 0xc5, 0xa, 0x9e, 0xb, 0x8e, 0x76, 0x97, 0x76, 
+	0xb8, 0x9b, 0x8a, 0x57, 0x22, 0xc4, 0xa1, 0x7c, 0xd8, 0x14, 
+	0x90, 0x8f, 0xb5, 0xf0, 0x86, 0x93, 0x23, 0x8f, 0xdd, 0x2b, 
+	0x1a, 0x57, 0xb0, 0x27, 0x17, 0x7, 0xce, 0xb9, 0x14, 0x9b, 
+	0xda, 0x48, 0xb1, 0x3d, 0x44, 0x7e, 0x26, 0xf3, 0xbd, 0xda, 
+	0x73, 0x77, 0xd4, 0x3, 0x42, 0x4c, 0x4, 0xe7, 0x34, 0x45, 
+	0xc3, 0x61, 0x87, 0x2, 0x25, 0x20, 0x8b, 0x50, 0x77, 0x40, 
+	0x5e, 0x7c, 0x6b, 0x56, 0xfe, 0x5, 0xe5, 0x52, 0x73, 0xe9, 
+	0xa6, 0xd8, 0xff, 0x22, 0xcf, 0xa9, 0xa2, 0x55, 0x91, 0x42, 
+	0x77, 0x2b, 0x22, 0xc5, 0xb6, 0x73, 0xa9, 0xb0, 0xfe, 0xf1, 
+	0xf, 0x44, 0x79, 0x8d, 0x3d, 0x74, 0x1, 00, 00, };
 
 static const unsigned char data_mngr_wifi_shtml[] = {
 	/* /mngr_wifi.shtml */
@@ -4124,957 +2969,2447 @@ static const unsigned char data_mngr_wifi_shtml[] = {
 	0x62, 0x65, 0x6c, 0x6f, 0x77, 0x2e, 0x3c, 0x2f, 0x64, 0x69, 
 	0x76, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 
+	0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x68, 
+	0x65, 0x6c, 0x70, 0x65, 0x72, 0x2d, 0x74, 0x65, 0x78, 0x74, 
+	0x22, 0x3e, 0x2d, 0x20, 0x3c, 0x73, 0x74, 0x72, 0x6f, 0x6e, 
+	0x67, 0x3e, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x50, 
+	0x6f, 0x69, 0x6e, 0x74, 0x20, 0x2b, 0x20, 0x53, 0x74, 0x61, 
+	0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x3c, 0x2f, 0x73, 0x74, 0x72, 
+	0x6f, 0x6e, 0x67, 0x3e, 0x20, 0x74, 0x68, 0x65, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x6f, 
+	0x64, 0x65, 0x3e, 0x63, 0x72, 0x6f, 0x69, 0x73, 0x73, 0x61, 
+	0x6e, 0x74, 0x2d, 0x69, 0x64, 0x3c, 0x2f, 0x63, 0x6f, 0x64, 
+	0x65, 0x3e, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 
+	0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x6f, 0x6d, 0x65, 
+	0x73, 0x20, 0x75, 0x70, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 
+	0x20, 0x61, 0x77, 0x61, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 
+	0x6c, 0x74, 0x20, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 
+	0x64, 0x2c, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x70, 
+	0x61, 0x67, 0x65, 0x20, 0x73, 0x74, 0x61, 0x79, 0x73, 0x20, 
+	0x72, 0x65, 0x61, 0x63, 0x68, 0x61, 0x62, 0x6c, 0x65, 0x20, 
+	0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 
+	0x73, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6a, 0x6f, 
+	0x69, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65, 
+	0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x62, 0x65, 0x6c, 0x6f, 
+	0x77, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 
+	0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2e, 
+	0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 
+	0x61, 0x62, 0x65, 0x6c, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 
+	0x65, 0x63, 0x74, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x77, 0x69, 
+	0x66, 0x69, 0x2d, 0x6d, 0x6f, 0x64, 0x65, 0x22, 0x20, 0x6e, 
+	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 
+	0x6d, 0x6f, 0x64, 0x65, 0x22, 0x3e, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x3e, 0x41, 
+	0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x50, 0x6f, 0x69, 0x6e, 
+	0x74, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
+	0x31, 0x22, 0x3e, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 
+	0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
+	0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x32, 
+	0x22, 0x3e, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x50, 
+	0x6f, 0x69, 0x6e, 0x74, 0x20, 0x2b, 0x20, 0x53, 0x74, 0x61, 
+	0x74, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 
+	0x6f, 0x6e, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 
+	0x63, 0x74, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xa, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 
+	0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 
+	0x2d, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 
+	0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x77, 
+	0x69, 0x66, 0x69, 0x2d, 0x68, 0x6f, 0x73, 0x74, 0x6e, 0x61, 
+	0x6d, 0x65, 0x22, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x3e, 0x48, 0x6f, 0x73, 
+	0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3c, 0x2f, 0x73, 0x74, 
+	0x72, 0x6f, 0x6e, 0x67, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 
+	0x3d, 0x22, 0x68, 0x65, 0x6c, 0x70, 0x65, 0x72, 0x2d, 0x74, 
+	0x65, 0x78, 0x74, 0x22, 0x3e, 0x44, 0x65, 0x76, 0x69, 0x63, 
+	0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x6e, 0x61, 0x6d, 0x65, 
+	0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x6d, 
+	0x44, 0x4e, 0x53, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6c, 0x6f, 
+	0x63, 0x61, 0x6c, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 
+	0x6b, 0x20, 0x6e, 0x61, 0x6d, 0x69, 0x6e, 0x67, 0x2e, 0x3c, 
+	0x2f, 0x64, 0x69, 0x76, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 
+	0x62, 0x65, 0x6c, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 
+	0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 
+	0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x77, 0x69, 
+	0x66, 0x69, 0x2d, 0x68, 0x6f, 0x73, 0x74, 0x6e, 0x61, 0x6d, 
+	0x65, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x77, 
+	0x69, 0x66, 0x69, 0x2d, 0x68, 0x6f, 0x73, 0x74, 0x6e, 0x61, 
+	0x6d, 0x65, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 
+	0x67, 0x74, 0x68, 0x3d, 0x22, 0x36, 0x34, 0x22, 0x20, 0x61, 
+	0x75, 0x74, 0x6f, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 
+	0x65, 0x3d, 0x22, 0x6f, 0x66, 0x66, 0x22, 0x3e, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 
+	0x3e, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 
+	0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x72, 0x6f, 0x77, 0x20, 
+	0x73, 0x74, 0x61, 0x2d, 0x6f, 0x6e, 0x6c, 0x79, 0x22, 0x3e, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 
+	0x72, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x73, 0x73, 
+	0x69, 0x64, 0x22, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x3e, 0x53, 0x53, 0x49, 
+	0x44, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x3e, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 
+	0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x68, 0x65, 0x6c, 
+	0x70, 0x65, 0x72, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 
+	0x57, 0x69, 0x2d, 0x46, 0x69, 0x20, 0x6e, 0x65, 0x74, 0x77, 
+	0x6f, 0x72, 0x6b, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x74, 
+	0x6f, 0x20, 0x6a, 0x6f, 0x69, 0x6e, 0x20, 0x69, 0x6e, 0x20, 
+	0x53, 0x54, 0x41, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x2c, 0x20, 
+	0x6f, 0x72, 0x20, 0x61, 0x20, 0x42, 0x53, 0x53, 0x49, 0x44, 
+	0x20, 0x69, 0x6e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x63, 0x6f, 0x64, 0x65, 0x3e, 0x78, 0x78, 
+	0x3a, 0x78, 0x78, 0x3a, 0x78, 0x78, 0x3a, 0x78, 0x78, 0x3a, 
+	0x78, 0x78, 0x3a, 0x78, 0x78, 0x3c, 0x2f, 0x63, 0x6f, 0x64, 
+	0x65, 0x3e, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x20, 
+	0x28, 0x75, 0x73, 0x65, 0x66, 0x75, 0x6c, 0x20, 0x66, 0x6f, 
+	0x72, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x65, 0x72, 
+	0x73, 0x2f, 0x6d, 0x65, 0x73, 0x68, 0x20, 0x6e, 0x6f, 0x64, 
+	0x65, 0x73, 0x29, 0x2e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 
+	0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 
+	0x64, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x73, 0x73, 
+	0x69, 0x64, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
+	0x77, 0x69, 0x66, 0x69, 0x2d, 0x73, 0x73, 0x69, 0x64, 0x22, 
+	0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 
+	0x3d, 0x22, 0x36, 0x33, 0x22, 0x20, 0x61, 0x75, 0x74, 0x6f, 
+	0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x3d, 0x22, 
+	0x6f, 0x66, 0x66, 0x22, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xa, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 
+	0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f, 
+	0x72, 0x6d, 0x2d, 0x72, 0x6f, 0x77, 0x20, 0x73, 0x74, 0x61, 
+	0x2d, 0x6f, 0x6e, 0x6c, 0x79, 0x22, 0x3e, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 
+	0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 
+	0x77, 0x69, 0x66, 0x69, 0x2d, 0x73, 0x63, 0x61, 0x6e, 0x22, 
+	0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x74, 0x72, 
+	0x6f, 0x6e, 0x67, 0x3e, 0x4e, 0x65, 0x61, 0x72, 0x62, 0x79, 
+	0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x3c, 
+	0x2f, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x3e, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 
+	0x61, 0x73, 0x73, 0x3d, 0x22, 0x68, 0x65, 0x6c, 0x70, 0x65, 
+	0x72, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x4e, 0x65, 
+	0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x20, 0x61, 0x72, 0x65, 
+	0x20, 0x6c, 0x69, 0x73, 0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 
+	0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 
+	0x66, 0x6f, 0x75, 0x6e, 0x64, 0x2e, 0x20, 0x43, 0x6c, 0x69, 
+	0x63, 0x6b, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x74, 0x6f, 0x20, 
+	0x75, 0x73, 0x65, 0x20, 0x69, 0x74, 0x73, 0x20, 0x53, 0x53, 
+	0x49, 0x44, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x75, 0x74, 0x68, 0x20, 
+	0x6d, 0x6f, 0x64, 0x65, 0x2e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 
+	0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x74, 
+	0x79, 0x70, 0x65, 0x3d, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 
+	0x6e, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x77, 0x69, 0x66, 
+	0x69, 0x2d, 0x73, 0x63, 0x61, 0x6e, 0x22, 0x20, 0x63, 0x6c, 
+	0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 0x74, 0x6e, 0x20, 0x62, 
+	0x74, 0x6e, 0x2d, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x61, 
+	0x72, 0x79, 0x22, 0x3e, 0x53, 0x63, 0x61, 0x6e, 0x3c, 0x2f, 
+	0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 
+	0x6c, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 
+	0x2d, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x22, 
+	0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x64, 0x65, 
+	0x76, 0x69, 0x63, 0x65, 0x2d, 0x6c, 0x69, 0x73, 0x74, 0x22, 
+	0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x67, 0x72, 
+	0x69, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x3a, 
+	0x20, 0x31, 0x20, 0x2f, 0x20, 0x2d, 0x31, 0x3b, 0x22, 0x3e, 
+	0x3c, 0x2f, 0x75, 0x6c, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xa, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 
+	0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f, 
+	0x72, 0x6d, 0x2d, 0x72, 0x6f, 0x77, 0x20, 0x73, 0x74, 0x61, 
+	0x2d, 0x6f, 0x6e, 0x6c, 0x79, 0x22, 0x3e, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 
+	0x61, 0x62, 0x65, 0x6c, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x3e, 0x53, 0x74, 
+	0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x74, 0x61, 0x74, 
+	0x75, 0x73, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 
+	0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 
+	0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x68, 0x65, 
+	0x6c, 0x70, 0x65, 0x72, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x22, 
+	0x3e, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x65, 0x73, 0x73, 0x20, 
+	0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 
+	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x52, 0x65, 0x6c, 
+	0x6f, 0x61, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 
+	0x67, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x66, 0x72, 
+	0x65, 0x73, 0x68, 0x20, 0x69, 0x74, 0x2e, 0x3c, 0x2f, 0x64, 
+	0x69, 0x76, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 
+	0x6c, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x69, 
+	0x64, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x73, 0x74, 
+	0x61, 0x2d, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22, 0x3e, 
+	0x3c, 0x21, 0x2d, 0x2d, 0x23, 0x57, 0x46, 0x49, 0x53, 0x54, 
+	0x41, 0x2d, 0x2d, 0x3e, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 
 	0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
+	0x64, 0x69, 0x76, 0x3e, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 
+	0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x72, 
+	0x6f, 0x77, 0x20, 0x73, 0x74, 0x61, 0x2d, 0x6f, 0x6e, 0x6c, 
+	0x79, 0x22, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 
-	0x69, 0x64, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x6d, 
-	0x6f, 0x64, 0x65, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 
-	0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x6d, 0x6f, 0x64, 0x65, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
+	0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 
+	0x2d, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x2d, 0x61, 0x64, 0x64, 
 	0x22, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6f, 0x70, 
-	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x3d, 0x22, 0x30, 0x22, 0x3e, 0x41, 0x63, 0x63, 0x65, 0x73, 
-	0x73, 0x20, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x3c, 0x2f, 0x6f, 
-	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x74, 
+	0x72, 0x6f, 0x6e, 0x67, 0x3e, 0x4b, 0x6e, 0x6f, 0x77, 0x6e, 
+	0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x3c, 
+	0x2f, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x3e, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 
+	0x61, 0x73, 0x73, 0x3d, 0x22, 0x68, 0x65, 0x6c, 0x70, 0x65, 
+	0x72, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x41, 0x6c, 
+	0x73, 0x6f, 0x20, 0x6a, 0x6f, 0x69, 0x6e, 0x65, 0x64, 0x20, 
+	0x69, 0x6e, 0x20, 0x53, 0x54, 0x41, 0x20, 0x6d, 0x6f, 0x64, 
+	0x65, 0x20, 0x62, 0x65, 0x73, 0x69, 0x64, 0x65, 0x73, 0x20, 
+	0x74, 0x68, 0x65, 0x20, 0x53, 0x53, 0x49, 0x44, 0x20, 0x61, 
+	0x62, 0x6f, 0x76, 0x65, 0x2e, 0x20, 0x41, 0x74, 0x20, 0x62, 
+	0x6f, 0x6f, 0x74, 0x20, 0x74, 0x68, 0x65, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x6f, 
+	0x6e, 0x67, 0x65, 0x73, 0x74, 0x20, 0x6f, 0x6e, 0x65, 0x20, 
+	0x69, 0x6e, 0x20, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x69, 
+	0x73, 0x20, 0x74, 0x72, 0x69, 0x65, 0x64, 0x20, 0x66, 0x69, 
+	0x72, 0x73, 0x74, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 
+	0x74, 0x68, 0x65, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x73, 
+	0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6f, 
+	0x72, 0x64, 0x65, 0x72, 0x2e, 0x20, 0x41, 0x64, 0x64, 0x20, 
+	0x73, 0x74, 0x6f, 0x72, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 
+	0x53, 0x49, 0x44, 0x2c, 0x20, 0x70, 0x61, 0x73, 0x73, 0x77, 
+	0x6f, 0x72, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x75, 
+	0x74, 0x68, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x65, 0x6e, 
+	0x74, 0x65, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 
+	0x68, 0x69, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x2e, 0x20, 
+	0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x73, 0x20, 0x61, 0x72, 
+	0x65, 0x20, 0x73, 0x61, 0x76, 0x65, 0x64, 0x20, 0x72, 0x69, 
+	0x67, 0x68, 0x74, 0x20, 0x61, 0x77, 0x61, 0x79, 0x2e, 0x3c, 
+	0x2f, 0x64, 0x69, 0x76, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 
+	0x62, 0x65, 0x6c, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x62, 0x75, 0x74, 0x74, 
+	0x6f, 0x6e, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x62, 
+	0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x20, 0x69, 0x64, 0x3d, 
+	0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x6b, 0x6e, 0x6f, 0x77, 
+	0x6e, 0x2d, 0x61, 0x64, 0x64, 0x22, 0x20, 0x63, 0x6c, 0x61, 
+	0x73, 0x73, 0x3d, 0x22, 0x62, 0x74, 0x6e, 0x20, 0x62, 0x74, 
+	0x6e, 0x2d, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x61, 0x72, 
+	0x79, 0x22, 0x3e, 0x41, 0x64, 0x64, 0x20, 0x6e, 0x65, 0x74, 
+	0x77, 0x6f, 0x72, 0x6b, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 
+	0x6f, 0x6e, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6c, 0x20, 0x69, 0x64, 
+	0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x6b, 0x6e, 0x6f, 
+	0x77, 0x6e, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 
+	0x22, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x6c, 0x69, 
+	0x73, 0x74, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 
+	0x22, 0x67, 0x72, 0x69, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x75, 
+	0x6d, 0x6e, 0x3a, 0x20, 0x31, 0x20, 0x2f, 0x20, 0x2d, 0x31, 
+	0x3b, 0x22, 0x3e, 0x3c, 0x2f, 0x75, 0x6c, 0x3e, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 
+	0x3e, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 
+	0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x72, 0x6f, 0x77, 0x20, 
+	0x73, 0x74, 0x61, 0x2d, 0x6f, 0x6e, 0x6c, 0x79, 0x22, 0x3e, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 
+	0x72, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x73, 0x74, 
+	0x61, 0x74, 0x69, 0x63, 0x2d, 0x69, 0x70, 0x22, 0x3e, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x74, 0x72, 0x6f, 0x6e, 
+	0x67, 0x3e, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x49, 
+	0x50, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x3e, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 
+	0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x68, 0x65, 0x6c, 
+	0x70, 0x65, 0x72, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 
+	0x4c, 0x65, 0x61, 0x76, 0x65, 0x20, 0x65, 0x6d, 0x70, 0x74, 
+	0x79, 0x20, 0x74, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x20, 0x44, 
+	0x48, 0x43, 0x50, 0x2e, 0x20, 0x4f, 0x74, 0x68, 0x65, 0x72, 
+	0x77, 0x69, 0x73, 0x65, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x64, 0x65, 0x3e, 0x69, 
+	0x70, 0x2c, 0x6e, 0x65, 0x74, 0x6d, 0x61, 0x73, 0x6b, 0x2c, 
+	0x67, 0x61, 0x74, 0x65, 0x77, 0x61, 0x79, 0x5b, 0x2c, 0x64, 
+	0x6e, 0x73, 0x5d, 0x3c, 0x2f, 0x63, 0x6f, 0x64, 0x65, 0x3e, 
+	0x2c, 0x20, 0x65, 0x2e, 0x67, 0x2e, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x64, 0x65, 
+	0x3e, 0x31, 0x39, 0x32, 0x2e, 0x31, 0x36, 0x38, 0x2e, 0x31, 
+	0x2e, 0x35, 0x30, 0x2c, 0x32, 0x35, 0x35, 0x2e, 0x32, 0x35, 
+	0x35, 0x2e, 0x32, 0x35, 0x35, 0x2e, 0x30, 0x2c, 0x31, 0x39, 
+	0x32, 0x2e, 0x31, 0x36, 0x38, 0x2e, 0x31, 0x2e, 0x31, 0x2c, 
+	0x31, 0x39, 0x32, 0x2e, 0x31, 0x36, 0x38, 0x2e, 0x31, 0x2e, 
+	0x31, 0x3c, 0x2f, 0x63, 0x6f, 0x64, 0x65, 0x3e, 0x2e, 0x3c, 
+	0x2f, 0x64, 0x69, 0x76, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 
+	0x62, 0x65, 0x6c, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 
+	0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 
+	0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x77, 0x69, 
+	0x66, 0x69, 0x2d, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2d, 
+	0x69, 0x70, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
+	0x77, 0x69, 0x66, 0x69, 0x2d, 0x73, 0x74, 0x61, 0x74, 0x69, 
+	0x63, 0x2d, 0x69, 0x70, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 
+	0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x36, 0x33, 0x22, 
+	0x20, 0x61, 0x75, 0x74, 0x6f, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 
+	0x65, 0x74, 0x65, 0x3d, 0x22, 0x6f, 0x66, 0x66, 0x22, 0x3e, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 
+	0x69, 0x76, 0x3e, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 
+	0x73, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x72, 0x6f, 
+	0x77, 0x20, 0x61, 0x70, 0x2d, 0x6f, 0x6e, 0x6c, 0x79, 0x22, 
+	0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 
+	0x6f, 0x72, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x61, 
+	0x70, 0x2d, 0x63, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x22, 
+	0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x74, 0x72, 
+	0x6f, 0x6e, 0x67, 0x3e, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 
+	0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x68, 0x61, 
+	0x6e, 0x6e, 0x65, 0x6c, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x6f, 
+	0x6e, 0x67, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 
+	0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 
+	0x68, 0x65, 0x6c, 0x70, 0x65, 0x72, 0x2d, 0x74, 0x65, 0x78, 
+	0x74, 0x22, 0x3e, 0x3c, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 
+	0x3e, 0x4c, 0x65, 0x61, 0x73, 0x74, 0x20, 0x63, 0x6f, 0x6e, 
+	0x67, 0x65, 0x73, 0x74, 0x65, 0x64, 0x3c, 0x2f, 0x73, 0x74, 
+	0x72, 0x6f, 0x6e, 0x67, 0x3e, 0x20, 0x73, 0x75, 0x72, 0x76, 
+	0x65, 0x79, 0x73, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x6e, 0x65, 
+	0x6c, 0x73, 0x20, 0x31, 0x2c, 0x20, 0x36, 0x20, 0x61, 0x6e, 
+	0x64, 0x20, 0x31, 0x31, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 
+	0x73, 0x74, 0x61, 0x72, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 
+	0x68, 0x65, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 
+	0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+	0x70, 0x69, 0x63, 0x6b, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 
+	0x6f, 0x6e, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x66, 
+	0x65, 0x77, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x77, 
+	0x65, 0x61, 0x6b, 0x65, 0x72, 0x20, 0x6e, 0x65, 0x74, 0x77, 
+	0x6f, 0x72, 0x6b, 0x73, 0x2e, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x49, 0x6e, 0x20, 0x41, 0x63, 0x63, 
+	0x65, 0x73, 0x73, 0x20, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x20, 
+	0x2b, 0x20, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x6d, 0x6f, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 
+	0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x70, 0x6f, 0x69, 0x6e, 
+	0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x74, 0x6f, 
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 
+	0x6f, 0x6e, 0x27, 0x73, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x6e, 
+	0x65, 0x6c, 0x20, 0x6f, 0x6e, 0x63, 0x65, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x74, 0x20, 0x6a, 
+	0x6f, 0x69, 0x6e, 0x73, 0x2e, 0x20, 0x43, 0x75, 0x72, 0x72, 
+	0x65, 0x6e, 0x74, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x6e, 0x65, 
+	0x6c, 0x3a, 0x20, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x69, 
+	0x64, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x61, 0x70, 
+	0x2d, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x22, 0x3e, 
+	0x3c, 0x21, 0x2d, 0x2d, 0x23, 0x57, 0x46, 0x49, 0x43, 0x48, 
+	0x41, 0x4e, 0x2d, 0x2d, 0x3e, 0x3c, 0x2f, 0x73, 0x70, 0x61, 
+	0x6e, 0x3e, 0x2e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x69, 0x64, 0x3d, 
+	0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x61, 0x70, 0x2d, 0x63, 
+	0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x22, 0x20, 0x6e, 0x61, 
+	0x6d, 0x65, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x61, 
+	0x70, 0x2d, 0x63, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x22, 
+	0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6f, 0x70, 0x74, 
+	0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
+	0x22, 0x30, 0x22, 0x3e, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 
+	0x74, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
+	0x2d, 0x31, 0x22, 0x3e, 0x4c, 0x65, 0x61, 0x73, 0x74, 0x20, 
+	0x63, 0x6f, 0x6e, 0x67, 0x65, 0x73, 0x74, 0x65, 0x64, 0x20, 
+	0x28, 0x31, 0x2f, 0x36, 0x2f, 0x31, 0x31, 0x29, 0x3c, 0x2f, 
+	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x3e, 
+	0x31, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
+	0x36, 0x22, 0x3e, 0x36, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 
+	0x6f, 0x6e, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6f, 
+	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+	0x65, 0x3d, 0x22, 0x31, 0x31, 0x22, 0x3e, 0x31, 0x31, 0x3c, 
+	0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 
+	0x3e, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 
+	0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x72, 0x6f, 0x77, 0x22, 
+	0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 
+	0x6f, 0x72, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x70, 
+	0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x3e, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x74, 0x72, 0x6f, 0x6e, 
+	0x67, 0x3e, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 
+	0x3c, 0x2f, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x3e, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 
+	0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x68, 0x65, 0x6c, 0x70, 
+	0x65, 0x72, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x57, 
+	0x69, 0x2d, 0x46, 0x69, 0x20, 0x70, 0x61, 0x73, 0x73, 0x77, 
+	0x6f, 0x72, 0x64, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x62, 
+	0x79, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x41, 0x50, 0x20, 
+	0x61, 0x6e, 0x64, 0x20, 0x53, 0x54, 0x41, 0x20, 0x6d, 0x6f, 
+	0x64, 0x65, 0x73, 0x2e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 
+	0x3d, 0x22, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 
+	0x2d, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x22, 0x3e, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 
+	0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x70, 0x61, 0x73, 0x73, 
+	0x77, 0x6f, 0x72, 0x64, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x77, 0x69, 0x66, 0x69, 0x2d, 0x70, 0x61, 0x73, 0x73, 0x77, 
+	0x6f, 0x72, 0x64, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 
+	0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x70, 0x61, 0x73, 0x73, 
+	0x77, 0x6f, 0x72, 0x64, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 
+	0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x36, 0x33, 0x22, 
+	0x20, 0x61, 0x75, 0x74, 0x6f, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 
+	0x65, 0x74, 0x65, 0x3d, 0x22, 0x6f, 0x66, 0x66, 0x22, 0x3e, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x62, 0x75, 0x74, 0x74, 
+	0x6f, 0x6e, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x62, 
+	0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x20, 0x69, 0x64, 0x3d, 
+	0x22, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x2d, 0x70, 0x61, 
+	0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x2d, 0x76, 0x69, 0x73, 
+	0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x22, 0x20, 0x63, 
+	0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x65, 0x79, 0x65, 0x2d, 
+	0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x22, 0x20, 0x61, 0x72, 
+	0x69, 0x61, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3d, 0x22, 
+	0x53, 0x68, 0x6f, 0x77, 0x20, 0x70, 0x61, 0x73, 0x73, 0x77, 
+	0x6f, 0x72, 0x64, 0x22, 0x20, 0x74, 0x69, 0x74, 0x6c, 0x65, 
+	0x3d, 0x22, 0x53, 0x68, 0x6f, 0x77, 0x20, 0x70, 0x61, 0x73, 
+	0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x3e, 0x3c, 0x2f, 0x62, 
+	0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 
+	0x69, 0x76, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xa, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 
+	0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 
+	0x2d, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 
+	0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x77, 
+	0x69, 0x66, 0x69, 0x2d, 0x61, 0x75, 0x74, 0x68, 0x22, 0x3e, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x74, 0x72, 0x6f, 
+	0x6e, 0x67, 0x3e, 0x41, 0x75, 0x74, 0x68, 0x20, 0x6d, 0x6f, 
+	0x64, 0x65, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 
+	0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 
+	0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x68, 0x65, 
+	0x6c, 0x70, 0x65, 0x72, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x22, 
+	0x3e, 0x41, 0x75, 0x74, 0x68, 0x65, 0x6e, 0x74, 0x69, 0x63, 
+	0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x6f, 0x64, 0x65, 
+	0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x62, 
+	0x6f, 0x74, 0x68, 0x20, 0x41, 0x50, 0x20, 0x61, 0x6e, 0x64, 
+	0x20, 0x53, 0x54, 0x41, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x73, 
+	0x2e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
+	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 
+	0x6c, 0x65, 0x63, 0x74, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x77, 
+	0x69, 0x66, 0x69, 0x2d, 0x61, 0x75, 0x74, 0x68, 0x22, 0x20, 
+	0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 
+	0x2d, 0x61, 0x75, 0x74, 0x68, 0x22, 0x3e, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x3e, 
+	0x4f, 0x50, 0x45, 0x4e, 0x20, 0x28, 0x6e, 0x6f, 0x20, 0x70, 
+	0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x29, 0x3c, 0x2f, 
+	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x32, 0x22, 0x3e, 
+	0x57, 0x50, 0x41, 0x2d, 0x54, 0x4b, 0x49, 0x50, 0x2d, 0x50, 
+	0x53, 0x4b, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+	0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6f, 0x70, 0x74, 
+	0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 
+	0x22, 0x35, 0x22, 0x3e, 0x57, 0x50, 0x41, 0x32, 0x2d, 0x41, 
+	0x45, 0x53, 0x2d, 0x50, 0x53, 0x4b, 0x3c, 0x2f, 0x6f, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 
+	0x6c, 0x75, 0x65, 0x3d, 0x22, 0x38, 0x22, 0x3e, 0x57, 0x50, 
+	0x41, 0x32, 0x2d, 0x4d, 0x49, 0x58, 0x45, 0x44, 0x2d, 0x50, 
+	0x53, 0x4b, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+	0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
+	0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
+	0x64, 0x69, 0x76, 0x3e, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 
+	0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x61, 
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x22, 0x3e, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x74, 0x79, 0x70, 
+	0x65, 0x3d, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 
+	0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x61, 0x76, 0x65, 0x2d, 
+	0x77, 0x69, 0x66, 0x69, 0x2d, 0x63, 0x6f, 0x6e, 0x66, 0x69, 
+	0x67, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 
+	0x62, 0x74, 0x6e, 0x22, 0x3e, 0x53, 0x61, 0x76, 0x65, 0x20, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x3c, 0x2f, 
+	0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x62, 
+	0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x74, 0x79, 0x70, 0x65, 
+	0x3d, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x20, 
+	0x69, 0x64, 0x3d, 0x22, 0x72, 0x65, 0x73, 0x65, 0x74, 0x2d, 
+	0x77, 0x69, 0x66, 0x69, 0x2d, 0x63, 0x6f, 0x6e, 0x66, 0x69, 
+	0x67, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 
+	0x62, 0x74, 0x6e, 0x20, 0x62, 0x74, 0x6e, 0x2d, 0x73, 0x65, 
+	0x63, 0x6f, 0x6e, 0x64, 0x61, 0x72, 0x79, 0x22, 0x3e, 0x52, 
+	0x65, 0x73, 0x65, 0x74, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 
+	0x6f, 0x6e, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 0x63, 
+	0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x2f, 0x6d, 0x61, 0x69, 0x6e, 0x3e, 0xa, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x66, 0x6f, 0x6f, 0x74, 0x65, 0x72, 
+	0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f, 
+	0x6f, 0x74, 0x65, 0x72, 0x22, 0x3e, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x3e, 0x26, 0x63, 
+	0x6f, 0x70, 0x79, 0x3b, 0x20, 0x32, 0x30, 0x32, 0x36, 0x20, 
+	0x47, 0x4f, 0x4f, 0x44, 0x44, 0x41, 0x54, 0x41, 0x20, 0x4c, 
+	0x41, 0x42, 0x53, 0x20, 0x53, 0x4c, 0x55, 0x2e, 0x20, 0x41, 
+	0x6c, 0x6c, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 
+	0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x2e, 0x3c, 
+	0x2f, 0x70, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
+	0x66, 0x6f, 0x6f, 0x74, 0x65, 0x72, 0x3e, 0xa, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 
+	0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 
+	0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x42, 0x6f, 0x78, 
+	0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
+	0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 
+	0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x77, 0x69, 
+	0x66, 0x69, 0x2d, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22, 
+	0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x77, 
+	0x69, 0x66, 0x69, 0x4d, 0x6f, 0x64, 0x65, 0x20, 0x3d, 0x20, 
+	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 
+	0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 
+	0x79, 0x49, 0x64, 0x28, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 
+	0x6d, 0x6f, 0x64, 0x65, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x76, 0x61, 0x72, 0x20, 0x77, 0x69, 0x66, 0x69, 0x48, 0x6f, 
+	0x73, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x64, 
+	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 
+	0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 
+	0x49, 0x64, 0x28, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x68, 
+	0x6f, 0x73, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x29, 0x3b, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x77, 0x69, 0x66, 
+	0x69, 0x53, 0x73, 0x69, 0x64, 0x20, 0x3d, 0x20, 0x64, 0x6f, 
+	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 
+	0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 
+	0x64, 0x28, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x73, 0x73, 
+	0x69, 0x64, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 
+	0x72, 0x20, 0x77, 0x69, 0x66, 0x69, 0x50, 0x61, 0x73, 0x73, 
+	0x77, 0x6f, 0x72, 0x64, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 
+	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 
+	0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 
+	0x28, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x70, 0x61, 0x73, 
+	0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x29, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x76, 0x61, 0x72, 0x20, 0x74, 0x6f, 0x67, 0x67, 0x6c, 
+	0x65, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x56, 
+	0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 
+	0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
+	0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 
+	0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x74, 0x6f, 0x67, 
+	0x67, 0x6c, 0x65, 0x2d, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 
+	0x72, 0x64, 0x2d, 0x76, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 
+	0x69, 0x74, 0x79, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
+	0x61, 0x72, 0x20, 0x77, 0x69, 0x66, 0x69, 0x41, 0x75, 0x74, 
+	0x68, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 
+	0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 
+	0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x77, 
+	0x69, 0x66, 0x69, 0x2d, 0x61, 0x75, 0x74, 0x68, 0x22, 0x29, 
+	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x73, 0x74, 
+	0x61, 0x4f, 0x6e, 0x6c, 0x79, 0x52, 0x6f, 0x77, 0x73, 0x20, 
+	0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
+	0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 
+	0x63, 0x74, 0x6f, 0x72, 0x41, 0x6c, 0x6c, 0x28, 0x22, 0x2e, 
+	0x73, 0x74, 0x61, 0x2d, 0x6f, 0x6e, 0x6c, 0x79, 0x22, 0x29, 
+	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x61, 0x70, 
+	0x4f, 0x6e, 0x6c, 0x79, 0x52, 0x6f, 0x77, 0x73, 0x20, 0x3d, 
+	0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
+	0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 
+	0x74, 0x6f, 0x72, 0x41, 0x6c, 0x6c, 0x28, 0x22, 0x2e, 0x61, 
+	0x70, 0x2d, 0x6f, 0x6e, 0x6c, 0x79, 0x22, 0x29, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x77, 0x69, 0x66, 0x69, 
+	0x41, 0x70, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x20, 
+	0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
+	0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 
+	0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x77, 0x69, 0x66, 
+	0x69, 0x2d, 0x61, 0x70, 0x2d, 0x63, 0x68, 0x61, 0x6e, 0x6e, 
+	0x65, 0x6c, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 
+	0x72, 0x20, 0x77, 0x69, 0x66, 0x69, 0x53, 0x74, 0x61, 0x74, 
+	0x69, 0x63, 0x49, 0x70, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 
+	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 
+	0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 
+	0x28, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x73, 0x74, 0x61, 
+	0x74, 0x69, 0x63, 0x2d, 0x69, 0x70, 0x22, 0x29, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x6b, 0x6e, 0x6f, 0x77, 
+	0x6e, 0x41, 0x64, 0x64, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 
+	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 
+	0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 
+	0x28, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x6b, 0x6e, 0x6f, 
+	0x77, 0x6e, 0x2d, 0x61, 0x64, 0x64, 0x22, 0x29, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x6b, 0x6e, 0x6f, 0x77, 
+	0x6e, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x3d, 0x20, 0x64, 0x6f, 
+	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 
+	0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 
+	0x64, 0x28, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x6b, 0x6e, 
+	0x6f, 0x77, 0x6e, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
+	0x61, 0x72, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x42, 0x75, 0x74, 
+	0x74, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 
+	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 
+	0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 
+	0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x73, 0x63, 0x61, 0x6e, 
+	0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 
+	0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x4c, 0x69, 
+	0x73, 0x74, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 
+	0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 
+	0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 
+	0x77, 0x69, 0x66, 0x69, 0x2d, 0x6e, 0x65, 0x74, 0x77, 0x6f, 
+	0x72, 0x6b, 0x73, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
+	0x61, 0x72, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x20, 0x3d, 0x20, 
+	0x7b, 0x20, 0x65, 0x70, 0x6f, 0x63, 0x68, 0x3a, 0x20, 0x6e, 
+	0x75, 0x6c, 0x6c, 0x2c, 0x20, 0x67, 0x65, 0x6e, 0x3a, 0x20, 
+	0x30, 0x2c, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 
+	0x73, 0x3a, 0x20, 0x7b, 0x7d, 0x2c, 0x20, 0x74, 0x69, 0x6d, 
+	0x65, 0x72, 0x3a, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x20, 0x7d, 
+	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x65, 0x79, 
+	0x65, 0x4f, 0x70, 0x65, 0x6e, 0x53, 0x76, 0x67, 0x20, 0x3d, 
+	0x20, 0x27, 0x3c, 0x73, 0x76, 0x67, 0x20, 0x76, 0x69, 0x65, 
+	0x77, 0x42, 0x6f, 0x78, 0x3d, 0x22, 0x30, 0x20, 0x30, 0x20, 
+	0x32, 0x34, 0x20, 0x32, 0x34, 0x22, 0x20, 0x61, 0x72, 0x69, 
+	0x61, 0x2d, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x3d, 0x22, 
+	0x74, 0x72, 0x75, 0x65, 0x22, 0x20, 0x66, 0x6f, 0x63, 0x75, 
+	0x73, 0x61, 0x62, 0x6c, 0x65, 0x3d, 0x22, 0x66, 0x61, 0x6c, 
+	0x73, 0x65, 0x22, 0x3e, 0x3c, 0x70, 0x61, 0x74, 0x68, 0x20, 
+	0x64, 0x3d, 0x22, 0x4d, 0x31, 0x32, 0x20, 0x35, 0x63, 0x2d, 
+	0x34, 0x2e, 0x39, 0x37, 0x20, 0x30, 0x2d, 0x39, 0x2e, 0x32, 
+	0x37, 0x20, 0x32, 0x2e, 0x39, 0x38, 0x2d, 0x31, 0x31, 0x20, 
+	0x37, 0x20, 0x31, 0x2e, 0x37, 0x33, 0x20, 0x34, 0x2e, 0x30, 
+	0x32, 0x20, 0x36, 0x2e, 0x30, 0x33, 0x20, 0x37, 0x20, 0x31, 
+	0x31, 0x20, 0x37, 0x73, 0x39, 0x2e, 0x32, 0x37, 0x2d, 0x32, 
+	0x2e, 0x39, 0x38, 0x20, 0x31, 0x31, 0x2d, 0x37, 0x63, 0x2d, 
+	0x31, 0x2e, 0x37, 0x33, 0x2d, 0x34, 0x2e, 0x30, 0x32, 0x2d, 
+	0x36, 0x2e, 0x30, 0x33, 0x2d, 0x37, 0x2d, 0x31, 0x31, 0x2d, 
+	0x37, 0x7a, 0x6d, 0x30, 0x20, 0x31, 0x32, 0x61, 0x35, 0x20, 
+	0x35, 0x20, 0x30, 0x20, 0x31, 0x20, 0x31, 0x20, 0x30, 0x2d, 
+	0x31, 0x30, 0x20, 0x35, 0x20, 0x35, 0x20, 0x30, 0x20, 0x30, 
+	0x20, 0x31, 0x20, 0x30, 0x20, 0x31, 0x30, 0x7a, 0x6d, 0x30, 
+	0x2d, 0x38, 0x61, 0x33, 0x20, 0x33, 0x20, 0x30, 0x20, 0x31, 
+	0x20, 0x30, 0x20, 0x30, 0x20, 0x36, 0x20, 0x33, 0x20, 0x33, 
+	0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x2d, 0x36, 
+	0x7a, 0x22, 0x2f, 0x3e, 0x3c, 0x2f, 0x73, 0x76, 0x67, 0x3e, 
+	0x27, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x65, 
+	0x79, 0x65, 0x43, 0x6c, 0x6f, 0x73, 0x65, 0x64, 0x53, 0x76, 
+	0x67, 0x20, 0x3d, 0x20, 0x27, 0x3c, 0x73, 0x76, 0x67, 0x20, 
+	0x76, 0x69, 0x65, 0x77, 0x42, 0x6f, 0x78, 0x3d, 0x22, 0x30, 
+	0x20, 0x30, 0x20, 0x32, 0x34, 0x20, 0x32, 0x34, 0x22, 0x20, 
+	0x61, 0x72, 0x69, 0x61, 0x2d, 0x68, 0x69, 0x64, 0x64, 0x65, 
+	0x6e, 0x3d, 0x22, 0x74, 0x72, 0x75, 0x65, 0x22, 0x20, 0x66, 
+	0x6f, 0x63, 0x75, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3d, 0x22, 
+	0x66, 0x61, 0x6c, 0x73, 0x65, 0x22, 0x3e, 0x3c, 0x70, 0x61, 
+	0x74, 0x68, 0x20, 0x64, 0x3d, 0x22, 0x4d, 0x33, 0x2e, 0x32, 
+	0x37, 0x20, 0x32, 0x4c, 0x32, 0x20, 0x33, 0x2e, 0x32, 0x37, 
+	0x6c, 0x33, 0x20, 0x33, 0x41, 0x31, 0x31, 0x2e, 0x37, 0x32, 
+	0x20, 0x31, 0x31, 0x2e, 0x37, 0x32, 0x20, 0x30, 0x20, 0x30, 
+	0x20, 0x30, 0x20, 0x31, 0x20, 0x31, 0x32, 0x63, 0x31, 0x2e, 
+	0x37, 0x33, 0x20, 0x34, 0x2e, 0x30, 0x32, 0x20, 0x36, 0x2e, 
+	0x30, 0x33, 0x20, 0x37, 0x20, 0x31, 0x31, 0x20, 0x37, 0x20, 
+	0x32, 0x2e, 0x30, 0x38, 0x20, 0x30, 0x20, 0x34, 0x2e, 0x30, 
+	0x33, 0x2d, 0x2e, 0x35, 0x32, 0x20, 0x35, 0x2e, 0x37, 0x33, 
+	0x2d, 0x31, 0x2e, 0x34, 0x33, 0x4c, 0x32, 0x30, 0x2e, 0x37, 
+	0x33, 0x20, 0x32, 0x31, 0x20, 0x32, 0x32, 0x20, 0x31, 0x39, 
+	0x2e, 0x37, 0x33, 0x20, 0x33, 0x2e, 0x32, 0x37, 0x20, 0x32, 
+	0x7a, 0x4d, 0x31, 0x32, 0x20, 0x31, 0x37, 0x63, 0x2d, 0x32, 
+	0x2e, 0x37, 0x36, 0x20, 0x30, 0x2d, 0x35, 0x2d, 0x32, 0x2e, 
+	0x32, 0x34, 0x2d, 0x35, 0x2d, 0x35, 0x20, 0x30, 0x2d, 0x2e, 
+	0x37, 0x32, 0x2e, 0x31, 0x35, 0x2d, 0x31, 0x2e, 0x34, 0x2e, 
+	0x34, 0x33, 0x2d, 0x32, 0x2e, 0x30, 0x31, 0x6c, 0x31, 0x2e, 
+	0x35, 0x39, 0x20, 0x31, 0x2e, 0x35, 0x39, 0x41, 0x33, 0x20, 
+	0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x32, 
+	0x20, 0x31, 0x35, 0x63, 0x2e, 0x35, 0x32, 0x20, 0x30, 0x20, 
+	0x31, 0x2e, 0x30, 0x32, 0x2d, 0x2e, 0x31, 0x33, 0x20, 0x31, 
+	0x2e, 0x34, 0x35, 0x2d, 0x2e, 0x33, 0x36, 0x6c, 0x31, 0x2e, 
+	0x35, 0x39, 0x20, 0x31, 0x2e, 0x35, 0x39, 0x63, 0x2d, 0x2e, 
+	0x39, 0x32, 0x2e, 0x34, 0x39, 0x2d, 0x31, 0x2e, 0x39, 0x37, 
+	0x2e, 0x37, 0x37, 0x2d, 0x33, 0x2e, 0x30, 0x34, 0x2e, 0x37, 
+	0x37, 0x7a, 0x4d, 0x31, 0x32, 0x20, 0x37, 0x63, 0x32, 0x2e, 
+	0x37, 0x36, 0x20, 0x30, 0x20, 0x35, 0x20, 0x32, 0x2e, 0x32, 
+	0x34, 0x20, 0x35, 0x20, 0x35, 0x20, 0x30, 0x20, 0x2e, 0x36, 
+	0x36, 0x2d, 0x2e, 0x31, 0x33, 0x20, 0x31, 0x2e, 0x33, 0x2d, 
+	0x2e, 0x33, 0x37, 0x20, 0x31, 0x2e, 0x38, 0x38, 0x6c, 0x33, 
+	0x2e, 0x30, 0x37, 0x20, 0x33, 0x2e, 0x30, 0x37, 0x41, 0x31, 
+	0x31, 0x2e, 0x35, 0x38, 0x20, 0x31, 0x31, 0x2e, 0x35, 0x38, 
+	0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x33, 0x20, 
+	0x31, 0x32, 0x63, 0x2d, 0x31, 0x2e, 0x37, 0x33, 0x2d, 0x34, 
+	0x2e, 0x30, 0x32, 0x2d, 0x36, 0x2e, 0x30, 0x33, 0x2d, 0x37, 
+	0x2d, 0x31, 0x31, 0x2d, 0x37, 0x2d, 0x31, 0x2e, 0x35, 0x20, 
+	0x30, 0x2d, 0x32, 0x2e, 0x39, 0x34, 0x2e, 0x32, 0x37, 0x2d, 
+	0x34, 0x2e, 0x32, 0x37, 0x2e, 0x37, 0x36, 0x6c, 0x32, 0x2e, 
+	0x33, 0x39, 0x20, 0x32, 0x2e, 0x33, 0x39, 0x43, 0x31, 0x30, 
+	0x2e, 0x37, 0x20, 0x37, 0x2e, 0x34, 0x31, 0x20, 0x31, 0x31, 
+	0x2e, 0x33, 0x33, 0x20, 0x37, 0x20, 0x31, 0x32, 0x20, 0x37, 
+	0x7a, 0x22, 0x2f, 0x3e, 0x3c, 0x2f, 0x73, 0x76, 0x67, 0x3e, 
+	0x27, 0x3b, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 
+	0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x53, 0x74, 0x61, 
+	0x74, 0x65, 0x20, 0x3d, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x3a, 0x20, 0x22, 
+	0x3c, 0x21, 0x2d, 0x2d, 0x23, 0x57, 0x46, 0x49, 0x4d, 0x4f, 
+	0x44, 0x45, 0x2d, 0x2d, 0x3e, 0x22, 0x2e, 0x74, 0x72, 0x69, 
+	0x6d, 0x28, 0x29, 0x20, 0x7c, 0x7c, 0x20, 0x22, 0x30, 0x22, 
+	0x2c, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x6f, 
+	0x73, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x3a, 0x20, 0x22, 0x3c, 
+	0x21, 0x2d, 0x2d, 0x23, 0x57, 0x46, 0x49, 0x48, 0x4f, 0x53, 
+	0x54, 0x2d, 0x2d, 0x3e, 0x22, 0x2e, 0x74, 0x72, 0x69, 0x6d, 
+	0x28, 0x29, 0x20, 0x7c, 0x7c, 0x20, 0x22, 0x63, 0x72, 0x6f, 
+	0x69, 0x73, 0x73, 0x61, 0x6e, 0x74, 0x22, 0x2c, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x73, 0x69, 0x64, 0x3a, 
+	0x20, 0x22, 0x3c, 0x21, 0x2d, 0x2d, 0x23, 0x57, 0x46, 0x49, 
+	0x53, 0x53, 0x49, 0x44, 0x2d, 0x2d, 0x3e, 0x22, 0x2e, 0x74, 
+	0x72, 0x69, 0x6d, 0x28, 0x29, 0x20, 0x7c, 0x7c, 0x20, 0x22, 
+	0x22, 0x2c, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 
+	0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x3a, 0x20, 0x22, 
+	0x3c, 0x21, 0x2d, 0x2d, 0x23, 0x57, 0x46, 0x49, 0x50, 0x41, 
+	0x53, 0x53, 0x2d, 0x2d, 0x3e, 0x22, 0x2e, 0x74, 0x72, 0x69, 
+	0x6d, 0x28, 0x29, 0x20, 0x7c, 0x7c, 0x20, 0x22, 0x22, 0x2c, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x75, 0x74, 
+	0x68, 0x3a, 0x20, 0x22, 0x3c, 0x21, 0x2d, 0x2d, 0x23, 0x57, 
+	0x46, 0x49, 0x41, 0x55, 0x54, 0x48, 0x2d, 0x2d, 0x3e, 0x22, 
+	0x2e, 0x74, 0x72, 0x69, 0x6d, 0x28, 0x29, 0x20, 0x7c, 0x7c, 
+	0x20, 0x22, 0x30, 0x22, 0x2c, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x61, 0x70, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 
+	0x6c, 0x3a, 0x20, 0x22, 0x3c, 0x21, 0x2d, 0x2d, 0x23, 0x57, 
+	0x46, 0x49, 0x41, 0x50, 0x43, 0x48, 0x2d, 0x2d, 0x3e, 0x22, 
+	0x2e, 0x74, 0x72, 0x69, 0x6d, 0x28, 0x29, 0x20, 0x7c, 0x7c, 
+	0x20, 0x22, 0x30, 0x22, 0x2c, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x49, 0x70, 
+	0x3a, 0x20, 0x22, 0x3c, 0x21, 0x2d, 0x2d, 0x23, 0x57, 0x46, 
+	0x49, 0x53, 0x54, 0x49, 0x50, 0x2d, 0x2d, 0x3e, 0x22, 0x2e, 
+	0x74, 0x72, 0x69, 0x6d, 0x28, 0x29, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
+	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x72, 0x65, 
+	0x73, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x65, 0x20, 0x3d, 
+	0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 
+	0x6f, 0x64, 0x65, 0x3a, 0x20, 0x22, 0x30, 0x22, 0x2c, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x6f, 0x73, 0x74, 
+	0x6e, 0x61, 0x6d, 0x65, 0x3a, 0x20, 0x22, 0x63, 0x72, 0x6f, 
+	0x69, 0x73, 0x73, 0x61, 0x6e, 0x74, 0x22, 0x2c, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x73, 0x69, 0x64, 0x3a, 
+	0x20, 0x22, 0x22, 0x2c, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x3a, 
+	0x20, 0x22, 0x73, 0x69, 0x64, 0x65, 0x63, 0x61, 0x72, 0x74, 
+	0x22, 0x2c, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 
+	0x75, 0x74, 0x68, 0x3a, 0x20, 0x22, 0x35, 0x22, 0x2c, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x43, 0x68, 
+	0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x3a, 0x20, 0x22, 0x30, 0x22, 
+	0x2c, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 
+	0x61, 0x74, 0x69, 0x63, 0x49, 0x70, 0x3a, 0x20, 0x22, 0x22, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x7d, 0x3b, 0xa, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 
+	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x68, 
+	0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x6b, 
+	0x69, 0x6e, 0x64, 0x2c, 0x20, 0x6d, 0x65, 0x73, 0x73, 0x61, 
+	0x67, 0x65, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x42, 0x6f, 
+	0x78, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 
+	0x65, 0x20, 0x3d, 0x20, 0x22, 0x62, 0x61, 0x6e, 0x6e, 0x65, 
+	0x72, 0x20, 0x22, 0x20, 0x2b, 0x20, 0x28, 0x6b, 0x69, 0x6e, 
+	0x64, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x22, 0x65, 0x72, 0x72, 
+	0x6f, 0x72, 0x22, 0x20, 0x3f, 0x20, 0x22, 0x62, 0x61, 0x6e, 
+	0x6e, 0x65, 0x72, 0x2d, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 
+	0x20, 0x3a, 0x20, 0x22, 0x62, 0x61, 0x6e, 0x6e, 0x65, 0x72, 
+	0x2d, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x22, 0x29, 
+	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 
+	0x61, 0x74, 0x75, 0x73, 0x42, 0x6f, 0x78, 0x2e, 0x74, 0x65, 
+	0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 
+	0x3d, 0x20, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x3b, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 
+	0x74, 0x75, 0x73, 0x42, 0x6f, 0x78, 0x2e, 0x73, 0x74, 0x79, 
+	0x6c, 0x65, 0x2e, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 
+	0x20, 0x3d, 0x20, 0x22, 0x66, 0x6c, 0x65, 0x78, 0x22, 0x3b, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x7d, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 
+	0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x6c, 0x65, 
+	0x61, 0x72, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x29, 
+	0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
+	0x74, 0x61, 0x74, 0x75, 0x73, 0x42, 0x6f, 0x78, 0x2e, 0x73, 
+	0x74, 0x79, 0x6c, 0x65, 0x2e, 0x64, 0x69, 0x73, 0x70, 0x6c, 
+	0x61, 0x79, 0x20, 0x3d, 0x20, 0x22, 0x6e, 0x6f, 0x6e, 0x65, 
+	0x22, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
+	0x74, 0x61, 0x74, 0x75, 0x73, 0x42, 0x6f, 0x78, 0x2e, 0x74, 
+	0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 
+	0x20, 0x3d, 0x20, 0x22, 0x22, 0x3b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
+	0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x56, 
+	0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x28, 
+	0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x76, 0x61, 0x72, 0x20, 0x73, 0x74, 0x61, 0x4d, 0x6f, 0x64, 
+	0x65, 0x20, 0x3d, 0x20, 0x77, 0x69, 0x66, 0x69, 0x4d, 0x6f, 
+	0x64, 0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 
+	0x3d, 0x3d, 0x20, 0x22, 0x31, 0x22, 0x20, 0x7c, 0x7c, 0x20, 
+	0x77, 0x69, 0x66, 0x69, 0x4d, 0x6f, 0x64, 0x65, 0x2e, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x22, 
+	0x32, 0x22, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x73, 0x74, 0x61, 0x4f, 0x6e, 0x6c, 0x79, 0x52, 0x6f, 0x77, 
+	0x73, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 
+	0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 
+	0x72, 0x6f, 0x77, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6f, 0x77, 
+	0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x64, 0x69, 0x73, 
+	0x70, 0x6c, 0x61, 0x79, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x61, 
+	0x4d, 0x6f, 0x64, 0x65, 0x20, 0x3f, 0x20, 0x22, 0x67, 0x72, 
+	0x69, 0x64, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6e, 0x6f, 0x6e, 
+	0x65, 0x22, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x7d, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x61, 0x70, 0x4f, 0x6e, 0x6c, 0x79, 0x52, 0x6f, 0x77, 0x73, 
+	0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x66, 
+	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x72, 
+	0x6f, 0x77, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6f, 0x77, 0x2e, 
+	0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x64, 0x69, 0x73, 0x70, 
+	0x6c, 0x61, 0x79, 0x20, 0x3d, 0x20, 0x77, 0x69, 0x66, 0x69, 
+	0x4d, 0x6f, 0x64, 0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+	0x20, 0x21, 0x3d, 0x3d, 0x20, 0x22, 0x31, 0x22, 0x20, 0x3f, 
+	0x20, 0x22, 0x67, 0x72, 0x69, 0x64, 0x22, 0x20, 0x3a, 0x20, 
+	0x22, 0x6e, 0x6f, 0x6e, 0x65, 0x22, 0x3b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x7d, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x43, 0x59, 
+	0x57, 0x34, 0x33, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x20, 0x61, 
+	0x75, 0x74, 0x68, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x28, 
+	0x32, 0x3d, 0x57, 0x50, 0x41, 0x2c, 0x20, 0x34, 0x3d, 0x57, 
+	0x50, 0x41, 0x32, 0x29, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 
+	0x65, 0x20, 0x61, 0x75, 0x74, 0x68, 0x20, 0x6d, 0x6f, 0x64, 
+	0x65, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x61, 0x75, 0x74, 0x68, 0x46, 0x72, 0x6f, 0x6d, 0x53, 
+	0x63, 0x61, 0x6e, 0x28, 0x62, 0x69, 0x74, 0x73, 0x29, 0x20, 
+	0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+	0x20, 0x28, 0x62, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x3d, 0x3d, 
+	0x20, 0x30, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 
+	0x20, 0x7b, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x20, 
+	0x22, 0x30, 0x22, 0x2c, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
+	0x3a, 0x20, 0x22, 0x4f, 0x70, 0x65, 0x6e, 0x22, 0x20, 0x7d, 
+	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+	0x20, 0x28, 0x28, 0x62, 0x69, 0x74, 0x73, 0x20, 0x26, 0x20, 
+	0x36, 0x29, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x36, 0x29, 0x20, 
+	0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x7b, 0x20, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x3a, 0x20, 0x22, 0x38, 0x22, 0x2c, 
+	0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3a, 0x20, 0x22, 0x57, 
+	0x50, 0x41, 0x2f, 0x57, 0x50, 0x41, 0x32, 0x22, 0x20, 0x7d, 
+	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+	0x20, 0x28, 0x62, 0x69, 0x74, 0x73, 0x20, 0x26, 0x20, 0x34, 
+	0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x7b, 
+	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x20, 0x22, 0x35, 
+	0x22, 0x2c, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3a, 0x20, 
+	0x22, 0x57, 0x50, 0x41, 0x32, 0x22, 0x20, 0x7d, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 
+	0x62, 0x69, 0x74, 0x73, 0x20, 0x26, 0x20, 0x32, 0x29, 0x20, 
+	0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x7b, 0x20, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x3a, 0x20, 0x22, 0x32, 0x22, 0x2c, 
+	0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3a, 0x20, 0x22, 0x57, 
+	0x50, 0x41, 0x22, 0x20, 0x7d, 0x3b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 
+	0x7b, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x20, 0x22, 
+	0x30, 0x22, 0x2c, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3a, 
+	0x20, 0x22, 0x57, 0x45, 0x50, 0x22, 0x20, 0x7d, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x6e, 0x64, 
+	0x65, 0x72, 0x4e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73, 
+	0x28, 0x73, 0x63, 0x61, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x29, 
+	0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
+	0x61, 0x72, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x3d, 0x20, 
+	0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x2e, 0x6b, 0x65, 0x79, 
+	0x73, 0x28, 0x73, 0x63, 0x61, 0x6e, 0x2e, 0x6e, 0x65, 0x74, 
+	0x77, 0x6f, 0x72, 0x6b, 0x73, 0x29, 0x2e, 0x6d, 0x61, 0x70, 
+	0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x28, 0x6b, 0x65, 0x79, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 
+	0x74, 0x75, 0x72, 0x6e, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x2e, 
+	0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x5b, 0x6b, 
+	0x65, 0x79, 0x5d, 0x3b, 0x20, 0x7d, 0x29, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x2e, 
+	0x73, 0x6f, 0x72, 0x74, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 
+	0x69, 0x6f, 0x6e, 0x20, 0x28, 0x61, 0x2c, 0x20, 0x62, 0x29, 
+	0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 
+	0x62, 0x2e, 0x72, 0x73, 0x73, 0x69, 0x20, 0x2d, 0x20, 0x61, 
+	0x2e, 0x72, 0x73, 0x73, 0x69, 0x3b, 0x20, 0x7d, 0x29, 0x3b, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x65, 0x74, 
+	0x77, 0x6f, 0x72, 0x6b, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 
+	0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 0x4d, 0x4c, 0x20, 
+	0x3d, 0x20, 0x22, 0x22, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x73, 0x74, 
+	0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3d, 0x3d, 
+	0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x65, 0x74, 
+	0x77, 0x6f, 0x72, 0x6b, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 
+	0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 0x4d, 0x4c, 0x20, 
+	0x3d, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 
+	0x20, 0x3f, 0x20, 0x22, 0x3c, 0x6c, 0x69, 0x3e, 0x53, 0x63, 
+	0x61, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x6f, 0x72, 
+	0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x2e, 
+	0x2e, 0x2e, 0x3c, 0x2f, 0x6c, 0x69, 0x3e, 0x22, 0x20, 0x3a, 
+	0x20, 0x22, 0x3c, 0x6c, 0x69, 0x3e, 0x4e, 0x6f, 0x20, 0x6e, 
+	0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x20, 0x66, 0x6f, 
+	0x75, 0x6e, 0x64, 0x2e, 0x3c, 0x2f, 0x6c, 0x69, 0x3e, 0x22, 
+	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x2e, 0x66, 
+	0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6e, 
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x6e, 0x65, 0x74, 
+	0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x61, 0x75, 
+	0x74, 0x68, 0x20, 0x3d, 0x20, 0x61, 0x75, 0x74, 0x68, 0x46, 
+	0x72, 0x6f, 0x6d, 0x53, 0x63, 0x61, 0x6e, 0x28, 0x6e, 0x65, 
+	0x74, 0x2e, 0x61, 0x75, 0x74, 0x68, 0x29, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
+	0x61, 0x72, 0x20, 0x6c, 0x69, 0x20, 0x3d, 0x20, 0x64, 0x6f, 
+	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 
+	0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 
+	0x28, 0x22, 0x6c, 0x69, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x69, 
+	0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 
+	0x20, 0x3d, 0x20, 0x22, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 
+	0x2d, 0x63, 0x61, 0x72, 0x64, 0x22, 0x3b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x69, 
+	0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x75, 0x72, 
+	0x73, 0x6f, 0x72, 0x20, 0x3d, 0x20, 0x22, 0x70, 0x6f, 0x69, 
+	0x6e, 0x74, 0x65, 0x72, 0x22, 0x3b, 0xa, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 
+	0x72, 0x20, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x3d, 0x20, 0x64, 
+	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 
+	0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 
+	0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x6d, 0x65, 0x74, 0x61, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 
+	0x4e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x64, 0x65, 
+	0x76, 0x69, 0x63, 0x65, 0x2d, 0x6d, 0x65, 0x74, 0x61, 0x22, 
+	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
+	0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
+	0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 
+	0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 
+	0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x63, 
+	0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 
+	0x20, 0x22, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x6e, 
+	0x61, 0x6d, 0x65, 0x22, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
+	0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 
+	0x6e, 0x74, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x74, 0x2e, 0x73, 
+	0x73, 0x69, 0x64, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x61, 
+	0x64, 0x64, 0x72, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 
+	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 
+	0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 
+	0x64, 0x69, 0x76, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x64, 0x64, 
+	0x72, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 
+	0x65, 0x20, 0x3d, 0x20, 0x22, 0x64, 0x65, 0x76, 0x69, 0x63, 
+	0x65, 0x2d, 0x61, 0x64, 0x64, 0x72, 0x22, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 
+	0x64, 0x64, 0x72, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 
+	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x6e, 0x65, 
+	0x74, 0x2e, 0x62, 0x73, 0x73, 0x69, 0x64, 0x20, 0x2b, 0x20, 
+	0x22, 0x20, 0x5c, 0x75, 0x30, 0x30, 0x62, 0x37, 0x20, 0x63, 
+	0x68, 0x20, 0x22, 0x20, 0x2b, 0x20, 0x6e, 0x65, 0x74, 0x2e, 
+	0x63, 0x68, 0x20, 0x2b, 0x20, 0x22, 0x20, 0x5c, 0x75, 0x30, 
+	0x30, 0x62, 0x37, 0x20, 0x22, 0x20, 0x2b, 0x20, 0x61, 0x75, 
+	0x74, 0x68, 0x2e, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x6d, 0x65, 0x74, 0x61, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 
+	0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x6e, 0x61, 0x6d, 
+	0x65, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x6d, 0x65, 0x74, 0x61, 0x2e, 0x61, 
+	0x70, 0x70, 0x65, 0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 
+	0x28, 0x61, 0x64, 0x64, 0x72, 0x29, 0x3b, 0xa, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
+	0x61, 0x72, 0x20, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x20, 0x3d, 
+	0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
+	0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 
+	0x65, 0x6e, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 
+	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x2e, 0x63, 0x6c, 
+	0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 
+	0x22, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x74, 0x79, 
+	0x70, 0x65, 0x22, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x65, 0x76, 0x65, 0x6c, 
+	0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 
+	0x6e, 0x74, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x74, 0x2e, 0x72, 
+	0x73, 0x73, 0x69, 0x20, 0x2b, 0x20, 0x22, 0x20, 0x64, 0x42, 
+	0x6d, 0x22, 0x3b, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x69, 0x2e, 0x61, 0x70, 
+	0x70, 0x65, 0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 
+	0x6d, 0x65, 0x74, 0x61, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x69, 0x2e, 
+	0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 
+	0x64, 0x28, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x29, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x6c, 0x69, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 
+	0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 
+	0x22, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x22, 0x2c, 0x20, 0x66, 
+	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 
+	0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x66, 
+	0x69, 0x53, 0x73, 0x69, 0x64, 0x2e, 0x76, 0x61, 0x6c, 0x75, 
+	0x65, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x74, 0x2e, 0x73, 0x73, 
+	0x69, 0x64, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 
+	0x66, 0x69, 0x41, 0x75, 0x74, 0x68, 0x2e, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x20, 0x3d, 0x20, 0x61, 0x75, 0x74, 0x68, 0x2e, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x4c, 
+	0x69, 0x73, 0x74, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 
+	0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x6c, 0x69, 0x29, 0x3b, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x7d, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 
+	0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x75, 0x74, 
+	0x68, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x28, 0x63, 0x6f, 0x64, 
+	0x65, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x76, 0x61, 0x72, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
+	0x6e, 0x20, 0x3d, 0x20, 0x77, 0x69, 0x66, 0x69, 0x41, 0x75, 
+	0x74, 0x68, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 
+	0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x28, 0x27, 0x6f, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x5b, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+	0x3d, 0x22, 0x27, 0x20, 0x2b, 0x20, 0x63, 0x6f, 0x64, 0x65, 
+	0x20, 0x2b, 0x20, 0x27, 0x22, 0x5d, 0x27, 0x29, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+	0x72, 0x6e, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x3f, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x74, 
+	0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 
+	0x20, 0x3a, 0x20, 0x22, 0x41, 0x75, 0x74, 0x68, 0x20, 0x22, 
+	0x20, 0x2b, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x7d, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 
+	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 
+	0x72, 0x4b, 0x6e, 0x6f, 0x77, 0x6e, 0x28, 0x6e, 0x65, 0x74, 
+	0x77, 0x6f, 0x72, 0x6b, 0x73, 0x29, 0x20, 0x7b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 
+	0x4c, 0x69, 0x73, 0x74, 0x2e, 0x69, 0x6e, 0x6e, 0x65, 0x72, 
+	0x48, 0x54, 0x4d, 0x4c, 0x20, 0x3d, 0x20, 0x22, 0x22, 0x3b, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 
+	0x28, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x2e, 
+	0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3d, 0x3d, 0x3d, 
+	0x20, 0x30, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6b, 0x6e, 0x6f, 0x77, 
+	0x6e, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x69, 0x6e, 0x6e, 0x65, 
+	0x72, 0x48, 0x54, 0x4d, 0x4c, 0x20, 0x3d, 0x20, 0x22, 0x3c, 
+	0x6c, 0x69, 0x3e, 0x4e, 0x6f, 0x20, 0x6b, 0x6e, 0x6f, 0x77, 
+	0x6e, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73, 
+	0x2e, 0x3c, 0x2f, 0x6c, 0x69, 0x3e, 0x22, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x2e, 
+	0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 
+	0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x6e, 0x65, 
+	0x74, 0x2c, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x29, 0x20, 
+	0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x6c, 0x69, 0x20, 0x3d, 
+	0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
+	0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 
+	0x65, 0x6e, 0x74, 0x28, 0x22, 0x6c, 0x69, 0x22, 0x29, 0x3b, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x6c, 0x69, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4e, 
+	0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x64, 0x65, 0x76, 
+	0x69, 0x63, 0x65, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x22, 0x3b, 
+	0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x6d, 0x65, 0x74, 0x61, 
+	0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
+	0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 
+	0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 
+	0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x6d, 0x65, 0x74, 0x61, 0x2e, 0x63, 
+	0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 
+	0x20, 0x22, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x6d, 
+	0x65, 0x74, 0x61, 0x22, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 
+	0x6e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 
+	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 
+	0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 
+	0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x61, 
+	0x6d, 0x65, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 
+	0x6d, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x64, 0x65, 0x76, 0x69, 
+	0x63, 0x65, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 
+	0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x28, 
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x2b, 0x20, 0x31, 0x29, 
+	0x20, 0x2b, 0x20, 0x22, 0x2e, 0x20, 0x22, 0x20, 0x2b, 0x20, 
+	0x6e, 0x65, 0x74, 0x2e, 0x73, 0x73, 0x69, 0x64, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x76, 0x61, 0x72, 0x20, 0x61, 0x64, 0x64, 0x72, 0x20, 0x3d, 
+	0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
+	0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 
+	0x65, 0x6e, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 
+	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x61, 0x64, 0x64, 0x72, 0x2e, 0x63, 0x6c, 0x61, 
+	0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x22, 
+	0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x61, 0x64, 0x64, 
+	0x72, 0x22, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x61, 0x64, 0x64, 0x72, 0x2e, 0x74, 
+	0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 
+	0x20, 0x3d, 0x20, 0x61, 0x75, 0x74, 0x68, 0x4c, 0x61, 0x62, 
+	0x65, 0x6c, 0x28, 0x6e, 0x65, 0x74, 0x2e, 0x61, 0x75, 0x74, 
+	0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x6e, 0x65, 0x74, 0x2e, 
+	0x68, 0x61, 0x73, 0x70, 0x61, 0x73, 0x73, 0x20, 0x3f, 0x20, 
+	0x22, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x20, 0x5c, 0x75, 0x30, 
+	0x30, 0x62, 0x37, 0x20, 0x6e, 0x6f, 0x20, 0x70, 0x61, 0x73, 
+	0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x29, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 
+	0x65, 0x74, 0x61, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 
+	0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x6e, 0x61, 0x6d, 0x65, 
+	0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x6d, 0x65, 0x74, 0x61, 0x2e, 0x61, 0x70, 
+	0x70, 0x65, 0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 
+	0x61, 0x64, 0x64, 0x72, 0x29, 0x3b, 0xa, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 
+	0x72, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 
+	0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
+	0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 
+	0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 
+	0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
+	0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 
+	0x20, 0x3d, 0x20, 0x22, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x2d, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x73, 0x22, 0x3b, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x69, 0x66, 0x20, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 
+	0x20, 0x3e, 0x20, 0x30, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x75, 0x70, 0x20, 0x3d, 
+	0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
+	0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 
+	0x65, 0x6e, 0x74, 0x28, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 
+	0x6e, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 
+	0x70, 0x2e, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3d, 0x20, 0x22, 
+	0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x75, 0x70, 0x2e, 0x63, 0x6c, 0x61, 0x73, 
+	0x73, 0x4e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x62, 
+	0x74, 0x6e, 0x20, 0x62, 0x74, 0x6e, 0x2d, 0x73, 0x65, 0x63, 
+	0x6f, 0x6e, 0x64, 0x61, 0x72, 0x79, 0x22, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x75, 0x70, 0x2e, 0x74, 0x65, 0x78, 0x74, 
+	0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 
+	0x22, 0x55, 0x70, 0x22, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x75, 0x70, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 
+	0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 
+	0x22, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x22, 0x2c, 0x20, 0x66, 
+	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 
+	0x20, 0x7b, 0x20, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x52, 0x65, 
+	0x71, 0x75, 0x65, 0x73, 0x74, 0x28, 0x5b, 0x7b, 0x20, 0x6e, 
+	0x61, 0x6d, 0x65, 0x3a, 0x20, 0x22, 0x6f, 0x70, 0x22, 0x2c, 
+	0x20, 0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x22, 0x53, 0x54, 
+	0x52, 0x49, 0x4e, 0x47, 0x22, 0x2c, 0x20, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x3a, 0x20, 0x22, 0x75, 0x70, 0x22, 0x20, 0x7d, 
+	0x2c, 0x20, 0x7b, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3a, 0x20, 
+	0x22, 0x69, 0x22, 0x2c, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3a, 
+	0x20, 0x22, 0x49, 0x4e, 0x54, 0x22, 0x2c, 0x20, 0x76, 0x61, 
+	0x6c, 0x75, 0x65, 0x3a, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6e, 
+	0x67, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x29, 0x20, 0x7d, 
+	0x5d, 0x29, 0x3b, 0x20, 0x7d, 0x29, 0x3b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 
+	0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 
+	0x64, 0x28, 0x75, 0x70, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
+	0x61, 0x72, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 
+	0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
+	0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 
+	0x6d, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x62, 0x75, 0x74, 0x74, 
+	0x6f, 0x6e, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6d, 0x6f, 
+	0x76, 0x65, 0x2e, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3d, 0x20, 
+	0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x2e, 0x63, 0x6c, 0x61, 
+	0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x22, 
+	0x62, 0x74, 0x6e, 0x20, 0x62, 0x74, 0x6e, 0x2d, 0x64, 0x61, 
+	0x6e, 0x67, 0x65, 0x72, 0x22, 0x3b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6d, 
+	0x6f, 0x76, 0x65, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 
+	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x52, 
+	0x65, 0x6d, 0x6f, 0x76, 0x65, 0x22, 0x3b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+	0x6d, 0x6f, 0x76, 0x65, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 
+	0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 
+	0x72, 0x28, 0x22, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x22, 0x2c, 
+	0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x28, 0x29, 0x20, 0x7b, 0x20, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 
+	0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x28, 0x5b, 0x7b, 
+	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3a, 0x20, 0x22, 0x6f, 0x70, 
+	0x22, 0x2c, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x22, 
+	0x53, 0x54, 0x52, 0x49, 0x4e, 0x47, 0x22, 0x2c, 0x20, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x3a, 0x20, 0x22, 0x64, 0x65, 0x6c, 
+	0x22, 0x20, 0x7d, 0x2c, 0x20, 0x7b, 0x20, 0x6e, 0x61, 0x6d, 
+	0x65, 0x3a, 0x20, 0x22, 0x69, 0x22, 0x2c, 0x20, 0x74, 0x79, 
+	0x70, 0x65, 0x3a, 0x20, 0x22, 0x49, 0x4e, 0x54, 0x22, 0x2c, 
+	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x20, 0x53, 0x74, 
+	0x72, 0x69, 0x6e, 0x67, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 
+	0x29, 0x20, 0x7d, 0x5d, 0x29, 0x3b, 0x20, 0x7d, 0x29, 0x3b, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x61, 
+	0x70, 0x70, 0x65, 0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 
+	0x28, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x3b, 0xa, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x6c, 0x69, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 
+	0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x6d, 0x65, 0x74, 0x61, 
+	0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x6c, 0x69, 0x2e, 0x61, 0x70, 0x70, 0x65, 
+	0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x61, 0x63, 
+	0x74, 0x69, 0x6f, 0x6e, 0x73, 0x29, 0x3b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6b, 0x6e, 
+	0x6f, 0x77, 0x6e, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x61, 0x70, 
+	0x70, 0x65, 0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 
+	0x6c, 0x69, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x7d, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x2f, 0x2f, 0x20, 0x57, 0x69, 0x74, 0x68, 0x6f, 
+	0x75, 0x74, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x64, 0x69, 0x74, 
+	0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x6c, 0x69, 0x73, 0x74, 
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65, 0x74, 0x77, 
+	0x6f, 0x72, 0x6b, 0x73, 0x2e, 0x20, 0x45, 0x64, 0x69, 0x74, 
+	0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x50, 0x4f, 0x53, 0x54, 
+	0x65, 0x64, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x65, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70, 0x61, 0x73, 0x73, 
+	0x77, 0x6f, 0x72, 0x64, 0x73, 0x20, 0x6e, 0x65, 0x76, 0x65, 
+	0x72, 0x20, 0x74, 0x72, 0x61, 0x76, 0x65, 0x6c, 0x20, 0x69, 
+	0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x55, 0x52, 0x4c, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x52, 0x65, 0x71, 0x75, 
+	0x65, 0x73, 0x74, 0x28, 0x65, 0x64, 0x69, 0x74, 0x29, 0x20, 
+	0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 
+	0x72, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x20, 
+	0x3d, 0x20, 0x65, 0x64, 0x69, 0x74, 0x20, 0x3f, 0x20, 0x7b, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3a, 0x20, 0x22, 
+	0x50, 0x4f, 0x53, 0x54, 0x22, 0x2c, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x61, 
+	0x64, 0x65, 0x72, 0x73, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x43, 
+	0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 
+	0x65, 0x22, 0x3a, 0x20, 0x22, 0x61, 0x70, 0x70, 0x6c, 0x69, 
+	0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x6a, 0x73, 0x6f, 
+	0x6e, 0x22, 0x20, 0x7d, 0x2c, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x64, 0x79, 
+	0x3a, 0x20, 0x4a, 0x53, 0x4f, 0x4e, 0x2e, 0x73, 0x74, 0x72, 
+	0x69, 0x6e, 0x67, 0x69, 0x66, 0x79, 0x28, 0x65, 0x64, 0x69, 
+	0x74, 0x29, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
+	0x20, 0x3a, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 
+	0x65, 0x64, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x22, 0x2f, 0x77, 0x69, 
+	0x66, 0x69, 0x6e, 0x65, 0x74, 0x73, 0x2e, 0x63, 0x67, 0x69, 
+	0x22, 0x2c, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 
+	0x29, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x66, 0x75, 
+	0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x72, 0x65, 
+	0x73, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 
+	0x66, 0x20, 0x28, 0x21, 0x72, 0x65, 0x73, 0x2e, 0x6f, 0x6b, 
+	0x29, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x77, 0x20, 0x6e, 0x65, 
+	0x77, 0x20, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x68, 
+	0x74, 0x74, 0x70, 0x20, 0x22, 0x20, 0x2b, 0x20, 0x72, 0x65, 
+	0x73, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x29, 0x3b, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
+	0x6e, 0x20, 0x72, 0x65, 0x73, 0x2e, 0x6a, 0x73, 0x6f, 0x6e, 
+	0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x74, 0x68, 
+	0x65, 0x6e, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+	0x6e, 0x20, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x20, 0x7b, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x64, 
+	0x61, 0x74, 0x61, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 
+	0x20, 0x26, 0x26, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x73, 
+	0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x21, 0x3d, 0x3d, 0x20, 
+	0x32, 0x30, 0x30, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x77, 
+	0x20, 0x6e, 0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6f, 0x72, 
+	0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x6d, 0x65, 0x73, 0x73, 
+	0x61, 0x67, 0x65, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x7d, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6e, 0x64, 
+	0x65, 0x72, 0x4b, 0x6e, 0x6f, 0x77, 0x6e, 0x28, 0x64, 0x61, 
+	0x74, 0x61, 0x2e, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 
+	0x73, 0x20, 0x7c, 0x7c, 0x20, 0x5b, 0x5d, 0x29, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x7d, 0x29, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x2e, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 
+	0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 
+	0x65, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
+	0x68, 0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 
+	0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x2c, 0x20, 0x28, 
+	0x65, 0x20, 0x26, 0x26, 0x20, 0x65, 0x2e, 0x6d, 0x65, 0x73, 
+	0x73, 0x61, 0x67, 0x65, 0x29, 0x20, 0x7c, 0x7c, 0x20, 0x22, 
+	0x55, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 
+	0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 
+	0x20, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x6e, 0x65, 0x74, 
+	0x77, 0x6f, 0x72, 0x6b, 0x73, 0x2e, 0x22, 0x29, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x7d, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x2f, 0x2f, 0x20, 0x41, 0x73, 0x6b, 0x73, 0x20, 0x6f, 
+	0x6e, 0x6c, 0x79, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 
+	0x65, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73, 
+	0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x20, 0x73, 
+	0x69, 0x6e, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 
+	0x61, 0x73, 0x74, 0x20, 0x61, 0x6e, 0x73, 0x77, 0x65, 0x72, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+	0x6e, 0x20, 0x70, 0x6f, 0x6c, 0x6c, 0x53, 0x63, 0x61, 0x6e, 
+	0x28, 0x73, 0x74, 0x61, 0x72, 0x74, 0x29, 0x20, 0x7b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 
+	0x75, 0x72, 0x6c, 0x20, 0x3d, 0x20, 0x22, 0x2f, 0x77, 0x69, 
+	0x66, 0x69, 0x73, 0x63, 0x61, 0x6e, 0x2e, 0x63, 0x67, 0x69, 
+	0x3f, 0x73, 0x69, 0x6e, 0x63, 0x65, 0x3d, 0x22, 0x20, 0x2b, 
+	0x20, 0x73, 0x63, 0x61, 0x6e, 0x2e, 0x67, 0x65, 0x6e, 0x20, 
+	0x2b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x28, 0x73, 0x63, 0x61, 0x6e, 0x2e, 0x65, 0x70, 
+	0x6f, 0x63, 0x68, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x6e, 0x75, 
+	0x6c, 0x6c, 0x20, 0x3f, 0x20, 0x22, 0x22, 0x20, 0x3a, 0x20, 
+	0x22, 0x26, 0x65, 0x70, 0x6f, 0x63, 0x68, 0x3d, 0x22, 0x20, 
+	0x2b, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x2e, 0x65, 0x70, 0x6f, 
+	0x63, 0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x73, 0x74, 0x61, 
+	0x72, 0x74, 0x20, 0x3f, 0x20, 0x22, 0x26, 0x73, 0x74, 0x61, 
+	0x72, 0x74, 0x3d, 0x31, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x22, 
+	0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 
+	0x65, 0x74, 0x63, 0x68, 0x28, 0x75, 0x72, 0x6c, 0x29, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x66, 0x75, 0x6e, 0x63, 
+	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x72, 0x65, 0x73, 0x29, 
+	0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 
+	0x28, 0x21, 0x72, 0x65, 0x73, 0x2e, 0x6f, 0x6b, 0x29, 0x20, 
+	0x74, 0x68, 0x72, 0x6f, 0x77, 0x20, 0x6e, 0x65, 0x77, 0x20, 
+	0x45, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x68, 0x74, 0x74, 
+	0x70, 0x20, 0x22, 0x20, 0x2b, 0x20, 0x72, 0x65, 0x73, 0x2e, 
+	0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x29, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 
+	0x72, 0x65, 0x73, 0x2e, 0x6a, 0x73, 0x6f, 0x6e, 0x28, 0x29, 
+	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0x29, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x74, 0x68, 0x65, 0x6e, 
+	0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x20, 0x7b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x64, 0x61, 0x74, 
+	0x61, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x26, 
+	0x26, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x73, 0x74, 0x61, 
+	0x74, 0x75, 0x73, 0x20, 0x21, 0x3d, 0x3d, 0x20, 0x32, 0x30, 
+	0x30, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x77, 0x20, 0x6e, 
+	0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x64, 
+	0x61, 0x74, 0x61, 0x2e, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 
+	0x65, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x3e, 0x53, 
-	0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x6f, 0x70, 
-	0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 
-	0x6c, 0x65, 0x63, 0x74, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x64, 0x61, 
+	0x74, 0x61, 0x2e, 0x66, 0x75, 0x6c, 0x6c, 0x29, 0x20, 0x7b, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xa, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
+	0x63, 0x61, 0x6e, 0x2e, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 
+	0x6b, 0x73, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0x3b, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 
-	0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f, 
-	0x72, 0x6d, 0x2d, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 
-	0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x68, 0x6f, 0x73, 0x74, 
-	0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 
+	0x64, 0x61, 0x74, 0x61, 0x2e, 0x6e, 0x65, 0x74, 0x77, 0x6f, 
+	0x72, 0x6b, 0x73, 0x20, 0x7c, 0x7c, 0x20, 0x5b, 0x5d, 0x29, 
+	0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x66, 
+	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x6e, 
+	0x65, 0x74, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x3e, 0x48, 
-	0x6f, 0x73, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3c, 0x2f, 
-	0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x3e, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x2e, 0x6e, 
+	0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x5b, 0x6e, 0x65, 
+	0x74, 0x2e, 0x62, 0x73, 0x73, 0x69, 0x64, 0x5d, 0x20, 0x3d, 
+	0x20, 0x6e, 0x65, 0x74, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 
-	0x73, 0x73, 0x3d, 0x22, 0x68, 0x65, 0x6c, 0x70, 0x65, 0x72, 
-	0x2d, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x44, 0x65, 0x76, 
-	0x69, 0x63, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x6e, 0x61, 
-	0x6d, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x62, 0x79, 
-	0x20, 0x6d, 0x44, 0x4e, 0x53, 0x20, 0x61, 0x6e, 0x64, 0x20, 
-	0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x6e, 0x65, 0x74, 0x77, 
-	0x6f, 0x72, 0x6b, 0x20, 0x6e, 0x61, 0x6d, 0x69, 0x6e, 0x67, 
-	0x2e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
-	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xa, 0x20, 0x20, 0x20, 
+	0x7d, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 
-	0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 
-	0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 
-	0x77, 0x69, 0x66, 0x69, 0x2d, 0x68, 0x6f, 0x73, 0x74, 0x6e, 
-	0x61, 0x6d, 0x65, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 
-	0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x68, 0x6f, 0x73, 0x74, 
-	0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 
-	0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x36, 0x34, 0x22, 
-	0x20, 0x61, 0x75, 0x74, 0x6f, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 
-	0x65, 0x74, 0x65, 0x3d, 0x22, 0x6f, 0x66, 0x66, 0x22, 0x3e, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 
-	0x69, 0x76, 0x3e, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 
+	0x61, 0x6e, 0x2e, 0x65, 0x70, 0x6f, 0x63, 0x68, 0x20, 0x3d, 
+	0x20, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x65, 0x70, 0x6f, 0x63, 
+	0x68, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 
-	0x73, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x72, 0x6f, 
-	0x77, 0x20, 0x73, 0x74, 0x61, 0x2d, 0x6f, 0x6e, 0x6c, 0x79, 
-	0x22, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x61, 
+	0x6e, 0x2e, 0x67, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x64, 0x61, 
+	0x74, 0x61, 0x2e, 0x67, 0x65, 0x6e, 0x3b, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 
-	0x66, 0x6f, 0x72, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 
-	0x73, 0x73, 0x69, 0x64, 0x22, 0x3e, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x4e, 0x65, 
+	0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x28, 0x64, 0x61, 0x74, 
+	0x61, 0x2e, 0x73, 0x63, 0x61, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 
+	0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x3e, 0x53, 
-	0x53, 0x49, 0x44, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x6f, 0x6e, 
-	0x67, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 
+	0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x6d, 0x6f, 0x72, 0x65, 
+	0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 
-	0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x68, 
-	0x65, 0x6c, 0x70, 0x65, 0x72, 0x2d, 0x74, 0x65, 0x78, 0x74, 
-	0x22, 0x3e, 0x57, 0x69, 0x2d, 0x46, 0x69, 0x20, 0x6e, 0x65, 
-	0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
-	0x20, 0x74, 0x6f, 0x20, 0x6a, 0x6f, 0x69, 0x6e, 0x20, 0x69, 
-	0x6e, 0x20, 0x53, 0x54, 0x41, 0x20, 0x6d, 0x6f, 0x64, 0x65, 
-	0x2c, 0x20, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x42, 0x53, 0x53, 
-	0x49, 0x44, 0x20, 0x69, 0x6e, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x64, 0x65, 0x3e, 
-	0x78, 0x78, 0x3a, 0x78, 0x78, 0x3a, 0x78, 0x78, 0x3a, 0x78, 
-	0x78, 0x3a, 0x78, 0x78, 0x3a, 0x78, 0x78, 0x3c, 0x2f, 0x63, 
-	0x6f, 0x64, 0x65, 0x3e, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 
-	0x74, 0x20, 0x28, 0x75, 0x73, 0x65, 0x66, 0x75, 0x6c, 0x20, 
-	0x66, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 
-	0x65, 0x72, 0x73, 0x2f, 0x6d, 0x65, 0x73, 0x68, 0x20, 0x6e, 
-	0x6f, 0x64, 0x65, 0x73, 0x29, 0x2e, 0x3c, 0x2f, 0x64, 0x69, 
-	0x76, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
-	0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x70, 0x6f, 0x6c, 0x6c, 0x53, 0x63, 0x61, 0x6e, 
+	0x28, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x29, 0x3b, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 
-	0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 
-	0x20, 0x69, 0x64, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 
-	0x73, 0x73, 0x69, 0x64, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
-	0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x73, 0x73, 0x69, 
-	0x64, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 
-	0x74, 0x68, 0x3d, 0x22, 0x36, 0x33, 0x22, 0x20, 0x61, 0x75, 
-	0x74, 0x6f, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 
-	0x3d, 0x22, 0x6f, 0x66, 0x66, 0x22, 0x3e, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 
-	0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 
-	0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 
-	0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x72, 0x6f, 0x77, 0x22, 0x3e, 
+	0x20, 0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 
+	0x69, 0x66, 0x20, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x73, 
+	0x63, 0x61, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x29, 0x20, 0x7b, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 
-	0x72, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x70, 0x61, 
-	0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x3e, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
+	0x63, 0x61, 0x6e, 0x2e, 0x74, 0x69, 0x6d, 0x65, 0x72, 0x20, 
+	0x3d, 0x20, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f, 
+	0x75, 0x74, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+	0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 0x20, 0x70, 0x6f, 0x6c, 
+	0x6c, 0x53, 0x63, 0x61, 0x6e, 0x28, 0x66, 0x61, 0x6c, 0x73, 
+	0x65, 0x29, 0x3b, 0x20, 0x7d, 0x2c, 0x20, 0x35, 0x30, 0x30, 
+	0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x65, 
+	0x6c, 0x73, 0x65, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 
-	0x3e, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x3c, 
-	0x2f, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x3e, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x2e, 0x74, 
+	0x69, 0x6d, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x6e, 0x75, 0x6c, 
+	0x6c, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 
-	0x61, 0x73, 0x73, 0x3d, 0x22, 0x68, 0x65, 0x6c, 0x70, 0x65, 
-	0x72, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x57, 0x69, 
-	0x2d, 0x46, 0x69, 0x20, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 
-	0x72, 0x64, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x62, 0x79, 
-	0x20, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x41, 0x50, 0x20, 0x61, 
-	0x6e, 0x64, 0x20, 0x53, 0x54, 0x41, 0x20, 0x6d, 0x6f, 0x64, 
-	0x65, 0x73, 0x2e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x73, 0x63, 0x61, 0x6e, 0x42, 0x75, 0x74, 0x74, 0x6f, 
+	0x6e, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 
+	0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 
-	0x22, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x2d, 
-	0x66, 0x69, 0x65, 0x6c, 0x64, 0x22, 0x3e, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 
-	0x79, 0x70, 0x65, 0x3d, 0x22, 0x70, 0x61, 0x73, 0x73, 0x77, 
-	0x6f, 0x72, 0x64, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x77, 
-	0x69, 0x66, 0x69, 0x2d, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 
-	0x72, 0x64, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 
-	0x77, 0x69, 0x66, 0x69, 0x2d, 0x70, 0x61, 0x73, 0x73, 0x77, 
-	0x6f, 0x72, 0x64, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 
-	0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x36, 0x33, 0x22, 0x20, 
-	0x61, 0x75, 0x74, 0x6f, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 
-	0x74, 0x65, 0x3d, 0x22, 0x6f, 0x66, 0x66, 0x22, 0x3e, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 
+	0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6e, 0x63, 
+	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 
-	0x6e, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x62, 0x75, 
-	0x74, 0x74, 0x6f, 0x6e, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 
-	0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x2d, 0x70, 0x61, 0x73, 
-	0x73, 0x77, 0x6f, 0x72, 0x64, 0x2d, 0x76, 0x69, 0x73, 0x69, 
-	0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x22, 0x20, 0x63, 0x6c, 
-	0x61, 0x73, 0x73, 0x3d, 0x22, 0x65, 0x79, 0x65, 0x2d, 0x74, 
-	0x6f, 0x67, 0x67, 0x6c, 0x65, 0x22, 0x20, 0x61, 0x72, 0x69, 
-	0x61, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3d, 0x22, 0x53, 
-	0x68, 0x6f, 0x77, 0x20, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 
-	0x72, 0x64, 0x22, 0x20, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3d, 
-	0x22, 0x53, 0x68, 0x6f, 0x77, 0x20, 0x70, 0x61, 0x73, 0x73, 
-	0x77, 0x6f, 0x72, 0x64, 0x22, 0x3e, 0x3c, 0x2f, 0x62, 0x75, 
-	0x74, 0x74, 0x6f, 0x6e, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x2e, 0x74, 
+	0x69, 0x6d, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x6e, 0x75, 0x6c, 
+	0x6c, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 
-	0x76, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x2f, 0x64, 0x69, 0x76, 0x3e, 0xa, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x61, 
+	0x6e, 0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x2e, 0x64, 0x69, 
+	0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x20, 0x3d, 0x20, 0x66, 
+	0x61, 0x6c, 0x73, 0x65, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 
-	0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 
-	0x72, 0x6f, 0x77, 0x22, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 
-	0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x77, 0x69, 
-	0x66, 0x69, 0x2d, 0x61, 0x75, 0x74, 0x68, 0x22, 0x3e, 0xa, 
+	0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x4c, 0x69, 
+	0x73, 0x74, 0x2e, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 
+	0x4d, 0x4c, 0x20, 0x3d, 0x20, 0x22, 0x3c, 0x6c, 0x69, 0x3e, 
+	0x55, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 
+	0x73, 0x63, 0x61, 0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6e, 
+	0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x2e, 0x3c, 0x2f, 
+	0x6c, 0x69, 0x3e, 0x22, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x74, 0x72, 0x6f, 0x6e, 
-	0x67, 0x3e, 0x41, 0x75, 0x74, 0x68, 0x20, 0x6d, 0x6f, 0x64, 
-	0x65, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x3e, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x74, 0x61, 0x72, 
+	0x74, 0x53, 0x63, 0x61, 0x6e, 0x28, 0x29, 0x20, 0x7b, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 
-	0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x68, 0x65, 0x6c, 
-	0x70, 0x65, 0x72, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 
-	0x41, 0x75, 0x74, 0x68, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x61, 
-	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x20, 
-	0x75, 0x73, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x62, 0x6f, 
-	0x74, 0x68, 0x20, 0x41, 0x50, 0x20, 0x61, 0x6e, 0x64, 0x20, 
-	0x53, 0x54, 0x41, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x73, 0x2e, 
-	0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 
+	0x73, 0x63, 0x61, 0x6e, 0x2e, 0x74, 0x69, 0x6d, 0x65, 0x72, 
+	0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 
-	0x61, 0x62, 0x65, 0x6c, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x54, 
+	0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28, 0x73, 0x63, 0x61, 
+	0x6e, 0x2e, 0x74, 0x69, 0x6d, 0x65, 0x72, 0x29, 0x3b, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 
-	0x65, 0x63, 0x74, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x77, 0x69, 
-	0x66, 0x69, 0x2d, 0x61, 0x75, 0x74, 0x68, 0x22, 0x20, 0x6e, 
-	0x61, 0x6d, 0x65, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 
-	0x61, 0x75, 0x74, 0x68, 0x22, 0x3e, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x73, 0x63, 0x61, 0x6e, 0x2e, 0x74, 0x69, 0x6d, 0x65, 0x72, 
+	0x20, 0x3d, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x3e, 0x4f, 
-	0x50, 0x45, 0x4e, 0x20, 0x28, 0x6e, 0x6f, 0x20, 0x70, 0x61, 
-	0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x29, 0x3c, 0x2f, 0x6f, 
-	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x42, 0x75, 0x74, 
+	0x74, 0x6f, 0x6e, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 
+	0x65, 0x64, 0x20, 0x3d, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6e, 
+	0x64, 0x65, 0x72, 0x4e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 
+	0x73, 0x28, 0x74, 0x72, 0x75, 0x65, 0x29, 0x3b, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x32, 0x22, 0x3e, 0x57, 
-	0x50, 0x41, 0x2d, 0x54, 0x4b, 0x49, 0x50, 0x2d, 0x50, 0x53, 
-	0x4b, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6f, 0x6c, 0x6c, 0x53, 
+	0x63, 0x61, 0x6e, 0x28, 0x74, 0x72, 0x75, 0x65, 0x29, 0x3b, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x7d, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 
+	0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x70, 0x70, 
+	0x6c, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 0x73, 0x74, 
+	0x61, 0x74, 0x65, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 
-	0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 
-	0x35, 0x22, 0x3e, 0x57, 0x50, 0x41, 0x32, 0x2d, 0x41, 0x45, 
-	0x53, 0x2d, 0x50, 0x53, 0x4b, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 
-	0x69, 0x6f, 0x6e, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x77, 0x69, 0x66, 0x69, 0x4d, 0x6f, 0x64, 
+	0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 
+	0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x6d, 0x6f, 0x64, 0x65, 
+	0x20, 0x7c, 0x7c, 0x20, 0x22, 0x30, 0x22, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x66, 0x69, 0x48, 
+	0x6f, 0x73, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x76, 0x61, 
+	0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x61, 0x74, 
+	0x65, 0x2e, 0x68, 0x6f, 0x73, 0x74, 0x6e, 0x61, 0x6d, 0x65, 
+	0x20, 0x7c, 0x7c, 0x20, 0x22, 0x63, 0x72, 0x6f, 0x69, 0x73, 
+	0x73, 0x61, 0x6e, 0x74, 0x22, 0x3b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x77, 0x69, 0x66, 0x69, 0x53, 0x73, 0x69, 
+	0x64, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 
+	0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x73, 0x69, 0x64, 
+	0x20, 0x7c, 0x7c, 0x20, 0x22, 0x22, 0x3b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x66, 0x69, 0x50, 0x61, 
+	0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x2e, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 
+	0x2e, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x20, 
+	0x7c, 0x7c, 0x20, 0x22, 0x22, 0x3b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x77, 0x69, 0x66, 0x69, 0x41, 0x75, 0x74, 
+	0x68, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 
+	0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x61, 0x75, 0x74, 0x68, 
+	0x20, 0x7c, 0x7c, 0x20, 0x22, 0x30, 0x22, 0x3b, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 
-	0x75, 0x65, 0x3d, 0x22, 0x38, 0x22, 0x3e, 0x57, 0x50, 0x41, 
-	0x32, 0x2d, 0x4d, 0x49, 0x58, 0x45, 0x44, 0x2d, 0x50, 0x53, 
-	0x4b, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x66, 0x69, 0x41, 
+	0x70, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x2e, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x61, 
+	0x74, 0x65, 0x2e, 0x61, 0x70, 0x43, 0x68, 0x61, 0x6e, 0x6e, 
+	0x65, 0x6c, 0x20, 0x7c, 0x7c, 0x20, 0x22, 0x30, 0x22, 0x3b, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 
+	0x28, 0x77, 0x69, 0x66, 0x69, 0x41, 0x70, 0x43, 0x68, 0x61, 
+	0x6e, 0x6e, 0x65, 0x6c, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+	0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x22, 0x22, 0x29, 0x20, 0x7b, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 
-	0x69, 0x76, 0x3e, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 
-	0x73, 0x3d, 0x22, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x61, 0x63, 
-	0x74, 0x69, 0x6f, 0x6e, 0x73, 0x22, 0x3e, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x62, 
-	0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x74, 0x79, 0x70, 0x65, 
-	0x3d, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x20, 
-	0x69, 0x64, 0x3d, 0x22, 0x73, 0x61, 0x76, 0x65, 0x2d, 0x77, 
-	0x69, 0x66, 0x69, 0x2d, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 
-	0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 
-	0x74, 0x6e, 0x22, 0x3e, 0x53, 0x61, 0x76, 0x65, 0x20, 0x73, 
-	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x3c, 0x2f, 0x62, 
-	0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x77, 0x69, 0x66, 0x69, 0x41, 0x70, 0x43, 0x68, 0x61, 
+	0x6e, 0x6e, 0x65, 0x6c, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+	0x20, 0x3d, 0x20, 0x22, 0x30, 0x22, 0x3b, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x62, 0x75, 
-	0x74, 0x74, 0x6f, 0x6e, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 
-	0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x20, 0x69, 
-	0x64, 0x3d, 0x22, 0x72, 0x65, 0x73, 0x65, 0x74, 0x2d, 0x77, 
-	0x69, 0x66, 0x69, 0x2d, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 
-	0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 
-	0x74, 0x6e, 0x20, 0x62, 0x74, 0x6e, 0x2d, 0x73, 0x65, 0x63, 
-	0x6f, 0x6e, 0x64, 0x61, 0x72, 0x79, 0x22, 0x3e, 0x52, 0x65, 
-	0x73, 0x65, 0x74, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 
-	0x6e, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x2f, 0x64, 0x69, 0x76, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
-	0x66, 0x6f, 0x72, 0x6d, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 0x63, 0x74, 
-	0x69, 0x6f, 0x6e, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x2f, 0x6d, 0x61, 0x69, 0x6e, 0x3e, 0xa, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x66, 0x6f, 0x6f, 0x74, 0x65, 0x72, 0x20, 
-	0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f, 0x6f, 
-	0x74, 0x65, 0x72, 0x22, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x3e, 0x26, 0x63, 0x6f, 
-	0x70, 0x79, 0x3b, 0x20, 0x32, 0x30, 0x32, 0x36, 0x20, 0x47, 
-	0x4f, 0x4f, 0x44, 0x44, 0x41, 0x54, 0x41, 0x20, 0x4c, 0x41, 
-	0x42, 0x53, 0x20, 0x53, 0x4c, 0x55, 0x2e, 0x20, 0x41, 0x6c, 
-	0x6c, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 0x72, 
-	0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x2e, 0x3c, 0x2f, 
-	0x70, 0x3e, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x66, 
-	0x6f, 0x6f, 0x74, 0x65, 0x72, 0x3e, 0xa, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 
-	0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 
-	0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 
-	0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x42, 0x6f, 0x78, 0x20, 
-	0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
-	0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 
-	0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x77, 0x69, 0x66, 
-	0x69, 0x2d, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22, 0x29, 
-	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x77, 0x69, 
-	0x66, 0x69, 0x4d, 0x6f, 0x64, 0x65, 0x20, 0x3d, 0x20, 0x64, 
-	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 
-	0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 
-	0x49, 0x64, 0x28, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x6d, 
-	0x6f, 0x64, 0x65, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
-	0x61, 0x72, 0x20, 0x77, 0x69, 0x66, 0x69, 0x48, 0x6f, 0x73, 
-	0x74, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x64, 0x6f, 
-	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 
-	0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 
-	0x64, 0x28, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x68, 0x6f, 
-	0x73, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x29, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x77, 0x69, 0x66, 0x69, 
-	0x53, 0x73, 0x69, 0x64, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 
-	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 
-	0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 
-	0x28, 0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x73, 0x73, 0x69, 
-	0x64, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 
-	0x20, 0x77, 0x69, 0x66, 0x69, 0x50, 0x61, 0x73, 0x73, 0x77, 
-	0x6f, 0x72, 0x64, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 
-	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 
-	0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 
-	0x22, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x70, 0x61, 0x73, 0x73, 
-	0x77, 0x6f, 0x72, 0x64, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x77, 0x69, 0x66, 0x69, 0x53, 0x74, 0x61, 0x74, 
+	0x69, 0x63, 0x49, 0x70, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+	0x20, 0x3d, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 
+	0x74, 0x61, 0x74, 0x69, 0x63, 0x49, 0x70, 0x20, 0x7c, 0x7c, 
+	0x20, 0x22, 0x22, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x76, 0x61, 0x72, 0x20, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 
-	0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x56, 0x69, 
-	0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x3d, 
-	0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
-	0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 
-	0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x74, 0x6f, 0x67, 0x67, 
-	0x6c, 0x65, 0x2d, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 
-	0x64, 0x2d, 0x76, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 
-	0x74, 0x79, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 
-	0x72, 0x20, 0x77, 0x69, 0x66, 0x69, 0x41, 0x75, 0x74, 0x68, 
-	0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
-	0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 
-	0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x77, 0x69, 
-	0x66, 0x69, 0x2d, 0x61, 0x75, 0x74, 0x68, 0x22, 0x29, 0x3b, 
+	0x20, 0x73, 0x65, 0x74, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 
+	0x72, 0x64, 0x56, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 
+	0x74, 0x79, 0x28, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x29, 0x3b, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x73, 0x74, 0x61, 
-	0x4f, 0x6e, 0x6c, 0x79, 0x52, 0x6f, 0x77, 0x73, 0x20, 0x3d, 
-	0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
-	0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 
-	0x74, 0x6f, 0x72, 0x41, 0x6c, 0x6c, 0x28, 0x22, 0x2e, 0x73, 
-	0x74, 0x61, 0x2d, 0x6f, 0x6e, 0x6c, 0x79, 0x22, 0x29, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x65, 0x79, 0x65, 
-	0x4f, 0x70, 0x65, 0x6e, 0x53, 0x76, 0x67, 0x20, 0x3d, 0x20, 
-	0x27, 0x3c, 0x73, 0x76, 0x67, 0x20, 0x76, 0x69, 0x65, 0x77, 
-	0x42, 0x6f, 0x78, 0x3d, 0x22, 0x30, 0x20, 0x30, 0x20, 0x32, 
-	0x34, 0x20, 0x32, 0x34, 0x22, 0x20, 0x61, 0x72, 0x69, 0x61, 
-	0x2d, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x3d, 0x22, 0x74, 
-	0x72, 0x75, 0x65, 0x22, 0x20, 0x66, 0x6f, 0x63, 0x75, 0x73, 
-	0x61, 0x62, 0x6c, 0x65, 0x3d, 0x22, 0x66, 0x61, 0x6c, 0x73, 
-	0x65, 0x22, 0x3e, 0x3c, 0x70, 0x61, 0x74, 0x68, 0x20, 0x64, 
-	0x3d, 0x22, 0x4d, 0x31, 0x32, 0x20, 0x35, 0x63, 0x2d, 0x34, 
-	0x2e, 0x39, 0x37, 0x20, 0x30, 0x2d, 0x39, 0x2e, 0x32, 0x37, 
-	0x20, 0x32, 0x2e, 0x39, 0x38, 0x2d, 0x31, 0x31, 0x20, 0x37, 
-	0x20, 0x31, 0x2e, 0x37, 0x33, 0x20, 0x34, 0x2e, 0x30, 0x32, 
-	0x20, 0x36, 0x2e, 0x30, 0x33, 0x20, 0x37, 0x20, 0x31, 0x31, 
-	0x20, 0x37, 0x73, 0x39, 0x2e, 0x32, 0x37, 0x2d, 0x32, 0x2e, 
-	0x39, 0x38, 0x20, 0x31, 0x31, 0x2d, 0x37, 0x63, 0x2d, 0x31, 
-	0x2e, 0x37, 0x33, 0x2d, 0x34, 0x2e, 0x30, 0x32, 0x2d, 0x36, 
-	0x2e, 0x30, 0x33, 0x2d, 0x37, 0x2d, 0x31, 0x31, 0x2d, 0x37, 
-	0x7a, 0x6d, 0x30, 0x20, 0x31, 0x32, 0x61, 0x35, 0x20, 0x35, 
-	0x20, 0x30, 0x20, 0x31, 0x20, 0x31, 0x20, 0x30, 0x2d, 0x31, 
-	0x30, 0x20, 0x35, 0x20, 0x35, 0x20, 0x30, 0x20, 0x30, 0x20, 
-	0x31, 0x20, 0x30, 0x20, 0x31, 0x30, 0x7a, 0x6d, 0x30, 0x2d, 
-	0x38, 0x61, 0x33, 0x20, 0x33, 0x20, 0x30, 0x20, 0x31, 0x20, 
-	0x30, 0x20, 0x30, 0x20, 0x36, 0x20, 0x33, 0x20, 0x33, 0x20, 
-	0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x2d, 0x36, 0x7a, 
-	0x22, 0x2f, 0x3e, 0x3c, 0x2f, 0x73, 0x76, 0x67, 0x3e, 0x27, 
-	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x65, 0x79, 
-	0x65, 0x43, 0x6c, 0x6f, 0x73, 0x65, 0x64, 0x53, 0x76, 0x67, 
-	0x20, 0x3d, 0x20, 0x27, 0x3c, 0x73, 0x76, 0x67, 0x20, 0x76, 
-	0x69, 0x65, 0x77, 0x42, 0x6f, 0x78, 0x3d, 0x22, 0x30, 0x20, 
-	0x30, 0x20, 0x32, 0x34, 0x20, 0x32, 0x34, 0x22, 0x20, 0x61, 
-	0x72, 0x69, 0x61, 0x2d, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 
-	0x3d, 0x22, 0x74, 0x72, 0x75, 0x65, 0x22, 0x20, 0x66, 0x6f, 
-	0x63, 0x75, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3d, 0x22, 0x66, 
-	0x61, 0x6c, 0x73, 0x65, 0x22, 0x3e, 0x3c, 0x70, 0x61, 0x74, 
-	0x68, 0x20, 0x64, 0x3d, 0x22, 0x4d, 0x33, 0x2e, 0x32, 0x37, 
-	0x20, 0x32, 0x4c, 0x32, 0x20, 0x33, 0x2e, 0x32, 0x37, 0x6c, 
-	0x33, 0x20, 0x33, 0x41, 0x31, 0x31, 0x2e, 0x37, 0x32, 0x20, 
-	0x31, 0x31, 0x2e, 0x37, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 
-	0x30, 0x20, 0x31, 0x20, 0x31, 0x32, 0x63, 0x31, 0x2e, 0x37, 
-	0x33, 0x20, 0x34, 0x2e, 0x30, 0x32, 0x20, 0x36, 0x2e, 0x30, 
-	0x33, 0x20, 0x37, 0x20, 0x31, 0x31, 0x20, 0x37, 0x20, 0x32, 
-	0x2e, 0x30, 0x38, 0x20, 0x30, 0x20, 0x34, 0x2e, 0x30, 0x33, 
-	0x2d, 0x2e, 0x35, 0x32, 0x20, 0x35, 0x2e, 0x37, 0x33, 0x2d, 
-	0x31, 0x2e, 0x34, 0x33, 0x4c, 0x32, 0x30, 0x2e, 0x37, 0x33, 
-	0x20, 0x32, 0x31, 0x20, 0x32, 0x32, 0x20, 0x31, 0x39, 0x2e, 
-	0x37, 0x33, 0x20, 0x33, 0x2e, 0x32, 0x37, 0x20, 0x32, 0x7a, 
-	0x4d, 0x31, 0x32, 0x20, 0x31, 0x37, 0x63, 0x2d, 0x32, 0x2e, 
-	0x37, 0x36, 0x20, 0x30, 0x2d, 0x35, 0x2d, 0x32, 0x2e, 0x32, 
-	0x34, 0x2d, 0x35, 0x2d, 0x35, 0x20, 0x30, 0x2d, 0x2e, 0x37, 
-	0x32, 0x2e, 0x31, 0x35, 0x2d, 0x31, 0x2e, 0x34, 0x2e, 0x34, 
-	0x33, 0x2d, 0x32, 0x2e, 0x30, 0x31, 0x6c, 0x31, 0x2e, 0x35, 
-	0x39, 0x20, 0x31, 0x2e, 0x35, 0x39, 0x41, 0x33, 0x20, 0x33, 
-	0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x32, 0x20, 
-	0x31, 0x35, 0x63, 0x2e, 0x35, 0x32, 0x20, 0x30, 0x20, 0x31, 
-	0x2e, 0x30, 0x32, 0x2d, 0x2e, 0x31, 0x33, 0x20, 0x31, 0x2e, 
-	0x34, 0x35, 0x2d, 0x2e, 0x33, 0x36, 0x6c, 0x31, 0x2e, 0x35, 
-	0x39, 0x20, 0x31, 0x2e, 0x35, 0x39, 0x63, 0x2d, 0x2e, 0x39, 
-	0x32, 0x2e, 0x34, 0x39, 0x2d, 0x31, 0x2e, 0x39, 0x37, 0x2e, 
-	0x37, 0x37, 0x2d, 0x33, 0x2e, 0x30, 0x34, 0x2e, 0x37, 0x37, 
-	0x7a, 0x4d, 0x31, 0x32, 0x20, 0x37, 0x63, 0x32, 0x2e, 0x37, 
-	0x36, 0x20, 0x30, 0x20, 0x35, 0x20, 0x32, 0x2e, 0x32, 0x34, 
-	0x20, 0x35, 0x20, 0x35, 0x20, 0x30, 0x20, 0x2e, 0x36, 0x36, 
-	0x2d, 0x2e, 0x31, 0x33, 0x20, 0x31, 0x2e, 0x33, 0x2d, 0x2e, 
-	0x33, 0x37, 0x20, 0x31, 0x2e, 0x38, 0x38, 0x6c, 0x33, 0x2e, 
-	0x30, 0x37, 0x20, 0x33, 0x2e, 0x30, 0x37, 0x41, 0x31, 0x31, 
-	0x2e, 0x35, 0x38, 0x20, 0x31, 0x31, 0x2e, 0x35, 0x38, 0x20, 
-	0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x33, 0x20, 0x31, 
-	0x32, 0x63, 0x2d, 0x31, 0x2e, 0x37, 0x33, 0x2d, 0x34, 0x2e, 
-	0x30, 0x32, 0x2d, 0x36, 0x2e, 0x30, 0x33, 0x2d, 0x37, 0x2d, 
-	0x31, 0x31, 0x2d, 0x37, 0x2d, 0x31, 0x2e, 0x35, 0x20, 0x30, 
-	0x2d, 0x32, 0x2e, 0x39, 0x34, 0x2e, 0x32, 0x37, 0x2d, 0x34, 
-	0x2e, 0x32, 0x37, 0x2e, 0x37, 0x36, 0x6c, 0x32, 0x2e, 0x33, 
-	0x39, 0x20, 0x32, 0x2e, 0x33, 0x39, 0x43, 0x31, 0x30, 0x2e, 
-	0x37, 0x20, 0x37, 0x2e, 0x34, 0x31, 0x20, 0x31, 0x31, 0x2e, 
-	0x33, 0x33, 0x20, 0x37, 0x20, 0x31, 0x32, 0x20, 0x37, 0x7a, 
-	0x22, 0x2f, 0x3e, 0x3c, 0x2f, 0x73, 0x76, 0x67, 0x3e, 0x27, 
-	0x3b, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x69, 
-	0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x53, 0x74, 0x61, 0x74, 
-	0x65, 0x20, 0x3d, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 
+	0x61, 0x74, 0x65, 0x56, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 
+	0x69, 0x74, 0x79, 0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
+	0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x73, 0x65, 0x74, 0x50, 0x61, 0x73, 0x73, 
+	0x77, 0x6f, 0x72, 0x64, 0x56, 0x69, 0x73, 0x69, 0x62, 0x69, 
+	0x6c, 0x69, 0x74, 0x79, 0x28, 0x76, 0x69, 0x73, 0x69, 0x62, 
+	0x6c, 0x65, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x3a, 0x20, 0x22, 0x3c, 
-	0x21, 0x2d, 0x2d, 0x23, 0x57, 0x46, 0x49, 0x4d, 0x4f, 0x44, 
-	0x45, 0x2d, 0x2d, 0x3e, 0x22, 0x2e, 0x74, 0x72, 0x69, 0x6d, 
-	0x28, 0x29, 0x20, 0x7c, 0x7c, 0x20, 0x22, 0x30, 0x22, 0x2c, 
+	0x20, 0x20, 0x77, 0x69, 0x66, 0x69, 0x50, 0x61, 0x73, 0x73, 
+	0x77, 0x6f, 0x72, 0x64, 0x2e, 0x74, 0x79, 0x70, 0x65, 0x20, 
+	0x3d, 0x20, 0x76, 0x69, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x20, 
+	0x3f, 0x20, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x3a, 
+	0x20, 0x22, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 
+	0x22, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+	0x6f, 0x67, 0x67, 0x6c, 0x65, 0x50, 0x61, 0x73, 0x73, 0x77, 
+	0x6f, 0x72, 0x64, 0x56, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 
+	0x69, 0x74, 0x79, 0x2e, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48, 
+	0x54, 0x4d, 0x4c, 0x20, 0x3d, 0x20, 0x76, 0x69, 0x73, 0x69, 
+	0x62, 0x6c, 0x65, 0x20, 0x3f, 0x20, 0x65, 0x79, 0x65, 0x43, 
+	0x6c, 0x6f, 0x73, 0x65, 0x64, 0x53, 0x76, 0x67, 0x20, 0x3a, 
+	0x20, 0x65, 0x79, 0x65, 0x4f, 0x70, 0x65, 0x6e, 0x53, 0x76, 
+	0x67, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+	0x6f, 0x67, 0x67, 0x6c, 0x65, 0x50, 0x61, 0x73, 0x73, 0x77, 
+	0x6f, 0x72, 0x64, 0x56, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 
+	0x69, 0x74, 0x79, 0x2e, 0x73, 0x65, 0x74, 0x41, 0x74, 0x74, 
+	0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x61, 0x72, 
+	0x69, 0x61, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x2c, 
+	0x20, 0x76, 0x69, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x20, 0x3f, 
+	0x20, 0x22, 0x48, 0x69, 0x64, 0x65, 0x20, 0x70, 0x61, 0x73, 
+	0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x20, 0x3a, 0x20, 0x22, 
+	0x53, 0x68, 0x6f, 0x77, 0x20, 0x70, 0x61, 0x73, 0x73, 0x77, 
+	0x6f, 0x72, 0x64, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x50, 
+	0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x56, 0x69, 0x73, 
+	0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x2e, 0x73, 0x65, 
+	0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 
+	0x28, 0x22, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x22, 0x2c, 0x20, 
+	0x76, 0x69, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x20, 0x3f, 0x20, 
+	0x22, 0x48, 0x69, 0x64, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 
+	0x77, 0x6f, 0x72, 0x64, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x53, 
+	0x68, 0x6f, 0x77, 0x20, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 
+	0x72, 0x64, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x6f, 0x73, 
-	0x74, 0x6e, 0x61, 0x6d, 0x65, 0x3a, 0x20, 0x22, 0x3c, 0x21, 
-	0x2d, 0x2d, 0x23, 0x57, 0x46, 0x49, 0x48, 0x4f, 0x53, 0x54, 
-	0x2d, 0x2d, 0x3e, 0x22, 0x2e, 0x74, 0x72, 0x69, 0x6d, 0x28, 
-	0x29, 0x20, 0x7c, 0x7c, 0x20, 0x22, 0x63, 0x72, 0x6f, 0x69, 
-	0x73, 0x73, 0x61, 0x6e, 0x74, 0x22, 0x2c, 0xa, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x73, 0x73, 0x69, 0x64, 0x3a, 0x20, 
-	0x22, 0x3c, 0x21, 0x2d, 0x2d, 0x23, 0x57, 0x46, 0x49, 0x53, 
-	0x53, 0x49, 0x44, 0x2d, 0x2d, 0x3e, 0x22, 0x2e, 0x74, 0x72, 
-	0x69, 0x6d, 0x28, 0x29, 0x20, 0x7c, 0x7c, 0x20, 0x22, 0x22, 
-	0x2c, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 
-	0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x3a, 0x20, 0x22, 0x3c, 
-	0x21, 0x2d, 0x2d, 0x23, 0x57, 0x46, 0x49, 0x50, 0x41, 0x53, 
-	0x53, 0x2d, 0x2d, 0x3e, 0x22, 0x2e, 0x74, 0x72, 0x69, 0x6d, 
-	0x28, 0x29, 0x20, 0x7c, 0x7c, 0x20, 0x22, 0x22, 0x2c, 0xa, 
+	0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+	0x6e, 0x20, 0x69, 0x73, 0x56, 0x61, 0x6c, 0x69, 0x64, 0x53, 
+	0x74, 0x61, 0x74, 0x69, 0x63, 0x49, 0x70, 0x28, 0x76, 0x61, 
+	0x6c, 0x75, 0x65, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x75, 0x74, 0x68, 
-	0x3a, 0x20, 0x22, 0x3c, 0x21, 0x2d, 0x2d, 0x23, 0x57, 0x46, 
-	0x49, 0x41, 0x55, 0x54, 0x48, 0x2d, 0x2d, 0x3e, 0x22, 0x2e, 
-	0x74, 0x72, 0x69, 0x6d, 0x28, 0x29, 0x20, 0x7c, 0x7c, 0x20, 
-	0x22, 0x30, 0x22, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x70, 0x61, 0x72, 
+	0x74, 0x73, 0x20, 0x3d, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+	0x2e, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x28, 0x22, 0x2c, 0x22, 
+	0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 
+	0x66, 0x20, 0x28, 0x70, 0x61, 0x72, 0x74, 0x73, 0x2e, 0x6c, 
+	0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3c, 0x20, 0x33, 0x20, 
+	0x7c, 0x7c, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x2e, 0x6c, 
+	0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3e, 0x20, 0x34, 0x29, 
+	0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x76, 0x61, 0x72, 0x20, 0x72, 0x65, 0x73, 0x65, 0x74, 
-	0x53, 0x74, 0x61, 0x74, 0x65, 0x20, 0x3d, 0x20, 0x7b, 0xa, 
+	0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 
+	0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x64, 0x65, 
-	0x3a, 0x20, 0x22, 0x30, 0x22, 0x2c, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x6e, 0x61, 0x6d, 
-	0x65, 0x3a, 0x20, 0x22, 0x63, 0x72, 0x6f, 0x69, 0x73, 0x73, 
-	0x61, 0x6e, 0x74, 0x22, 0x2c, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x70, 0x61, 
+	0x72, 0x74, 0x73, 0x2e, 0x65, 0x76, 0x65, 0x72, 0x79, 0x28, 
+	0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 
+	0x70, 0x61, 0x72, 0x74, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x73, 0x73, 0x69, 0x64, 0x3a, 0x20, 0x22, 0x22, 
-	0x2c, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 
-	0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x3a, 0x20, 0x22, 0x73, 
-	0x69, 0x64, 0x65, 0x63, 0x61, 0x72, 0x74, 0x22, 0x2c, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 
+	0x72, 0x20, 0x6f, 0x63, 0x74, 0x65, 0x74, 0x73, 0x20, 0x3d, 
+	0x20, 0x70, 0x61, 0x72, 0x74, 0x2e, 0x73, 0x70, 0x6c, 0x69, 
+	0x74, 0x28, 0x22, 0x2e, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x75, 0x74, 0x68, 
-	0x3a, 0x20, 0x22, 0x35, 0x22, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x3b, 
-	0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
-	0x6f, 0x6e, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x53, 0x74, 0x61, 
-	0x74, 0x75, 0x73, 0x28, 0x6b, 0x69, 0x6e, 0x64, 0x2c, 0x20, 
-	0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x29, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 
-	0x74, 0x75, 0x73, 0x42, 0x6f, 0x78, 0x2e, 0x63, 0x6c, 0x61, 
-	0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x22, 
-	0x62, 0x61, 0x6e, 0x6e, 0x65, 0x72, 0x20, 0x22, 0x20, 0x2b, 
-	0x20, 0x28, 0x6b, 0x69, 0x6e, 0x64, 0x20, 0x3d, 0x3d, 0x3d, 
-	0x20, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x20, 0x3f, 
-	0x20, 0x22, 0x62, 0x61, 0x6e, 0x6e, 0x65, 0x72, 0x2d, 0x65, 
-	0x72, 0x72, 0x6f, 0x72, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x62, 
-	0x61, 0x6e, 0x6e, 0x65, 0x72, 0x2d, 0x73, 0x75, 0x63, 0x63, 
-	0x65, 0x73, 0x73, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+	0x74, 0x75, 0x72, 0x6e, 0x20, 0x6f, 0x63, 0x74, 0x65, 0x74, 
+	0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3d, 
+	0x3d, 0x3d, 0x20, 0x34, 0x20, 0x26, 0x26, 0x20, 0x6f, 0x63, 
+	0x74, 0x65, 0x74, 0x73, 0x2e, 0x65, 0x76, 0x65, 0x72, 0x79, 
+	0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x28, 0x6f, 0x63, 0x74, 0x65, 0x74, 0x29, 0x20, 0x7b, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x42, 
-	0x6f, 0x78, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 
-	0x74, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x6d, 0x65, 0x73, 
-	0x73, 0x61, 0x67, 0x65, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x42, 0x6f, 
-	0x78, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x64, 0x69, 
-	0x73, 0x70, 0x6c, 0x61, 0x79, 0x20, 0x3d, 0x20, 0x22, 0x66, 
-	0x6c, 0x65, 0x78, 0x22, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
-	0x6e, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x53, 0x74, 0x61, 
-	0x74, 0x75, 0x73, 0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 
+	0x20, 0x2f, 0x5e, 0x5c, 0x64, 0x7b, 0x31, 0x2c, 0x33, 0x7d, 
+	0x24, 0x2f, 0x2e, 0x74, 0x65, 0x73, 0x74, 0x28, 0x6f, 0x63, 
+	0x74, 0x65, 0x74, 0x29, 0x20, 0x26, 0x26, 0x20, 0x70, 0x61, 
+	0x72, 0x73, 0x65, 0x49, 0x6e, 0x74, 0x28, 0x6f, 0x63, 0x74, 
+	0x65, 0x74, 0x2c, 0x20, 0x31, 0x30, 0x29, 0x20, 0x3c, 0x3d, 
+	0x20, 0x32, 0x35, 0x35, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 
-	0x42, 0x6f, 0x78, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 
-	0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x20, 0x3d, 0x20, 
-	0x22, 0x6e, 0x6f, 0x6e, 0x65, 0x22, 0x3b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 
-	0x42, 0x6f, 0x78, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 
-	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x22, 
-	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 
-	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x75, 0x70, 
-	0x64, 0x61, 0x74, 0x65, 0x56, 0x69, 0x73, 0x69, 0x62, 0x69, 
-	0x6c, 0x69, 0x74, 0x79, 0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x73, 
-	0x74, 0x61, 0x4d, 0x6f, 0x64, 0x65, 0x20, 0x3d, 0x20, 0x77, 
-	0x69, 0x66, 0x69, 0x4d, 0x6f, 0x64, 0x65, 0x2e, 0x76, 0x61, 
-	0x6c, 0x75, 0x65, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x22, 0x31, 
-	0x22, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
-	0x74, 0x61, 0x4f, 0x6e, 0x6c, 0x79, 0x52, 0x6f, 0x77, 0x73, 
-	0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x66, 
-	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x72, 
-	0x6f, 0x77, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x75, 0x69, 0x6c, 
+	0x64, 0x50, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x28, 0x29, 
+	0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5b, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6f, 0x77, 0x2e, 
-	0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x64, 0x69, 0x73, 0x70, 
-	0x6c, 0x61, 0x79, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x61, 0x4d, 
-	0x6f, 0x64, 0x65, 0x20, 0x3f, 0x20, 0x22, 0x67, 0x72, 0x69, 
-	0x64, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6e, 0x6f, 0x6e, 0x65, 
-	0x22, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
-	0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 
+	0x6e, 0x61, 0x6d, 0x65, 0x3a, 0x20, 0x22, 0x57, 0x49, 0x46, 
+	0x49, 0x5f, 0x4d, 0x4f, 0x44, 0x45, 0x22, 0x2c, 0x20, 0x74, 
+	0x79, 0x70, 0x65, 0x3a, 0x20, 0x22, 0x49, 0x4e, 0x54, 0x22, 
+	0x2c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x20, 0x77, 
+	0x69, 0x66, 0x69, 0x4d, 0x6f, 0x64, 0x65, 0x2e, 0x76, 0x61, 
+	0x6c, 0x75, 0x65, 0x20, 0x7d, 0x2c, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 
-	0x70, 0x70, 0x6c, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 
-	0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x20, 0x7b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x6e, 
+	0x61, 0x6d, 0x65, 0x3a, 0x20, 0x22, 0x48, 0x4f, 0x53, 0x54, 
+	0x4e, 0x41, 0x4d, 0x45, 0x22, 0x2c, 0x20, 0x74, 0x79, 0x70, 
+	0x65, 0x3a, 0x20, 0x22, 0x53, 0x54, 0x52, 0x49, 0x4e, 0x47, 
+	0x22, 0x2c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x20, 
+	0x77, 0x69, 0x66, 0x69, 0x48, 0x6f, 0x73, 0x74, 0x6e, 0x61, 
+	0x6d, 0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x74, 
+	0x72, 0x69, 0x6d, 0x28, 0x29, 0x20, 0x7d, 0x2c, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x66, 0x69, 0x4d, 
-	0x6f, 0x64, 0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 
-	0x3d, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x6d, 0x6f, 
-	0x64, 0x65, 0x20, 0x7c, 0x7c, 0x20, 0x22, 0x30, 0x22, 0x3b, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 
+	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3a, 0x20, 0x22, 0x57, 0x49, 
+	0x46, 0x49, 0x5f, 0x53, 0x53, 0x49, 0x44, 0x22, 0x2c, 0x20, 
+	0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x22, 0x53, 0x54, 0x52, 
+	0x49, 0x4e, 0x47, 0x22, 0x2c, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+	0x65, 0x3a, 0x20, 0x77, 0x69, 0x66, 0x69, 0x53, 0x73, 0x69, 
+	0x64, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x74, 0x72, 
+	0x69, 0x6d, 0x28, 0x29, 0x20, 0x7d, 0x2c, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 
+	0x6e, 0x61, 0x6d, 0x65, 0x3a, 0x20, 0x22, 0x57, 0x49, 0x46, 
+	0x49, 0x5f, 0x50, 0x41, 0x53, 0x53, 0x57, 0x4f, 0x52, 0x44, 
+	0x22, 0x2c, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x22, 
+	0x53, 0x54, 0x52, 0x49, 0x4e, 0x47, 0x22, 0x2c, 0x20, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x3a, 0x20, 0x77, 0x69, 0x66, 0x69, 
+	0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x2e, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x20, 0x7d, 0x2c, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 
+	0x6e, 0x61, 0x6d, 0x65, 0x3a, 0x20, 0x22, 0x57, 0x49, 0x46, 
+	0x49, 0x5f, 0x41, 0x55, 0x54, 0x48, 0x22, 0x2c, 0x20, 0x74, 
+	0x79, 0x70, 0x65, 0x3a, 0x20, 0x22, 0x49, 0x4e, 0x54, 0x22, 
+	0x2c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x20, 0x77, 
+	0x69, 0x66, 0x69, 0x41, 0x75, 0x74, 0x68, 0x2e, 0x76, 0x61, 
+	0x6c, 0x75, 0x65, 0x20, 0x7d, 0x2c, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x6e, 
+	0x61, 0x6d, 0x65, 0x3a, 0x20, 0x22, 0x57, 0x49, 0x46, 0x49, 
+	0x5f, 0x41, 0x50, 0x5f, 0x43, 0x48, 0x41, 0x4e, 0x4e, 0x45, 
+	0x4c, 0x22, 0x2c, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 
+	0x22, 0x49, 0x4e, 0x54, 0x22, 0x2c, 0x20, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x3a, 0x20, 0x77, 0x69, 0x66, 0x69, 0x41, 0x70, 
+	0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x2e, 0x76, 0x61, 
+	0x6c, 0x75, 0x65, 0x20, 0x7d, 0x2c, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x6e, 
+	0x61, 0x6d, 0x65, 0x3a, 0x20, 0x22, 0x57, 0x49, 0x46, 0x49, 
+	0x5f, 0x53, 0x54, 0x41, 0x54, 0x49, 0x43, 0x5f, 0x49, 0x50, 
+	0x22, 0x2c, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x22, 
+	0x53, 0x54, 0x52, 0x49, 0x4e, 0x47, 0x22, 0x2c, 0x20, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x3a, 0x20, 0x77, 0x69, 0x66, 0x69, 
+	0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x49, 0x70, 0x2e, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x2e, 0x72, 0x65, 0x70, 0x6c, 0x61, 
+	0x63, 0x65, 0x28, 0x2f, 0x5c, 0x73, 0x2b, 0x2f, 0x67, 0x2c, 
+	0x20, 0x22, 0x22, 0x29, 0x20, 0x7d, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x5d, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x66, 
-	0x69, 0x48, 0x6f, 0x73, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 
-	0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x74, 
-	0x61, 0x74, 0x65, 0x2e, 0x68, 0x6f, 0x73, 0x74, 0x6e, 0x61, 
-	0x6d, 0x65, 0x20, 0x7c, 0x7c, 0x20, 0x22, 0x63, 0x72, 0x6f, 
-	0x69, 0x73, 0x73, 0x61, 0x6e, 0x74, 0x22, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
+	0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 
+	0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x73, 0x61, 
+	0x76, 0x65, 0x2d, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x63, 0x6f, 
+	0x6e, 0x66, 0x69, 0x67, 0x22, 0x29, 0x2e, 0x61, 0x64, 0x64, 
+	0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 
+	0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6c, 0x69, 0x63, 0x6b, 
+	0x22, 0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+	0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x66, 0x69, 0x53, 
-	0x73, 0x69, 0x64, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 
-	0x3d, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 0x73, 
-	0x69, 0x64, 0x20, 0x7c, 0x7c, 0x20, 0x22, 0x22, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x53, 0x74, 
+	0x61, 0x74, 0x75, 0x73, 0x28, 0x29, 0x3b, 0xa, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x66, 0x69, 
-	0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x2e, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x61, 
-	0x74, 0x65, 0x2e, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 
-	0x64, 0x20, 0x7c, 0x7c, 0x20, 0x22, 0x22, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x77, 
+	0x69, 0x66, 0x69, 0x4d, 0x6f, 0x64, 0x65, 0x2e, 0x76, 0x61, 
+	0x6c, 0x75, 0x65, 0x20, 0x21, 0x3d, 0x3d, 0x20, 0x22, 0x30, 
+	0x22, 0x20, 0x26, 0x26, 0x20, 0x77, 0x69, 0x66, 0x69, 0x53, 
+	0x73, 0x69, 0x64, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 
+	0x74, 0x72, 0x69, 0x6d, 0x28, 0x29, 0x2e, 0x6c, 0x65, 0x6e, 
+	0x67, 0x74, 0x68, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x30, 0x29, 
+	0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x66, 0x69, 0x41, 
-	0x75, 0x74, 0x68, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 
-	0x3d, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x61, 0x75, 
-	0x74, 0x68, 0x20, 0x7c, 0x7c, 0x20, 0x22, 0x30, 0x22, 0x3b, 
+	0x20, 0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x53, 0x74, 0x61, 
+	0x74, 0x75, 0x73, 0x28, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+	0x22, 0x2c, 0x20, 0x22, 0x53, 0x53, 0x49, 0x44, 0x20, 0x69, 
+	0x73, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 
+	0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x53, 0x54, 0x41, 0x20, 
+	0x6d, 0x6f, 0x64, 0x65, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 
+	0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x2e, 0x22, 0x29, 0x3b, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 
-	0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x56, 0x69, 
-	0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x28, 0x66, 
-	0x61, 0x6c, 0x73, 0x65, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x56, 
-	0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x28, 
-	0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 
-	0x65, 0x74, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 
-	0x56, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 
-	0x28, 0x76, 0x69, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x29, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x73, 0x74, 
+	0x61, 0x74, 0x69, 0x63, 0x49, 0x70, 0x20, 0x3d, 0x20, 0x77, 
+	0x69, 0x66, 0x69, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x49, 
+	0x70, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x72, 0x65, 
+	0x70, 0x6c, 0x61, 0x63, 0x65, 0x28, 0x2f, 0x5c, 0x73, 0x2b, 
+	0x2f, 0x67, 0x2c, 0x20, 0x22, 0x22, 0x29, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 
+	0x74, 0x61, 0x74, 0x69, 0x63, 0x49, 0x70, 0x2e, 0x6c, 0x65, 
+	0x6e, 0x67, 0x74, 0x68, 0x20, 0x3e, 0x20, 0x30, 0x20, 0x26, 
+	0x26, 0x20, 0x21, 0x69, 0x73, 0x56, 0x61, 0x6c, 0x69, 0x64, 
+	0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x49, 0x70, 0x28, 0x73, 
+	0x74, 0x61, 0x74, 0x69, 0x63, 0x49, 0x70, 0x29, 0x29, 0x20, 
 	0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 
-	0x66, 0x69, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 
-	0x2e, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3d, 0x20, 0x76, 0x69, 
-	0x73, 0x69, 0x62, 0x6c, 0x65, 0x20, 0x3f, 0x20, 0x22, 0x74, 
-	0x65, 0x78, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x70, 0x61, 
-	0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x3b, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6f, 0x67, 0x67, 0x6c, 
-	0x65, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x56, 
-	0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x2e, 
-	0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 0x4d, 0x4c, 0x20, 
-	0x3d, 0x20, 0x76, 0x69, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x20, 
-	0x3f, 0x20, 0x65, 0x79, 0x65, 0x43, 0x6c, 0x6f, 0x73, 0x65, 
-	0x64, 0x53, 0x76, 0x67, 0x20, 0x3a, 0x20, 0x65, 0x79, 0x65, 
-	0x4f, 0x70, 0x65, 0x6e, 0x53, 0x76, 0x67, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 
+	0x75, 0x73, 0x28, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 
+	0x2c, 0x20, 0x22, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 
+	0x49, 0x50, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 
+	0x20, 0x69, 0x70, 0x2c, 0x6e, 0x65, 0x74, 0x6d, 0x61, 0x73, 
+	0x6b, 0x2c, 0x67, 0x61, 0x74, 0x65, 0x77, 0x61, 0x79, 0x5b, 
+	0x2c, 0x64, 0x6e, 0x73, 0x5d, 0x20, 0x77, 0x69, 0x74, 0x68, 
+	0x20, 0x64, 0x6f, 0x74, 0x74, 0x65, 0x64, 0x20, 0x49, 0x50, 
+	0x76, 0x34, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 
+	0x65, 0x73, 0x2e, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6f, 0x67, 0x67, 0x6c, 
-	0x65, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x56, 
-	0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x2e, 
-	0x73, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 
-	0x74, 0x65, 0x28, 0x22, 0x61, 0x72, 0x69, 0x61, 0x2d, 0x6c, 
-	0x61, 0x62, 0x65, 0x6c, 0x22, 0x2c, 0x20, 0x76, 0x69, 0x73, 
-	0x69, 0x62, 0x6c, 0x65, 0x20, 0x3f, 0x20, 0x22, 0x48, 0x69, 
-	0x64, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 
-	0x64, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x53, 0x68, 0x6f, 0x77, 
-	0x20, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 
-	0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
-	0x6f, 0x67, 0x67, 0x6c, 0x65, 0x50, 0x61, 0x73, 0x73, 0x77, 
-	0x6f, 0x72, 0x64, 0x56, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 
-	0x69, 0x74, 0x79, 0x2e, 0x73, 0x65, 0x74, 0x41, 0x74, 0x74, 
-	0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x74, 0x69, 
-	0x74, 0x6c, 0x65, 0x22, 0x2c, 0x20, 0x76, 0x69, 0x73, 0x69, 
-	0x62, 0x6c, 0x65, 0x20, 0x3f, 0x20, 0x22, 0x48, 0x69, 0x64, 
-	0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 
-	0x22, 0x20, 0x3a, 0x20, 0x22, 0x53, 0x68, 0x6f, 0x77, 0x20, 
-	0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x29, 
-	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 
-	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x75, 
-	0x69, 0x6c, 0x64, 0x50, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 
-	0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+	0x75, 0x72, 0x6e, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5b, 0xa, 
+	0x20, 0x7d, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x69, 0x66, 0x20, 0x28, 0x77, 0x69, 0x66, 0x69, 0x48, 0x6f, 
+	0x73, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x2e, 0x74, 0x72, 0x69, 0x6d, 0x28, 0x29, 0x2e, 
+	0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3d, 0x3d, 0x3d, 
+	0x20, 0x30, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x7b, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3a, 0x20, 0x22, 0x57, 
-	0x49, 0x46, 0x49, 0x5f, 0x4d, 0x4f, 0x44, 0x45, 0x22, 0x2c, 
-	0x20, 0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x22, 0x49, 0x4e, 
-	0x54, 0x22, 0x2c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 
-	0x20, 0x77, 0x69, 0x66, 0x69, 0x4d, 0x6f, 0x64, 0x65, 0x2e, 
-	0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x7d, 0x2c, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 
+	0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x22, 0x65, 0x72, 
+	0x72, 0x6f, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x48, 0x6f, 0x73, 
+	0x74, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x63, 0x61, 0x6e, 0x6e, 
+	0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x65, 0x6d, 0x70, 0x74, 
+	0x79, 0x2e, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 
-	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3a, 0x20, 0x22, 0x48, 0x4f, 
-	0x53, 0x54, 0x4e, 0x41, 0x4d, 0x45, 0x22, 0x2c, 0x20, 0x74, 
-	0x79, 0x70, 0x65, 0x3a, 0x20, 0x22, 0x53, 0x54, 0x52, 0x49, 
-	0x4e, 0x47, 0x22, 0x2c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x3a, 0x20, 0x77, 0x69, 0x66, 0x69, 0x48, 0x6f, 0x73, 0x74, 
-	0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x2e, 0x74, 0x72, 0x69, 0x6d, 0x28, 0x29, 0x20, 0x7d, 0x2c, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+	0x72, 0x6e, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x7b, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3a, 0x20, 0x22, 
-	0x57, 0x49, 0x46, 0x49, 0x5f, 0x53, 0x53, 0x49, 0x44, 0x22, 
-	0x2c, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x22, 0x53, 
-	0x54, 0x52, 0x49, 0x4e, 0x47, 0x22, 0x2c, 0x20, 0x76, 0x61, 
-	0x6c, 0x75, 0x65, 0x3a, 0x20, 0x77, 0x69, 0x66, 0x69, 0x53, 
-	0x73, 0x69, 0x64, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 
-	0x74, 0x72, 0x69, 0x6d, 0x28, 0x29, 0x20, 0x7d, 0x2c, 0xa, 
+	0x7d, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
+	0x61, 0x72, 0x20, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 
+	0x20, 0x3d, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x50, 0x61, 
+	0x79, 0x6c, 0x6f, 0x61, 0x64, 0x28, 0x29, 0x3b, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 
+	0x28, 0x22, 0x2f, 0x73, 0x61, 0x76, 0x65, 0x70, 0x61, 0x72, 
+	0x61, 0x6d, 0x73, 0x2e, 0x63, 0x67, 0x69, 0x22, 0x2c, 0x20, 
+	0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x7b, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3a, 0x20, 0x22, 0x57, 
-	0x49, 0x46, 0x49, 0x5f, 0x50, 0x41, 0x53, 0x53, 0x57, 0x4f, 
-	0x52, 0x44, 0x22, 0x2c, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3a, 
-	0x20, 0x22, 0x53, 0x54, 0x52, 0x49, 0x4e, 0x47, 0x22, 0x2c, 
-	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x20, 0x77, 0x69, 
-	0x66, 0x69, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 
-	0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x7d, 0x2c, 0xa, 
+	0x20, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3a, 0x20, 
+	0x22, 0x50, 0x4f, 0x53, 0x54, 0x22, 0x2c, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 
+	0x61, 0x64, 0x65, 0x72, 0x73, 0x3a, 0x20, 0x7b, 0x20, 0x22, 
+	0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 
+	0x70, 0x65, 0x22, 0x3a, 0x20, 0x22, 0x61, 0x70, 0x70, 0x6c, 
+	0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x6a, 0x73, 
+	0x6f, 0x6e, 0x22, 0x20, 0x7d, 0x2c, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x7b, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3a, 0x20, 0x22, 0x57, 
-	0x49, 0x46, 0x49, 0x5f, 0x41, 0x55, 0x54, 0x48, 0x22, 0x2c, 
-	0x20, 0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x22, 0x49, 0x4e, 
-	0x54, 0x22, 0x2c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 
-	0x20, 0x77, 0x69, 0x66, 0x69, 0x41, 0x75, 0x74, 0x68, 0x2e, 
-	0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x7d, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x64, 
+	0x79, 0x3a, 0x20, 0x4a, 0x53, 0x4f, 0x4e, 0x2e, 0x73, 0x74, 
+	0x72, 0x69, 0x6e, 0x67, 0x69, 0x66, 0x79, 0x28, 0x70, 0x61, 
+	0x79, 0x6c, 0x6f, 0x61, 0x64, 0x29, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x5d, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
-	0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 
-	0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 
-	0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x73, 
-	0x61, 0x76, 0x65, 0x2d, 0x77, 0x69, 0x66, 0x69, 0x2d, 0x63, 
-	0x6f, 0x6e, 0x66, 0x69, 0x67, 0x22, 0x29, 0x2e, 0x61, 0x64, 
-	0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 
-	0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6c, 0x69, 0x63, 
-	0x6b, 0x22, 0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
-	0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x7d, 0x29, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x53, 
-	0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x29, 0x3b, 0xa, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x74, 0x68, 0x65, 
+	0x6e, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x28, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 
+	0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 
+	0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 
+	0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x3b, 0x20, 0x7d, 0x29, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 
-	0x77, 0x69, 0x66, 0x69, 0x4d, 0x6f, 0x64, 0x65, 0x2e, 0x76, 
-	0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x22, 
-	0x31, 0x22, 0x20, 0x26, 0x26, 0x20, 0x77, 0x69, 0x66, 0x69, 
-	0x53, 0x73, 0x69, 0x64, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x2e, 0x74, 0x72, 0x69, 0x6d, 0x28, 0x29, 0x2e, 0x6c, 0x65, 
-	0x6e, 0x67, 0x74, 0x68, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x30, 
-	0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x66, 0x75, 0x6e, 
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x74, 0x65, 0x78, 
+	0x74, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x53, 0x74, 
-	0x61, 0x74, 0x75, 0x73, 0x28, 0x22, 0x65, 0x72, 0x72, 0x6f, 
-	0x72, 0x22, 0x2c, 0x20, 0x22, 0x53, 0x53, 0x49, 0x44, 0x20, 
-	0x69, 0x73, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 
-	0x64, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x53, 0x54, 0x41, 
-	0x20, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x69, 0x73, 0x20, 0x73, 
-	0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x2e, 0x22, 0x29, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+	0x72, 0x79, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x64, 0x61, 0x74, 
+	0x61, 0x20, 0x3d, 0x20, 0x4a, 0x53, 0x4f, 0x4e, 0x2e, 0x70, 
+	0x61, 0x72, 0x73, 0x65, 0x28, 0x74, 0x65, 0x78, 0x74, 0x29, 
 	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 0xa, 0x20, 
+	0x69, 0x66, 0x20, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x73, 
+	0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 
+	0x32, 0x30, 0x30, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x77, 
-	0x69, 0x66, 0x69, 0x48, 0x6f, 0x73, 0x74, 0x6e, 0x61, 0x6d, 
-	0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x74, 0x72, 
-	0x69, 0x6d, 0x28, 0x29, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 
-	0x68, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x73, 0x68, 0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 0x75, 
-	0x73, 0x28, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x2c, 
-	0x20, 0x22, 0x48, 0x6f, 0x73, 0x74, 0x6e, 0x61, 0x6d, 0x65, 
-	0x20, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 
-	0x20, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x2e, 0x22, 0x29, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 
+	0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x53, 0x74, 0x61, 0x74, 
+	0x65, 0x2e, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x3d, 0x20, 0x77, 
+	0x69, 0x66, 0x69, 0x4d, 0x6f, 0x64, 0x65, 0x2e, 0x76, 0x61, 
+	0x6c, 0x75, 0x65, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x69, 
+	0x74, 0x69, 0x61, 0x6c, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2e, 
+	0x68, 0x6f, 0x73, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 
+	0x20, 0x77, 0x69, 0x66, 0x69, 0x48, 0x6f, 0x73, 0x74, 0x6e, 
+	0x61, 0x6d, 0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 
+	0x74, 0x72, 0x69, 0x6d, 0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x70, 0x61, 
-	0x79, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x3d, 0x20, 0x62, 0x75, 
-	0x69, 0x6c, 0x64, 0x50, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 
-	0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x76, 0x61, 0x72, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 
-	0x64, 0x20, 0x3d, 0x20, 0x62, 0x74, 0x6f, 0x61, 0x28, 0x4a, 
-	0x53, 0x4f, 0x4e, 0x2e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 
-	0x69, 0x66, 0x79, 0x28, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 
-	0x64, 0x29, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x22, 0x2f, 0x73, 
-	0x61, 0x76, 0x65, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x2e, 
-	0x63, 0x67, 0x69, 0x3f, 0x6a, 0x73, 0x6f, 0x6e, 0x3d, 0x22, 
-	0x20, 0x2b, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x55, 
-	0x52, 0x49, 0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 
-	0x74, 0x28, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x64, 0x29, 
-	0x29, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x66, 0x75, 
-	0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x72, 0x65, 
-	0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x29, 0x20, 0x7b, 0x20, 
-	0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x65, 0x73, 
-	0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x74, 0x65, 0x78, 0x74, 
-	0x28, 0x29, 0x3b, 0x20, 0x7d, 0x29, 0xa, 0x20, 0x20, 0x20, 
+	0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x53, 0x74, 0x61, 
+	0x74, 0x65, 0x2e, 0x73, 0x73, 0x69, 0x64, 0x20, 0x3d, 0x20, 
+	0x77, 0x69, 0x66, 0x69, 0x53, 0x73, 0x69, 0x64, 0x2e, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x2e, 0x74, 0x72, 0x69, 0x6d, 0x28, 
+	0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x74, 0x68, 
-	0x65, 0x6e, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
-	0x6e, 0x20, 0x28, 0x74, 0x65, 0x78, 0x74, 0x29, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x79, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 
+	0x61, 0x6c, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x70, 0x61, 
+	0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x20, 0x3d, 0x20, 0x77, 
+	0x69, 0x66, 0x69, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 
+	0x64, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
-	0x61, 0x72, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3d, 0x20, 
-	0x4a, 0x53, 0x4f, 0x4e, 0x2e, 0x70, 0x61, 0x72, 0x73, 0x65, 
-	0x28, 0x74, 0x65, 0x78, 0x74, 0x29, 0x3b, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 
-	0x64, 0x61, 0x74, 0x61, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 
-	0x73, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x32, 0x30, 0x30, 0x29, 
-	0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x53, 0x74, 
+	0x61, 0x74, 0x65, 0x2e, 0x61, 0x75, 0x74, 0x68, 0x20, 0x3d, 
+	0x20, 0x77, 0x69, 0x66, 0x69, 0x41, 0x75, 0x74, 0x68, 0x2e, 
+	0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 
-	0x61, 0x6c, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x6d, 0x6f, 
-	0x64, 0x65, 0x20, 0x3d, 0x20, 0x77, 0x69, 0x66, 0x69, 0x4d, 
-	0x6f, 0x64, 0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 
+	0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x53, 0x74, 0x61, 0x74, 
+	0x65, 0x2e, 0x61, 0x70, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 
+	0x6c, 0x20, 0x3d, 0x20, 0x77, 0x69, 0x66, 0x69, 0x41, 0x70, 
+	0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x2e, 0x76, 0x61, 
+	0x6c, 0x75, 0x65, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x69, 
+	0x74, 0x69, 0x61, 0x6c, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2e, 
+	0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x49, 0x70, 0x20, 0x3d, 
+	0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x49, 0x70, 0x3b, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 
-	0x53, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x68, 0x6f, 0x73, 0x74, 
-	0x6e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x77, 0x69, 0x66, 
-	0x69, 0x48, 0x6f, 0x73, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 
-	0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x74, 0x72, 0x69, 0x6d, 
-	0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x53, 0x74, 0x61, 
+	0x74, 0x75, 0x73, 0x28, 0x22, 0x73, 0x75, 0x63, 0x63, 0x65, 
+	0x73, 0x73, 0x22, 0x2c, 0x20, 0x22, 0x57, 0x69, 0x2d, 0x46, 
+	0x69, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x20, 0x73, 0x61, 0x76, 0x65, 0x64, 0x20, 0x73, 0x75, 0x63, 
+	0x63, 0x65, 0x73, 0x73, 0x66, 0x75, 0x6c, 0x6c, 0x79, 0x2e, 
+	0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 
+	0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x61, 
+	0x66, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20, 0x70, 0x6f, 0x77, 
+	0x65, 0x72, 0x20, 0x63, 0x79, 0x63, 0x6c, 0x65, 0x20, 0x69, 
+	0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x70, 
+	0x75, 0x74, 0x65, 0x72, 0x2e, 0x22, 0x29, 0x3b, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x69, 0x74, 
-	0x69, 0x61, 0x6c, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x73, 
-	0x73, 0x69, 0x64, 0x20, 0x3d, 0x20, 0x77, 0x69, 0x66, 0x69, 
-	0x53, 0x73, 0x69, 0x64, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 
-	0x2e, 0x74, 0x72, 0x69, 0x6d, 0x28, 0x29, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x65, 
+	0x6c, 0x73, 0x65, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 
+	0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x22, 
+	0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x2c, 0x20, 0x64, 0x61, 
+	0x74, 0x61, 0x2e, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 
+	0x20, 0x7c, 0x7c, 0x20, 0x22, 0x55, 0x6e, 0x61, 0x62, 0x6c, 
+	0x65, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 
+	0x57, 0x69, 0x2d, 0x46, 0x69, 0x20, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x22, 0x29, 0x3b, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x53, 0x74, 
-	0x61, 0x74, 0x65, 0x2e, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 
-	0x72, 0x64, 0x20, 0x3d, 0x20, 0x77, 0x69, 0x66, 0x69, 0x50, 
-	0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x2e, 0x76, 0x61, 
-	0x6c, 0x75, 0x65, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x69, 
-	0x74, 0x69, 0x61, 0x6c, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2e, 
-	0x61, 0x75, 0x74, 0x68, 0x20, 0x3d, 0x20, 0x77, 0x69, 0x66, 
-	0x69, 0x41, 0x75, 0x74, 0x68, 0x2e, 0x76, 0x61, 0x6c, 0x75, 
-	0x65, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x7d, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 
+	0x20, 0x28, 0x65, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x53, 
-	0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x22, 0x73, 0x75, 0x63, 
-	0x63, 0x65, 0x73, 0x73, 0x22, 0x2c, 0x20, 0x22, 0x57, 0x69, 
-	0x2d, 0x46, 0x69, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
-	0x67, 0x73, 0x20, 0x73, 0x61, 0x76, 0x65, 0x64, 0x20, 0x73, 
-	0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x66, 0x75, 0x6c, 0x6c, 
-	0x79, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x65, 0x77, 
-	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x77, 0x69, 
-	0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 
-	0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20, 0x70, 
-	0x6f, 0x77, 0x65, 0x72, 0x20, 0x63, 0x79, 0x63, 0x6c, 0x65, 
-	0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 
-	0x6d, 0x70, 0x75, 0x74, 0x65, 0x72, 0x2e, 0x22, 0x29, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x22, 0x65, 0x72, 0x72, 
+	0x6f, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x55, 0x6e, 0x65, 0x78, 
+	0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x72, 0x65, 0x73, 
+	0x70, 0x6f, 0x6e, 0x73, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 
+	0x65, 0x2e, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
-	0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x7d, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0x29, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x63, 0x61, 0x74, 0x63, 
+	0x68, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x73, 0x68, 0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 
 	0x28, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x2c, 0x20, 
-	0x64, 0x61, 0x74, 0x61, 0x2e, 0x6d, 0x65, 0x73, 0x73, 0x61, 
-	0x67, 0x65, 0x20, 0x7c, 0x7c, 0x20, 0x22, 0x55, 0x6e, 0x61, 
-	0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x61, 0x76, 
-	0x65, 0x20, 0x57, 0x69, 0x2d, 0x46, 0x69, 0x20, 0x73, 0x65, 
+	0x22, 0x4e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x65, 
+	0x72, 0x72, 0x6f, 0x72, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 
+	0x20, 0x73, 0x61, 0x76, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x65, 
 	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x22, 0x29, 0x3b, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x7d, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 
+	0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 
+	0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 
+	0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x72, 
+	0x65, 0x73, 0x65, 0x74, 0x2d, 0x77, 0x69, 0x66, 0x69, 0x2d, 
+	0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x22, 0x29, 0x2e, 0x61, 
+	0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 
+	0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6c, 0x69, 
+	0x63, 0x6b, 0x22, 0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 
+	0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x63, 0x61, 0x74, 
-	0x63, 0x68, 0x20, 0x28, 0x65, 0x29, 0x20, 0x7b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 
+	0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 0x72, 0x65, 0x73, 0x65, 
+	0x74, 0x53, 0x74, 0x61, 0x74, 0x65, 0x29, 0x3b, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 
+	0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x29, 0x3b, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6f, 
-	0x77, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x22, 0x65, 
-	0x72, 0x72, 0x6f, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x55, 0x6e, 
-	0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x72, 
-	0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x20, 0x66, 0x72, 
-	0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x76, 
-	0x69, 0x63, 0x65, 0x2e, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0x29, 0x3b, 0xa, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6b, 
+	0x6e, 0x6f, 0x77, 0x6e, 0x41, 0x64, 0x64, 0x2e, 0x61, 0x64, 
+	0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 
+	0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6c, 0x69, 0x63, 
+	0x6b, 0x22, 0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x53, 
+	0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x29, 0x3b, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x73, 
+	0x73, 0x69, 0x64, 0x20, 0x3d, 0x20, 0x77, 0x69, 0x66, 0x69, 
+	0x53, 0x73, 0x69, 0x64, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+	0x2e, 0x74, 0x72, 0x69, 0x6d, 0x28, 0x29, 0x3b, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 
+	0x73, 0x69, 0x64, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 
+	0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x63, 0x61, 
-	0x74, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
-	0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x73, 0x68, 0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 
+	0x28, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x2c, 0x20, 
+	0x22, 0x45, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 
+	0x20, 0x53, 0x53, 0x49, 0x44, 0x20, 0x6f, 0x66, 0x20, 0x74, 
+	0x68, 0x65, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 
+	0x20, 0x74, 0x6f, 0x20, 0x61, 0x64, 0x64, 0x2e, 0x22, 0x29, 
+	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 
-	0x75, 0x73, 0x28, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 
-	0x2c, 0x20, 0x22, 0x4e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 
-	0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x77, 0x68, 0x69, 
-	0x6c, 0x65, 0x20, 0x73, 0x61, 0x76, 0x69, 0x6e, 0x67, 0x20, 
-	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x22, 
-	0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
-	0x29, 0x3b, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 
-	0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 
-	0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 
-	0x22, 0x72, 0x65, 0x73, 0x65, 0x74, 0x2d, 0x77, 0x69, 0x66, 
-	0x69, 0x2d, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x22, 0x29, 
-	0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 
-	0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 
-	0x6c, 0x69, 0x63, 0x6b, 0x22, 0x2c, 0x20, 0x66, 0x75, 0x6e, 
-	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 
-	0x6c, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 0x72, 0x65, 
-	0x73, 0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x65, 0x29, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6c, 0x65, 
-	0x61, 0x72, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x29, 
-	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 0xa, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x77, 0x69, 0x66, 0x69, 0x4d, 0x6f, 0x64, 0x65, 0x2e, 
-	0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 
-	0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x68, 
-	0x61, 0x6e, 0x67, 0x65, 0x22, 0x2c, 0x20, 0x66, 0x75, 0x6e, 
-	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 
+	0x20, 0x20, 0x20, 0x20, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x52, 
+	0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x28, 0x5b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 
+	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3a, 0x20, 0x22, 0x6f, 0x70, 
+	0x22, 0x2c, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x22, 
+	0x53, 0x54, 0x52, 0x49, 0x4e, 0x47, 0x22, 0x2c, 0x20, 0x76, 
+	0x61, 0x6c, 0x75, 0x65, 0x3a, 0x20, 0x22, 0x61, 0x64, 0x64, 
+	0x22, 0x20, 0x7d, 0x2c, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x6e, 0x61, 0x6d, 
+	0x65, 0x3a, 0x20, 0x22, 0x73, 0x73, 0x69, 0x64, 0x22, 0x2c, 
+	0x20, 0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x22, 0x53, 0x54, 
+	0x52, 0x49, 0x4e, 0x47, 0x22, 0x2c, 0x20, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x3a, 0x20, 0x73, 0x73, 0x69, 0x64, 0x20, 0x7d, 
+	0x2c, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x7b, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3a, 0x20, 
+	0x22, 0x70, 0x61, 0x73, 0x73, 0x22, 0x2c, 0x20, 0x74, 0x79, 
+	0x70, 0x65, 0x3a, 0x20, 0x22, 0x53, 0x54, 0x52, 0x49, 0x4e, 
+	0x47, 0x22, 0x2c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 
+	0x20, 0x77, 0x69, 0x66, 0x69, 0x50, 0x61, 0x73, 0x73, 0x77, 
+	0x6f, 0x72, 0x64, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 
+	0x7d, 0x2c, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x7b, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3a, 
+	0x20, 0x22, 0x61, 0x75, 0x74, 0x68, 0x22, 0x2c, 0x20, 0x74, 
+	0x79, 0x70, 0x65, 0x3a, 0x20, 0x22, 0x49, 0x4e, 0x54, 0x22, 
+	0x2c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3a, 0x20, 0x77, 
+	0x69, 0x66, 0x69, 0x41, 0x75, 0x74, 0x68, 0x2e, 0x76, 0x61, 
+	0x6c, 0x75, 0x65, 0x20, 0x7d, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x5d, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 
+	0x3b, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x66, 0x69, 0x4d, 
+	0x6f, 0x64, 0x65, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 
+	0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 
+	0x28, 0x22, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x22, 0x2c, 
+	0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x56, 0x69, 0x73, 
+	0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x28, 0x29, 0x3b, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 
-	0x61, 0x74, 0x65, 0x56, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 
-	0x69, 0x74, 0x79, 0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
-	0x29, 0x3b, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6f, 0x67, 0x67, 
-	0x6c, 0x65, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 
-	0x56, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 
+	0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 0xa, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x73, 0x63, 0x61, 0x6e, 0x42, 0x75, 0x74, 0x74, 0x6f, 0x6e, 
 	0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 
 	0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 
-	0x6c, 0x69, 0x63, 0x6b, 0x22, 0x2c, 0x20, 0x66, 0x75, 0x6e, 
-	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 
-	0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x56, 0x69, 
-	0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x28, 0x77, 
-	0x69, 0x66, 0x69, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 
-	0x64, 0x2e, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3d, 0x3d, 0x3d, 
-	0x20, 0x22, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 
-	0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 0xa, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x6c, 0x69, 0x63, 0x6b, 0x22, 0x2c, 0x20, 0x73, 0x74, 0x61, 
+	0x72, 0x74, 0x53, 0x63, 0x61, 0x6e, 0x29, 0x3b, 0xa, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x50, 0x61, 
+	0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x56, 0x69, 0x73, 0x69, 
+	0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x2e, 0x61, 0x64, 0x64, 
+	0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 
+	0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6c, 0x69, 0x63, 0x6b, 
+	0x22, 0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+	0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x50, 0x61, 0x73, 0x73, 
 	0x77, 0x6f, 0x72, 0x64, 0x56, 0x69, 0x73, 0x69, 0x62, 0x69, 
-	0x6c, 0x69, 0x74, 0x79, 0x28, 0x66, 0x61, 0x6c, 0x73, 0x65, 
-	0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 
-	0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 0x69, 0x6e, 0x69, 0x74, 
-	0x69, 0x61, 0x6c, 0x53, 0x74, 0x61, 0x74, 0x65, 0x29, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
-	0x29, 0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0xa, 0x3c, 
-	0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0xa, 0xa, 0x3c, 0x2f, 
-	0x68, 0x74, 0x6d, 0x6c, 0x3e, 0xa, };
+	0x6c, 0x69, 0x74, 0x79, 0x28, 0x77, 0x69, 0x66, 0x69, 0x50, 
+	0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x2e, 0x74, 0x79, 
+	0x70, 0x65, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x22, 0x70, 0x61, 
+	0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x29, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0x29, 0x3b, 0xa, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
+	0x65, 0x74, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 
+	0x56, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 
+	0x28, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x29, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x53, 0x74, 0x61, 0x74, 
+	0x65, 0x28, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x53, 
+	0x74, 0x61, 0x74, 0x65, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6b, 
+	0x6e, 0x6f, 0x77, 0x6e, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 
+	0x74, 0x28, 0x6e, 0x75, 0x6c, 0x6c, 0x29, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x28, 
+	0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 
+	0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0xa, 0x3c, 0x2f, 0x62, 
+	0x6f, 0x64, 0x79, 0x3e, 0xa, 0xa, 0x3c, 0x2f, 0x68, 0x74, 
+	0x6d, 0x6c, 0x3e, 0xa, };
 
 static const unsigned char data_mngr_usb_shtml[] = {
 	/* /mngr_usb.shtml */
@@ -6631,175 +6966,183 @@ static const unsigned char data_mngr_usb_shtml[] = {
 	0x69, 0x6c, 0x64, 0x50, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 
 	0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x76, 0x61, 0x72, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 
-	0x64, 0x20, 0x3d, 0x20, 0x62, 0x74, 0x6f, 0x61, 0x28, 0x4a, 
-	0x53, 0x4f, 0x4e, 0x2e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 
-	0x69, 0x66, 0x79, 0x28, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 
-	0x64, 0x29, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x22, 0x2f, 0x73, 
-	0x61, 0x76, 0x65, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x2e, 
-	0x63, 0x67, 0x69, 0x3f, 0x6a, 0x73, 0x6f, 0x6e, 0x3d, 0x22, 
-	0x20, 0x2b, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x55, 
-	0x52, 0x49, 0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 
-	0x74, 0x28, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x64, 0x29, 
-	0x29, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x22, 0x2f, 0x73, 0x61, 
+	0x76, 0x65, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x2e, 0x63, 
+	0x67, 0x69, 0x22, 0x2c, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x66, 0x75, 
-	0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x72, 0x65, 
-	0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x29, 0x20, 0x7b, 0x20, 
-	0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x65, 0x73, 
-	0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x74, 0x65, 0x78, 0x74, 
-	0x28, 0x29, 0x3b, 0x20, 0x7d, 0x29, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x65, 0x74, 
+	0x68, 0x6f, 0x64, 0x3a, 0x20, 0x22, 0x50, 0x4f, 0x53, 0x54, 
+	0x22, 0x2c, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x74, 0x68, 
-	0x65, 0x6e, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
-	0x6e, 0x20, 0x28, 0x74, 0x65, 0x78, 0x74, 0x29, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 
+	0x3a, 0x20, 0x7b, 0x20, 0x22, 0x43, 0x6f, 0x6e, 0x74, 0x65, 
+	0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 0x65, 0x22, 0x3a, 0x20, 
+	0x22, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 
+	0x6f, 0x6e, 0x2f, 0x6a, 0x73, 0x6f, 0x6e, 0x22, 0x20, 0x7d, 
+	0x2c, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x79, 0x20, 0x7b, 
+	0x20, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x3a, 0x20, 0x4a, 0x53, 
+	0x4f, 0x4e, 0x2e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x69, 
+	0x66, 0x79, 0x28, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 
+	0x29, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
-	0x61, 0x72, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3d, 0x20, 
-	0x4a, 0x53, 0x4f, 0x4e, 0x2e, 0x70, 0x61, 0x72, 0x73, 0x65, 
-	0x28, 0x74, 0x65, 0x78, 0x74, 0x29, 0x3b, 0xa, 0x20, 0x20, 
+	0x20, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x66, 0x75, 0x6e, 
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x72, 0x65, 0x73, 
+	0x70, 0x6f, 0x6e, 0x73, 0x65, 0x29, 0x20, 0x7b, 0x20, 0x72, 
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x65, 0x73, 0x70, 
+	0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x28, 
+	0x29, 0x3b, 0x20, 0x7d, 0x29, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x74, 0x68, 0x65, 
+	0x6e, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x28, 0x74, 0x65, 0x78, 0x74, 0x29, 0x20, 0x7b, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 
-	0x64, 0x61, 0x74, 0x61, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 
-	0x73, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x32, 0x30, 0x30, 0x29, 
-	0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x79, 0x20, 0x7b, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x53, 
-	0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x22, 0x73, 0x75, 0x63, 
-	0x63, 0x65, 0x73, 0x73, 0x22, 0x2c, 0x20, 0x22, 0x55, 0x53, 
-	0x42, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
-	0x20, 0x73, 0x61, 0x76, 0x65, 0x64, 0x20, 0x73, 0x75, 0x63, 
-	0x63, 0x65, 0x73, 0x73, 0x66, 0x75, 0x6c, 0x6c, 0x79, 0x2e, 
-	0x20, 0x54, 0x68, 0x65, 0x73, 0x65, 0x20, 0x73, 0x65, 0x74, 
-	0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 
-	0x20, 0x62, 0x65, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x65, 
-	0x64, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x6d, 0x61, 0x74, 0x69, 
-	0x63, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x61, 0x66, 0x74, 0x65, 
-	0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x6f, 0x77, 
-	0x65, 0x72, 0x2d, 0x6f, 0x6e, 0x2e, 0x22, 0x29, 0x3b, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 
+	0x72, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3d, 0x20, 0x4a, 
+	0x53, 0x4f, 0x4e, 0x2e, 0x70, 0x61, 0x72, 0x73, 0x65, 0x28, 
+	0x74, 0x65, 0x78, 0x74, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 
-	0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x64, 
+	0x61, 0x74, 0x61, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 
+	0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x32, 0x30, 0x30, 0x29, 0x20, 
+	0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
-	0x68, 0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 
-	0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x2c, 0x20, 0x64, 
-	0x61, 0x74, 0x61, 0x2e, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 
-	0x65, 0x20, 0x7c, 0x7c, 0x20, 0x22, 0x55, 0x6e, 0x61, 0x62, 
-	0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x61, 0x76, 0x65, 
-	0x20, 0x55, 0x53, 0x42, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 
-	0x6e, 0x67, 0x73, 0x2e, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x53, 0x74, 
+	0x61, 0x74, 0x75, 0x73, 0x28, 0x22, 0x73, 0x75, 0x63, 0x63, 
+	0x65, 0x73, 0x73, 0x22, 0x2c, 0x20, 0x22, 0x55, 0x53, 0x42, 
+	0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 
+	0x73, 0x61, 0x76, 0x65, 0x64, 0x20, 0x73, 0x75, 0x63, 0x63, 
+	0x65, 0x73, 0x73, 0x66, 0x75, 0x6c, 0x6c, 0x79, 0x2e, 0x20, 
+	0x54, 0x68, 0x65, 0x73, 0x65, 0x20, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 
+	0x62, 0x65, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x65, 0x64, 
+	0x20, 0x61, 0x75, 0x74, 0x6f, 0x6d, 0x61, 0x74, 0x69, 0x63, 
+	0x61, 0x6c, 0x6c, 0x79, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 
+	0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x6f, 0x77, 0x65, 
+	0x72, 0x2d, 0x6f, 0x6e, 0x2e, 0x22, 0x29, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x65, 
+	0x6c, 0x73, 0x65, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 
+	0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x22, 
+	0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x2c, 0x20, 0x64, 0x61, 
+	0x74, 0x61, 0x2e, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 
+	0x20, 0x7c, 0x7c, 0x20, 0x22, 0x55, 0x6e, 0x61, 0x62, 0x6c, 
+	0x65, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 
+	0x55, 0x53, 0x42, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x7d, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 
-	0x28, 0x65, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x7d, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 
+	0x65, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x53, 0x74, 
-	0x61, 0x74, 0x75, 0x73, 0x28, 0x22, 0x65, 0x72, 0x72, 0x6f, 
-	0x72, 0x22, 0x2c, 0x20, 0x22, 0x55, 0x6e, 0x65, 0x78, 0x70, 
-	0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x72, 0x65, 0x73, 0x70, 
-	0x6f, 0x6e, 0x73, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 
-	0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 
-	0x2e, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x53, 0x74, 0x61, 
+	0x74, 0x75, 0x73, 0x28, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+	0x22, 0x2c, 0x20, 0x22, 0x55, 0x6e, 0x65, 0x78, 0x70, 0x65, 
+	0x63, 0x74, 0x65, 0x64, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 
+	0x6e, 0x73, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 
+	0x68, 0x65, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2e, 
+	0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x7d, 0x29, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x2e, 0x63, 0x61, 0x74, 0x63, 0x68, 
-	0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
-	0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
-	0x68, 0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 
-	0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x2c, 0x20, 0x22, 
-	0x4e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x65, 0x72, 
-	0x72, 0x6f, 0x72, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 
-	0x73, 0x61, 0x76, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x65, 0x74, 
-	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x22, 0x29, 0x3b, 0xa, 
+	0x7d, 0x29, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x2e, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 
+	0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 
+	0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x7d, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 0xa, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
-	0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 
-	0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x72, 0x65, 
-	0x73, 0x65, 0x74, 0x2d, 0x75, 0x73, 0x62, 0x2d, 0x63, 0x6f, 
-	0x6e, 0x66, 0x69, 0x67, 0x22, 0x29, 0x2e, 0x61, 0x64, 0x64, 
-	0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 
-	0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6c, 0x69, 0x63, 0x6b, 
-	0x22, 0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
-	0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 
+	0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x22, 
+	0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x4e, 
+	0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x65, 0x72, 0x72, 
+	0x6f, 0x72, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x73, 
+	0x61, 0x76, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x22, 0x29, 0x3b, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x53, 0x74, 
-	0x61, 0x74, 0x65, 0x28, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 
-	0x6c, 0x53, 0x74, 0x61, 0x74, 0x65, 0x29, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
+	0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 0xa, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 
-	0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x29, 0x3b, 0xa, 
+	0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
+	0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 
+	0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x72, 0x65, 0x73, 
+	0x65, 0x74, 0x2d, 0x75, 0x73, 0x62, 0x2d, 0x63, 0x6f, 0x6e, 
+	0x66, 0x69, 0x67, 0x22, 0x29, 0x2e, 0x61, 0x64, 0x64, 0x45, 
+	0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 
+	0x65, 0x72, 0x28, 0x22, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x22, 
+	0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x7d, 0x29, 0x3b, 0xa, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 
-	0x6f, 0x64, 0x65, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 
-	0x78, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 
-	0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 
-	0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x22, 0x2c, 0x20, 0x66, 
-	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 
-	0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 
-	0x70, 0x64, 0x61, 0x74, 0x65, 0x56, 0x69, 0x73, 0x69, 0x62, 
-	0x69, 0x6c, 0x69, 0x74, 0x79, 0x28, 0x29, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x53, 0x74, 0x61, 
+	0x74, 0x65, 0x28, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 
+	0x53, 0x74, 0x61, 0x74, 0x65, 0x29, 0x3b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x53, 
+	0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x29, 0x3b, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x7d, 0x29, 0x3b, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6a, 0x6f, 
-	0x79, 0x73, 0x74, 0x69, 0x63, 0x6b, 0x55, 0x73, 0x62, 0x2e, 
-	0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 
-	0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x68, 
-	0x61, 0x6e, 0x67, 0x65, 0x22, 0x2c, 0x20, 0x66, 0x75, 0x6e, 
-	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 
-	0x61, 0x74, 0x65, 0x56, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 
-	0x69, 0x74, 0x79, 0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
-	0x29, 0x3b, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x75, 0x73, 
-	0x65, 0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x2e, 
-	0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 
-	0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x68, 
-	0x61, 0x6e, 0x67, 0x65, 0x22, 0x2c, 0x20, 0x66, 0x75, 0x6e, 
-	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 
-	0x61, 0x74, 0x65, 0x4a, 0x6f, 0x79, 0x73, 0x74, 0x69, 0x63, 
-	0x6b, 0x50, 0x6f, 0x72, 0x74, 0x4f, 0x70, 0x74, 0x69, 0x6f, 
-	0x6e, 0x73, 0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 
+	0x64, 0x65, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 
+	0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 
+	0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 
+	0x68, 0x61, 0x6e, 0x67, 0x65, 0x22, 0x2c, 0x20, 0x66, 0x75, 
+	0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 
+	0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 
+	0x64, 0x61, 0x74, 0x65, 0x56, 0x69, 0x73, 0x69, 0x62, 0x69, 
+	0x6c, 0x69, 0x74, 0x79, 0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x7d, 0x29, 0x3b, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6a, 0x6f, 0x79, 
+	0x73, 0x74, 0x69, 0x63, 0x6b, 0x55, 0x73, 0x62, 0x2e, 0x61, 
+	0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 
+	0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x68, 0x61, 
+	0x6e, 0x67, 0x65, 0x22, 0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 
+	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 0x61, 
+	0x74, 0x65, 0x56, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 
+	0x74, 0x79, 0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 
 	0x3b, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 
-	0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 0x69, 0x6e, 0x69, 0x74, 
-	0x69, 0x61, 0x6c, 0x53, 0x74, 0x61, 0x74, 0x65, 0x29, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
-	0x29, 0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 
-	0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0xa, 0x3c, 
-	0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0xa, 0xa, 0x3c, 0x2f, 
-	0x68, 0x74, 0x6d, 0x6c, 0x3e, 0xa, };
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x75, 0x73, 0x65, 
+	0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x2e, 0x61, 
+	0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 
+	0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x68, 0x61, 
+	0x6e, 0x67, 0x65, 0x22, 0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 
+	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 0x61, 
+	0x74, 0x65, 0x4a, 0x6f, 0x79, 0x73, 0x74, 0x69, 0x63, 0x6b, 
+	0x50, 0x6f, 0x72, 0x74, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+	0x73, 0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 
+	0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x53, 
+	0x74, 0x61, 0x74, 0x65, 0x28, 0x69, 0x6e, 0x69, 0x74, 0x69, 
+	0x61, 0x6c, 0x53, 0x74, 0x61, 0x74, 0x65, 0x29, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 
+	0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 
+	0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0xa, 0x3c, 0x2f, 
+	0x62, 0x6f, 0x64, 0x79, 0x3e, 0xa, 0xa, 0x3c, 0x2f, 0x68, 
+	0x74, 0x6d, 0x6c, 0x3e, 0xa, };
 
 static const unsigned char data_mngr_btpair_shtml[] = {
 	/* /mngr_btpair.shtml */
@@ -8909,156 +9252,164 @@ static const unsigned char data_mngr_native_shtml[] = {
 	0x20, 0x3d, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x50, 0x61, 
 	0x79, 0x6c, 0x6f, 0x61, 0x64, 0x28, 0x29, 0x3b, 0xa, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x65, 
-	0x6e, 0x63, 0x6f, 0x64, 0x65, 0x64, 0x20, 0x3d, 0x20, 0x62, 
-	0x74, 0x6f, 0x61, 0x28, 0x4a, 0x53, 0x4f, 0x4e, 0x2e, 0x73, 
-	0x74, 0x72, 0x69, 0x6e, 0x67, 0x69, 0x66, 0x79, 0x28, 0x70, 
-	0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x29, 0x29, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 
+	0x28, 0x22, 0x2f, 0x73, 0x61, 0x76, 0x65, 0x70, 0x61, 0x72, 
+	0x61, 0x6d, 0x73, 0x2e, 0x63, 0x67, 0x69, 0x22, 0x2c, 0x20, 
+	0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 
-	0x68, 0x28, 0x22, 0x2f, 0x73, 0x61, 0x76, 0x65, 0x70, 0x61, 
-	0x72, 0x61, 0x6d, 0x73, 0x2e, 0x63, 0x67, 0x69, 0x3f, 0x6a, 
-	0x73, 0x6f, 0x6e, 0x3d, 0x22, 0x20, 0x2b, 0x20, 0x65, 0x6e, 
-	0x63, 0x6f, 0x64, 0x65, 0x55, 0x52, 0x49, 0x43, 0x6f, 0x6d, 
-	0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x28, 0x65, 0x6e, 0x63, 
-	0x6f, 0x64, 0x65, 0x64, 0x29, 0x29, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3a, 0x20, 
+	0x22, 0x50, 0x4f, 0x53, 0x54, 0x22, 0x2c, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x74, 0x68, 
-	0x65, 0x6e, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
-	0x6e, 0x20, 0x28, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 
-	0x65, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
-	0x6e, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 
-	0x2e, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x3b, 0x20, 0x7d, 
-	0x29, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 
+	0x61, 0x64, 0x65, 0x72, 0x73, 0x3a, 0x20, 0x7b, 0x20, 0x22, 
+	0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 
+	0x70, 0x65, 0x22, 0x3a, 0x20, 0x22, 0x61, 0x70, 0x70, 0x6c, 
+	0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x6a, 0x73, 
+	0x6f, 0x6e, 0x22, 0x20, 0x7d, 0x2c, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x66, 0x75, 
-	0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x74, 0x65, 
-	0x78, 0x74, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x64, 
+	0x79, 0x3a, 0x20, 0x4a, 0x53, 0x4f, 0x4e, 0x2e, 0x73, 0x74, 
+	0x72, 0x69, 0x6e, 0x67, 0x69, 0x66, 0x79, 0x28, 0x70, 0x61, 
+	0x79, 0x6c, 0x6f, 0x61, 0x64, 0x29, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x7d, 0x29, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x74, 0x72, 0x79, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x74, 0x68, 0x65, 
+	0x6e, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x28, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 
+	0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 
+	0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 
+	0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x3b, 0x20, 0x7d, 0x29, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x66, 0x75, 0x6e, 
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x74, 0x65, 0x78, 
+	0x74, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x64, 0x61, 
-	0x74, 0x61, 0x20, 0x3d, 0x20, 0x4a, 0x53, 0x4f, 0x4e, 0x2e, 
-	0x70, 0x61, 0x72, 0x73, 0x65, 0x28, 0x74, 0x65, 0x78, 0x74, 
-	0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+	0x72, 0x79, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x69, 0x66, 0x20, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 
-	0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x3d, 0x3d, 0x3d, 
-	0x20, 0x32, 0x30, 0x30, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x64, 0x61, 0x74, 
+	0x61, 0x20, 0x3d, 0x20, 0x4a, 0x53, 0x4f, 0x4e, 0x2e, 0x70, 
+	0x61, 0x72, 0x73, 0x65, 0x28, 0x74, 0x65, 0x78, 0x74, 0x29, 
+	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x69, 0x66, 0x20, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x73, 
+	0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 
+	0x32, 0x30, 0x30, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x73, 0x68, 0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 
-	0x28, 0x22, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x22, 
-	0x2c, 0x20, 0x22, 0x4e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 
-	0x6d, 0x6f, 0x64, 0x65, 0x20, 0x73, 0x61, 0x76, 0x65, 0x64, 
-	0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x66, 0x75, 
-	0x6c, 0x6c, 0x79, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x73, 0x65, 
-	0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 
-	0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x61, 0x70, 
-	0x70, 0x6c, 0x69, 0x65, 0x64, 0x20, 0x61, 0x75, 0x74, 0x6f, 
-	0x6d, 0x61, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x6c, 0x79, 0x20, 
-	0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 
-	0x20, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x2d, 0x6f, 0x6e, 0x2e, 
-	0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
+	0x68, 0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 
+	0x22, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x22, 0x2c, 
+	0x20, 0x22, 0x4e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x6d, 
+	0x6f, 0x64, 0x65, 0x20, 0x73, 0x61, 0x76, 0x65, 0x64, 0x20, 
+	0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x66, 0x75, 0x6c, 
+	0x6c, 0x79, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x73, 0x65, 0x20, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x77, 
+	0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x61, 0x70, 0x70, 
+	0x6c, 0x69, 0x65, 0x64, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x6d, 
+	0x61, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x61, 
+	0x66, 0x74, 0x65, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 
+	0x70, 0x6f, 0x77, 0x65, 0x72, 0x2d, 0x6f, 0x6e, 0x2e, 0x22, 
+	0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x53, 0x74, 0x61, 
-	0x74, 0x75, 0x73, 0x28, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 
-	0x22, 0x2c, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x6d, 0x65, 
-	0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x7c, 0x7c, 0x20, 0x22, 
-	0x55, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 
-	0x73, 0x61, 0x76, 0x65, 0x20, 0x6e, 0x61, 0x74, 0x69, 0x76, 
-	0x65, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
-	0x2e, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 
+	0x75, 0x73, 0x28, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 
+	0x2c, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x6d, 0x65, 0x73, 
+	0x73, 0x61, 0x67, 0x65, 0x20, 0x7c, 0x7c, 0x20, 0x22, 0x55, 
+	0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x73, 
+	0x61, 0x76, 0x65, 0x20, 0x6e, 0x61, 0x74, 0x69, 0x76, 0x65, 
+	0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+	0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
-	0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x29, 
-	0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x73, 0x68, 0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 0x75, 
-	0x73, 0x28, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x2c, 
-	0x20, 0x22, 0x55, 0x6e, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 
-	0x65, 0x64, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 
-	0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 
-	0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2e, 0x22, 0x29, 
-	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 
+	0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x29, 0x20, 
+	0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 
+	0x73, 0x68, 0x6f, 0x77, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 
+	0x28, 0x22, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x2c, 0x20, 
+	0x22, 0x55, 0x6e, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 
+	0x64, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 
+	0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 
+	0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2e, 0x22, 0x29, 0x3b, 
 	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x2e, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x66, 0x75, 
-	0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 
-	0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0xa, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 
-	0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x22, 0x65, 0x72, 
-	0x72, 0x6f, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x4e, 0x65, 0x74, 
-	0x77, 0x6f, 0x72, 0x6b, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 
-	0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x73, 0x61, 0x76, 
-	0x69, 0x6e, 0x67, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
-	0x67, 0x73, 0x2e, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 
-	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 0xa, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 
-	0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 
-	0x79, 0x49, 0x64, 0x28, 0x22, 0x72, 0x65, 0x73, 0x65, 0x74, 
-	0x2d, 0x6e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2d, 0x63, 0x6f, 
-	0x6e, 0x66, 0x69, 0x67, 0x22, 0x29, 0x2e, 0x61, 0x64, 0x64, 
-	0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 
-	0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6c, 0x69, 0x63, 0x6b, 
-	0x22, 0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
-	0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 
+	0x2e, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6e, 
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x53, 0x74, 
-	0x61, 0x74, 0x65, 0x28, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 
-	0x6c, 0x53, 0x74, 0x61, 0x74, 0x65, 0x29, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x53, 
+	0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x22, 0x65, 0x72, 0x72, 
+	0x6f, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x4e, 0x65, 0x74, 0x77, 
+	0x6f, 0x72, 0x6b, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 
+	0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x73, 0x61, 0x76, 0x69, 
+	0x6e, 0x67, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x22, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 
-	0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x29, 0x3b, 0xa, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 0xa, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x7d, 0x29, 0x3b, 0xa, 0xa, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 
-	0x66, 0x20, 0x28, 0x6d, 0x6f, 0x64, 0x65, 0x43, 0x68, 0x65, 
-	0x63, 0x6b, 0x62, 0x6f, 0x78, 0x29, 0x20, 0x7b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 
+	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 
+	0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 
+	0x49, 0x64, 0x28, 0x22, 0x72, 0x65, 0x73, 0x65, 0x74, 0x2d, 
+	0x6e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2d, 0x63, 0x6f, 0x6e, 
+	0x66, 0x69, 0x67, 0x22, 0x29, 0x2e, 0x61, 0x64, 0x64, 0x45, 
+	0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 
+	0x65, 0x72, 0x28, 0x22, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x22, 
+	0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x28, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x43, 
-	0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x2e, 0x61, 0x64, 
-	0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 
-	0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x68, 0x61, 0x6e, 
-	0x67, 0x65, 0x22, 0x2c, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 
-	0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x29, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x53, 0x74, 0x61, 
+	0x74, 0x65, 0x28, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 
+	0x53, 0x74, 0x61, 0x74, 0x65, 0x29, 0x3b, 0xa, 0x20, 0x20, 
 	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x7d, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x6c, 
-	0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 0x69, 0x6e, 0x69, 
-	0x74, 0x69, 0x61, 0x6c, 0x53, 0x74, 0x61, 0x74, 0x65, 0x29, 
-	0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x7d, 0x29, 0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 
-	0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0xa, 
-	0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0xa, 0xa, 0x3c, 
-	0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0xa, };
+	0x20, 0x20, 0x20, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x53, 
+	0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x29, 0x3b, 0xa, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x7d, 0x29, 0x3b, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+	0x20, 0x28, 0x6d, 0x6f, 0x64, 0x65, 0x43, 0x68, 0x65, 0x63, 
+	0x6b, 0x62, 0x6f, 0x78, 0x29, 0x20, 0x7b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x43, 0x68, 
+	0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x2e, 0x61, 0x64, 0x64, 
+	0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 
+	0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x68, 0x61, 0x6e, 0x67, 
+	0x65, 0x22, 0x2c, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x53, 
+	0x74, 0x61, 0x74, 0x75, 0x73, 0x29, 0x3b, 0xa, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x7d, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 
+	0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 0x69, 0x6e, 0x69, 0x74, 
+	0x69, 0x61, 0x6c, 0x53, 0x74, 0x61, 0x74, 0x65, 0x29, 0x3b, 
+	0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
+	0x29, 0x28, 0x29, 0x3b, 0xa, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0xa, 0x3c, 
+	0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0xa, 0xa, 0x3c, 0x2f, 
+	0x68, 0x74, 0x6d, 0x6c, 0x3e, 0xa, };
 
 static const unsigned char data_jsonempty_shtml[] = {
 	/* /jsonempty.shtml */
 	0x2f, 0x6a, 0x73, 0x6f, 0x6e, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x2e, 0x73, 0x68, 0x74, 0x6d, 0x6c, 0,
-	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x20, 0x32, 
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x31, 0x20, 0x32, 
 	0x30, 0x30, 0x20, 0x4f, 0x4b, 0xd, 0xa, 0x53, 0x65, 0x72, 
 	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
 	0x70, 0x72, 0x65, 0x2d, 0x30, 0x2e, 0x36, 0x20, 0x28, 0x68, 
@@ -9067,8 +9418,10 @@ static const unsigned char data_jsonempty_shtml[] = {
 	0x64, 0x61, 0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 
 	0xd, 0xa, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 
 	0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 
-	0x2f, 0x68, 0x74, 0x6d, 0x6c, 0xd, 0xa, 0xd, 0xa, 0x7b, 
-	0x7d, };
+	0x2f, 0x68, 0x74, 0x6d, 0x6c, 0xd, 0xa, 0x43, 0x6f, 0x6e, 
+	0x74, 0x65, 0x6e, 0x74, 0x2d, 0x4c, 0x65, 0x6e, 0x67, 0x74, 
+	0x68, 0x3a, 0x20, 0x32, 0xd, 0xa, 0xd, 0xa, 0x7b, 0x7d, 
+};
 
 static const unsigned char data_mngr_home_shtml[] = {
 	/* /mngr_home.shtml */
@@ -9467,31 +9820,31 @@ static const unsigned char data_response_shtml[] = {
 	0x21, 0x2d, 0x2d, 0x23, 0x52, 0x53, 0x50, 0x4d, 0x53, 0x47, 
 	0x2d, 0x2d, 0x3e, 0x22, 0xa, 0x7d, };
 
-const struct fsdata_file file_json_shtml[] = {{NULL, data_json_shtml, data_json_shtml + 12, sizeof(data_json_shtml) - 12, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT}};
+const struct fsdata_file file_json_shtml[] = {{NULL, data_json_shtml, data_json_shtml + 12, sizeof(data_json_shtml) - 12, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_SSI}};
 
-const struct fsdata_file file_mngr_bt_shtml[] = {{file_json_shtml, data_mngr_bt_shtml, data_mngr_bt_shtml + 15, sizeof(data_mngr_bt_shtml) - 15, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT}};
+const struct fsdata_file file_mngr_bt_shtml[] = {{file_json_shtml, data_mngr_bt_shtml, data_mngr_bt_shtml + 15, sizeof(data_mngr_bt_shtml) - 15, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_SSI}};
 
 const struct fsdata_file file_index_html[] = {{file_mngr_bt_shtml, data_index_html, data_index_html + 12, sizeof(data_index_html) - 12, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT}};
 
 const struct fsdata_file file_styles_css[] = {{file_index_html, data_styles_css, data_styles_css + 12, sizeof(data_styles_css) - 12, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT}};
 
-const struct fsdata_file file_error_shtml[] = {{file_styles_css, data_error_shtml, data_error_shtml + 13, sizeof(data_error_shtml) - 13, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT}};
+const struct fsdata_file file_error_shtml[] = {{file_styles_css, data_error_shtml, data_error_shtml + 13, sizeof(data_error_shtml) - 13, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_SSI}};
 
 const struct fsdata_file file_404_html[] = {{file_error_shtml, data_404_html, data_404_html + 10, sizeof(data_404_html) - 10, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT}};
 
-const struct fsdata_file file_mngr_wifi_shtml[] = {{file_404_html, data_mngr_wifi_shtml, data_mngr_wifi_shtml + 17, sizeof(data_mngr_wifi_shtml) - 17, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT}};
+const struct fsdata_file file_mngr_wifi_shtml[] = {{file_404_html, data_mngr_wifi_shtml, data_mngr_wifi_shtml + 17, sizeof(data_mngr_wifi_shtml) - 17, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_SSI}};
 
-const struct fsdata_file file_mngr_usb_shtml[] = {{file_mngr_wifi_shtml, data_mngr_usb_shtml, data_mngr_usb_shtml + 16, sizeof(data_mngr_usb_shtml) - 16, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT}};
+const struct fsdata_file file_mngr_usb_shtml[] = {{file_mngr_wifi_shtml, data_mngr_usb_shtml, data_mngr_usb_shtml + 16, sizeof(data_mngr_usb_shtml) - 16, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_SSI}};
 
-const struct fsdata_file file_mngr_btpair_shtml[] = {{file_mngr_usb_shtml, data_mngr_btpair_shtml, data_mngr_btpair_shtml + 19, sizeof(data_mngr_btpair_shtml) - 19, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT}};
+const struct fsdata_file file_mngr_btpair_shtml[] = {{file_mngr_usb_shtml, data_mngr_btpair_shtml, data_mngr_btpair_shtml + 19, sizeof(data_mngr_btpair_shtml) - 19, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_SSI}};
 
-const struct fsdata_file file_mngr_native_shtml[] = {{file_mngr_btpair_shtml, data_mngr_native_shtml, data_mngr_native_shtml + 19, sizeof(data_mngr_native_shtml) - 19, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT}};
+const struct fsdata_file file_mngr_native_shtml[] = {{file_mngr_btpair_shtml, data_mngr_native_shtml, data_mngr_native_shtml + 19, sizeof(data_mngr_native_shtml) - 19, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_SSI}};
 
 const struct fsdata_file file_jsonempty_shtml[] = {{file_mngr_native_shtml, data_jsonempty_shtml, data_jsonempty_shtml + 17, sizeof(data_jsonempty_shtml) - 17, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT}};
 
-const struct fsdata_file file_mngr_home_shtml[] = {{file_jsonempty_shtml, data_mngr_home_shtml, data_mngr_home_shtml + 17, sizeof(data_mngr_home_shtml) - 17, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT}};
+const struct fsdata_file file_mngr_home_shtml[] = {{file_jsonempty_shtml, data_mngr_home_shtml, data_mngr_home_shtml + 17, sizeof(data_mngr_home_shtml) - 17, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_SSI}};
 
-const struct fsdata_file file_response_shtml[] = {{file_mngr_home_shtml, data_response_shtml, data_response_shtml + 16, sizeof(data_response_shtml) - 16, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT}};
+const struct fsdata_file file_response_shtml[] = {{file_mngr_home_shtml, data_response_shtml, data_response_shtml + 16, sizeof(data_response_shtml) - 16, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_SSI}};
 
 #define FS_ROOT file_response_shtml
 
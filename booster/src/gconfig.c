@@ -1,34 +1,16 @@
 #include "include/gconfig.h"
 
 static SettingsConfigEntry defaultEntries[] = {
-    {PARAM_BOOT_FEATURE, SETTINGS_TYPE_STRING, "IKBD"},
-    {PARAM_HOSTNAME, SETTINGS_TYPE_STRING, "croissant"},
-    {PARAM_WIFI_AUTH, SETTINGS_TYPE_INT, "5"},
-    {PARAM_WIFI_CONNECT_TIMEOUT, SETTINGS_TYPE_INT, "30"},
-    {PARAM_WIFI_COUNTRY, SETTINGS_TYPE_STRING, "XX"},
-    {PARAM_WIFI_PASSWORD, SETTINGS_TYPE_STRING, "sidecart"},
-    {PARAM_WIFI_SCAN_SECONDS, SETTINGS_TYPE_INT, "10"},
-    {PARAM_WIFI_SSID, SETTINGS_TYPE_STRING, ""},
-    {PARAM_WIFI_MODE, SETTINGS_TYPE_INT, "0"},
-    {PARAM_MODE, SETTINGS_TYPE_INT,
-     "255"},  // 0 -> Native, 1 -> USB, 2 -> BT, 255 -> Config
-    {PARAM_MOUSE_SPEED, SETTINGS_TYPE_INT, "5"},
-    {PARAM_USB_KB_LAYOUT, SETTINGS_TYPE_STRING, "US"},
-    {PARAM_USB_KB_TYPE, SETTINGS_TYPE_INT, "0"},
-    {PARAM_JOYSTICK_USB, SETTINGS_TYPE_BOOL, "false"},
-    {PARAM_JOYSTICK_USB_PORT, SETTINGS_TYPE_INT, "1"},
-    {PARAM_JOYSTICK_USB_AUTOSHOOT, SETTINGS_TYPE_INT,
-     "0"},  // 0 -> Disabled, 1 -> Slowest , 10 > Fastest
-    {PARAM_MOUSE_ORIGINAL, SETTINGS_TYPE_BOOL, "false"},
-    {PARAM_BT_ENABLED, SETTINGS_TYPE_BOOL, "true"},
-    {PARAM_BT_MODE, SETTINGS_TYPE_INT, "2"},
-    {PARAM_BT_KB_LAYOUT, SETTINGS_TYPE_STRING, "US"},
-    {PARAM_BT_KB_TYPE, SETTINGS_TYPE_INT, "0"},
-    {PARAM_BT_KEYBOARD, SETTINGS_TYPE_STRING, ""},
-    {PARAM_BT_MOUSE, SETTINGS_TYPE_STRING, ""},
-    {PARAM_BT_GAMEPAD, SETTINGS_TYPE_STRING, ""},
-    {PARAM_BT_GAMEPADSHOOT, SETTINGS_TYPE_INT,
-     "0"}};  // 0 -> Disabled, 1 -> Slowest , 10 > Fastest
+#define GCONFIG_PARAM_ENTRY(id, key, type, value) {key, type, value},
+    GCONFIG_PARAMS(GCONFIG_PARAM_ENTRY)
+#undef GCONFIG_PARAM_ENTRY
+};
+
+_Static_assert(sizeof(defaultEntries) / sizeof(defaultEntries[0]) ==
+                   GCONFIG_PARAM_COUNT,
+               "defaultEntries and gconfig_param_id_t are out of sync");
+_Static_assert(GCONFIG_PARAM_COUNT <= GCONFIG_MAX_PARAMS,
+               "The global configuration does not fit in its flash sector");
 
 enum {
   CONFIG_BUFFER_SIZE = 4096,
@@ -39,6 +21,25 @@ enum {
 // Create a global context for our settings
 static SettingsContext gSettingsCtx;
 
+// Parsed values of the typed accessors, valid while the context generation
+// matches the one they were parsed at.
+typedef struct {
+  uint32_t generation;
+  bool valid;
+  int intValue;
+} gconfig_cached_value_t;
+
+static gconfig_cached_value_t gCachedValues[GCONFIG_PARAM_COUNT];
+
+// Context of the app opened with gconfig_open_app()
+static SettingsContext gAppSettingsCtx;
+static bool gAppOpen = false;
+
+// Write-behind state: pending commit and when it must be flushed
+static bool gCommitPending = false;
+static absolute_time_t gCommitDeadline;
+static absolute_time_t gCommitLatest;
+
 /**
  * @brief Initializes the global configuration settings.
  *
@@ -55,11 +56,14 @@ static SettingsContext gSettingsCtx;
  */
 int gconfig_init(const char *currentAppName) {
   DPRINTF("Initializing settings\n");
-  int err = settings_init(&gSettingsCtx, defaultEntries,
-                          sizeof(defaultEntries) / sizeof(defaultEntries[0]),
-                          (unsigned int)&_global_config_flash_start - XIP_BASE,
-                          CONFIG_BUFFER_SIZE, CONFIG_MAGIC_NUMBER,
-                          CONFIG_VERSION_NUMBER);
+  // Read the block in place from flash: only the changed entries use RAM
+  int err = settings_init_xip(
+      &gSettingsCtx, defaultEntries,
+      sizeof(defaultEntries) / sizeof(defaultEntries[0]),
+      (unsigned int)&_global_config_flash_start - XIP_BASE, CONFIG_BUFFER_SIZE,
+      CONFIG_MAGIC_NUMBER, CONFIG_VERSION_NUMBER);
+
+  memset(gCachedValues, 0, sizeof(gCachedValues));
 
   // If the settings are not initialized, then we must initialize them with the
   // default values in the Booster application
@@ -68,6 +72,18 @@ int gconfig_init(const char *currentAppName) {
     return GCONFIG_INIT_ERROR;
   }
 
+  // The typed accessors rely on every default landing at its table position
+  for (int id = 0; id < GCONFIG_PARAM_COUNT; id++) {
+    SettingsConfigEntry *entry =
+        settings_get_entry(&gSettingsCtx, GCONFIG_FIRST_ENTRY_POSITION + id);
+    if ((entry == NULL) || (strncmp(entry->key, defaultEntries[id].key,
+                                    SETTINGS_MAX_KEY_LENGTH) != 0)) {
+      DPRINTF("Parameter %s is not at position %d.\n", defaultEntries[id].key,
+              GCONFIG_FIRST_ENTRY_POSITION + id);
+      return GCONFIG_INIT_ERROR;
+    }
+  }
+
   // If the current app as argument is not null, check if the current app is the
   // same as the one in the settings Otherwise, ignore and continue
   if (currentAppName != NULL) {
@@ -106,3 +122,407 @@ int gconfig_init(const char *currentAppName) {
  * @return SettingsContext* Pointer to the global settings context.
  */
 SettingsContext *gconfig_getContext(void) { return &gSettingsCtx; }
+
+static SettingsConfigEntry *gconfig_getEntry(gconfig_param_id_t id) {
+  if ((unsigned)id >= GCONFIG_PARAM_COUNT) {
+    return NULL;
+  }
+  return settings_get_entry(&gSettingsCtx, GCONFIG_FIRST_ENTRY_POSITION + id);
+}
+
+/**
+ * @brief Returns the integer value of a parameter.
+ *
+ * @param id The parameter ID.
+ * @return int The parsed value, or 0 if the parameter is not available.
+ */
+int gconfig_get_int(gconfig_param_id_t id) {
+  SettingsConfigEntry *entry = gconfig_getEntry(id);
+  if (entry == NULL) {
+    return 0;
+  }
+  gconfig_cached_value_t *cached = &gCachedValues[id];
+  if (!cached->valid || cached->generation != gSettingsCtx.generation) {
+    cached->intValue = (int)strtol(entry->value, NULL, DEC_BASE);
+    cached->generation = gSettingsCtx.generation;
+    cached->valid = true;
+  }
+  return cached->intValue;
+}
+
+/**
+ * @brief Returns the boolean value of a parameter.
+ *
+ * Values starting with 't', 'y' or '1' (any case) are true.
+ *
+ * @param id The parameter ID.
+ * @return bool The parsed value, or false if the parameter is not available.
+ */
+bool gconfig_get_bool(gconfig_param_id_t id) {
+  SettingsConfigEntry *entry = gconfig_getEntry(id);
+  if (entry == NULL) {
+    return false;
+  }
+  gconfig_cached_value_t *cached = &gCachedValues[id];
+  if (!cached->valid || cached->generation != gSettingsCtx.generation) {
+    char first = (char)tolower((unsigned char)entry->value[0]);
+    cached->intValue = (first == 't' || first == 'y' || first == '1');
+    cached->generation = gSettingsCtx.generation;
+    cached->valid = true;
+  }
+  return cached->intValue != 0;
+}
+
+/**
+ * @brief Returns the string value of a parameter.
+ *
+ * @param id The parameter ID.
+ * @return const char* The stored value, or an empty string if the parameter
+ * is not available. The pointer is valid until the next gconfig_poll() or
+ * gconfig_flush() that saves the configuration.
+ */
+const char *gconfig_get_str(gconfig_param_id_t id) {
+  SettingsConfigEntry *entry = gconfig_getEntry(id);
+  return (entry != NULL) ? entry->value : "";
+}
+
+/**
+ * @brief Schedules a save of the global configuration.
+ *
+ * Every call restarts the quiet period, bounded by the maximum delay counted
+ * from the first pending commit.
+ */
+void gconfig_commit(void) {
+  if (!gCommitPending) {
+    gCommitPending = true;
+    gCommitLatest = make_timeout_time_ms(GCONFIG_COMMIT_MAX_DELAY_MS);
+  }
+  gCommitDeadline = make_timeout_time_ms(GCONFIG_COMMIT_QUIET_MS);
+  if (absolute_time_diff_us(gCommitLatest, gCommitDeadline) > 0) {
+    gCommitDeadline = gCommitLatest;
+  }
+}
+
+/**
+ * @brief Flushes a pending commit once its quiet period has expired.
+ */
+void gconfig_poll(void) {
+  if (gCommitPending &&
+      absolute_time_diff_us(get_absolute_time(), gCommitDeadline) <= 0) {
+    gconfig_flush();
+  }
+}
+
+/**
+ * @brief Saves the pending changes now.
+ *
+ * @return int 0 if nothing was pending or the save succeeded, the
+ * settings_save() error otherwise.
+ */
+int gconfig_flush(void) {
+  if (!gCommitPending) {
+    return 0;
+  }
+  gCommitPending = false;
+  int err = settings_save(&gSettingsCtx, true);
+  if (err != 0) {
+    DPRINTF("Error saving the global configuration: %i\n", err);
+  }
+  return err;
+}
+
+static const gconfig_lookup_header_t *gconfig_lookupHeader(void) {
+  return (const gconfig_lookup_header_t *)&_global_lookup_flash_start;
+}
+
+static const gconfig_lookup_record_t *gconfig_lookupRecords(void) {
+  return (const gconfig_lookup_record_t *)(gconfig_lookupHeader() + 1);
+}
+
+static uint16_t gconfig_lookupMaxRecords(void) {
+  return (FLASH_SECTOR_SIZE - sizeof(gconfig_lookup_header_t)) /
+         sizeof(gconfig_lookup_record_t);
+}
+
+static uint16_t gconfig_configSectors(void) {
+  return ((unsigned int)&_global_lookup_flash_start -
+          (unsigned int)&_config_flash_start) /
+         FLASH_SECTOR_SIZE;
+}
+
+static uint32_t gconfig_lookupCheck(const gconfig_lookup_record_t *records,
+                                    uint16_t count) {
+  const uint8_t *bytes = (const uint8_t *)records;
+  uint32_t hash = SETTINGS_FNV1A_OFFSET_BASIS;
+  for (size_t i = 0; i < count * sizeof(gconfig_lookup_record_t); i++) {
+    hash = (hash ^ bytes[i]) * SETTINGS_FNV1A_PRIME;
+  }
+  return hash;
+}
+
+/**
+ * @brief Number of records of the lookup table, 0 if there is no valid table.
+ */
+static uint16_t gconfig_lookupCount(void) {
+  const gconfig_lookup_header_t *header = gconfig_lookupHeader();
+  if (header->signature != GCONFIG_LOOKUP_SIGNATURE ||
+      header->version != GCONFIG_LOOKUP_VERSION ||
+      header->count > gconfig_lookupMaxRecords() ||
+      header->check !=
+          gconfig_lookupCheck(gconfig_lookupRecords(), header->count)) {
+    return 0;
+  }
+  return header->count;
+}
+
+/**
+ * @brief Binary search of the table. Returns the position of the record, or
+ * the negative insertion point minus one when the UUID is not present.
+ */
+static int gconfig_lookupSearch(const gconfig_lookup_record_t *records,
+                                uint16_t count, const uint8_t *uuid) {
+  int low = 0;
+  int high = (int)count - 1;
+  while (low <= high) {
+    int mid = low + (high - low) / 2;
+    int cmp = memcmp(records[mid].uuid, uuid, GCONFIG_APP_UUID_SIZE);
+    if (cmp == 0) {
+      return mid;
+    }
+    if (cmp < 0) {
+      low = mid + 1;
+    } else {
+      high = mid - 1;
+    }
+  }
+  return -low - 1;
+}
+
+static bool gconfig_parseUuid(const char *text, uint8_t *uuid) {
+  if (text == NULL || strlen(text) != GCONFIG_APP_UUID_STRING_LENGTH) {
+    return false;
+  }
+  size_t byte = 0;
+  for (size_t i = 0; i < GCONFIG_APP_UUID_STRING_LENGTH;) {
+    if (i == 8 || i == 13 || i == 18 || i == 23) {
+      if (text[i++] != '-') {
+        return false;
+      }
+      continue;
+    }
+    if (!isxdigit((unsigned char)text[i]) ||
+        !isxdigit((unsigned char)text[i + 1])) {
+      return false;
+    }
+    char hex[3] = {text[i], text[i + 1], '\0'};
+    uuid[byte++] = (uint8_t)strtoul(hex, NULL, HEX_BASE);
+    i += 2;
+  }
+  return byte == GCONFIG_APP_UUID_SIZE;
+}
+
+typedef struct {
+  uint32_t offset;
+  const uint8_t *data;
+  uint32_t size;
+} gconfig_flash_write_t;
+
+static void gconfig_flashEraseChunk(void *param) {
+  const gconfig_flash_write_t *write = (const gconfig_flash_write_t *)param;
+  flash_range_erase(write->offset, FLASH_SECTOR_SIZE);
+}
+
+static void gconfig_flashProgramChunk(void *param) {
+  const gconfig_flash_write_t *write = (const gconfig_flash_write_t *)param;
+  flash_range_program(write->offset, write->data, write->size);
+}
+
+/**
+ * @brief Erases a sector and programs size bytes (a multiple of the page
+ * size) at its start, if data is not NULL.
+ *
+ * As in the settings library, the erase and every page run in their own
+ * settings_flash_execute() call, so interrupts come back on between them.
+ */
+static int gconfig_writeSector(uint32_t offset, const uint8_t *data,
+                               uint32_t size) {
+  gconfig_flash_write_t write = {offset, NULL, FLASH_SECTOR_SIZE};
+  if (settings_flash_execute(gconfig_flashEraseChunk, &write) != PICO_OK) {
+    return -1;
+  }
+  for (uint32_t done = 0; data != NULL && done < size;
+       done += FLASH_PAGE_SIZE) {
+    write.offset = offset + done;
+    write.data = data + done;
+    write.size = FLASH_PAGE_SIZE;
+    if (settings_flash_execute(gconfig_flashProgramChunk, &write) !=
+        PICO_OK) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief Whether a config sector reads as erased (all 0xFF).
+ */
+static bool gconfig_configSectorErased(uint16_t sector) {
+  const uint32_t *words =
+      (const uint32_t *)((const uint8_t *)&_config_flash_start +
+                         sector * FLASH_SECTOR_SIZE);
+  for (size_t i = 0; i < FLASH_SECTOR_SIZE / sizeof(uint32_t); i++) {
+    if (words[i] != 0xFFFFFFFFu) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Adds a record for the UUID, on the lowest free config sector, and
+ * rewrites the table. Returns the sector, or a negative error.
+ *
+ * Only an erased sector is free: one holding data without a record (a lost
+ * or blank table, data left by another firmware) is never claimed, so
+ * registering an app cannot destroy it.
+ */
+static int gconfig_lookupInsert(uint16_t count, int insertAt,
+                                const uint8_t *uuid) {
+  const gconfig_lookup_record_t *records = gconfig_lookupRecords();
+  if (count >= gconfig_lookupMaxRecords()) {
+    return GCONFIG_LOOKUP_FULL;
+  }
+
+  // Lowest erased sector not used by any app
+  uint16_t sector = 0;
+  bool used = true;
+  while (used && sector < gconfig_configSectors()) {
+    used = false;
+    for (uint16_t i = 0; i < count && !used; i++) {
+      used = records[i].sector == sector;
+    }
+    used = used || !gconfig_configSectorErased(sector);
+    if (used) {
+      sector++;
+    }
+  }
+  if (used) {
+    DPRINTF("No config sector left for a new app.\n");
+    return GCONFIG_LOOKUP_FULL;
+  }
+
+  size_t size = sizeof(gconfig_lookup_header_t) +
+                (count + 1) * sizeof(gconfig_lookup_record_t);
+  size = (size + FLASH_PAGE_SIZE - 1) / FLASH_PAGE_SIZE * FLASH_PAGE_SIZE;
+  uint8_t *table = malloc(size);
+  if (table == NULL) {
+    return GCONFIG_INIT_ERROR;
+  }
+  memset(table, 0xFF, size);
+  gconfig_lookup_header_t *header = (gconfig_lookup_header_t *)table;
+  gconfig_lookup_record_t *newRecords = (gconfig_lookup_record_t *)(header + 1);
+  memcpy(newRecords, records, insertAt * sizeof(gconfig_lookup_record_t));
+  memcpy(&newRecords[insertAt + 1], &records[insertAt],
+         (count - insertAt) * sizeof(gconfig_lookup_record_t));
+  memcpy(newRecords[insertAt].uuid, uuid, GCONFIG_APP_UUID_SIZE);
+  newRecords[insertAt].sector = sector;
+  newRecords[insertAt].reserved = 0;
+  header->signature = GCONFIG_LOOKUP_SIGNATURE;
+  header->version = GCONFIG_LOOKUP_VERSION;
+  header->count = count + 1;
+  header->check = gconfig_lookupCheck(newRecords, header->count);
+  header->reserved = 0;
+
+  // The sector is already erased: only the table is written
+  int err = gconfig_writeSector(
+      (unsigned int)&_global_lookup_flash_start - XIP_BASE, table, size);
+  free(table);
+  if (err != 0) {
+    DPRINTF("Error writing the app lookup table.\n");
+    return GCONFIG_INIT_ERROR;
+  }
+  DPRINTF("App registered on config sector %u (%u apps).\n", sector,
+          count + 1);
+  return sector;
+}
+
+int gconfig_app_sector_offset(const char *uuid, bool create,
+                              uint32_t *offset) {
+  uint8_t key[GCONFIG_APP_UUID_SIZE];
+  if (!gconfig_parseUuid(uuid, key)) {
+    DPRINTF("Invalid app UUID: %s\n", uuid ? uuid : "(null)");
+    return GCONFIG_INVALID_UUID;
+  }
+
+  uint16_t count = gconfig_lookupCount();
+  int pos = gconfig_lookupSearch(gconfig_lookupRecords(), count, key);
+  int sector;
+  if (pos >= 0) {
+    sector = gconfig_lookupRecords()[pos].sector;
+  } else if (!create) {
+    return GCONFIG_NOT_FOUND;
+  } else {
+    sector = gconfig_lookupInsert(count, -pos - 1, key);
+    if (sector < 0) {
+      return sector;
+    }
+  }
+  if (sector >= gconfig_configSectors()) {
+    DPRINTF("App sector %d out of the config region.\n", sector);
+    return GCONFIG_INIT_ERROR;
+  }
+  *offset = (unsigned int)&_config_flash_start - XIP_BASE +
+            sector * FLASH_SECTOR_SIZE;
+  return GCONFIG_SUCCESS;
+}
+
+int gconfig_write_app_sector(uint32_t offset, const uint8_t *data,
+                             uint32_t size) {
+  uint32_t configOffset = (unsigned int)&_config_flash_start - XIP_BASE;
+  uint32_t lookupOffset = (unsigned int)&_global_lookup_flash_start - XIP_BASE;
+  if (offset < configOffset || offset >= lookupOffset ||
+      (offset % FLASH_SECTOR_SIZE) != 0 || size > FLASH_SECTOR_SIZE ||
+      (size % FLASH_PAGE_SIZE) != 0) {
+    return GCONFIG_INIT_ERROR;
+  }
+  return gconfig_writeSector(offset, data, size) == 0 ? GCONFIG_SUCCESS
+                                                      : GCONFIG_INIT_ERROR;
+}
+
+SettingsContext *gconfig_open_app(const char *uuid,
+                                  const SettingsConfigEntry *defaultEntries,
+                                  uint16_t defaultNumEntries) {
+  uint32_t offset;
+  if (gconfig_app_sector_offset(uuid, true, &offset) != GCONFIG_SUCCESS) {
+    return NULL;
+  }
+
+  gconfig_close_app();
+  settings_init_xip(&gAppSettingsCtx, defaultEntries, defaultNumEntries, offset,
+                    FLASH_SECTOR_SIZE, CONFIG_MAGIC_NUMBER,
+                    CONFIG_VERSION_NUMBER);
+  // A blank sector is not an error (the defaults are loaded), running out of
+  // memory is
+  if (gAppSettingsCtx.configData.entries == NULL ||
+      gAppSettingsCtx.dirty == NULL) {
+    settings_deinit(&gAppSettingsCtx);
+    return NULL;
+  }
+  gAppOpen = true;
+  DPRINTF("App %s opened at flash offset 0x%lx.\n", uuid,
+          (unsigned long)offset);
+  return &gAppSettingsCtx;
+}
+
+SettingsContext *gconfig_getAppContext(void) {
+  return gAppOpen ? &gAppSettingsCtx : NULL;
+}
+
+void gconfig_close_app(void) {
+  if (!gAppOpen) {
+    return;
+  }
+  settings_save(&gAppSettingsCtx, true);
+  settings_deinit(&gAppSettingsCtx);
+  gAppOpen = false;
+}
@@ -11,6 +11,7 @@
 
 #include "constants.h"
 #include "debug.h"
+#include "pico/time.h"
 #include "settings.h"
 
 #define PARAM_BOOT_FEATURE "BOOT_FEATURE"
@@ -38,12 +39,208 @@
 #define PARAM_BT_GAMEPADSHOOT "BT_GAMEPAD_SHOOT"
 #define PARAM_BT_KB_LAYOUT "BT_KB_LAYOUT"
 #define PARAM_BT_KB_TYPE "BT_KB_TYPE"
+#define PARAM_WIFI_JOIN "WIFI_JOIN"
+#define PARAM_WIFI_AP_CHANNEL "WIFI_AP_CHANNEL"
+#define PARAM_WIFI_STATIC_IP "WIFI_STATIC_IP"
+
+/**
+ * @brief Table of the global configuration parameters.
+ *
+ * One row per parameter: ID suffix, key, data type and default value. The row
+ * order is the order of the entries in flash, and the same table generates
+ * both the default entries in gconfig.c and the gconfig_param_id_t enum, so
+ * the IDs can index the entries array directly.
+ *
+ * New parameters go at the end of the table, and the magic and version stay
+ * as they are. A reader built with fewer parameters (older booster builds,
+ * the IKBD firmware) loads only as many entries as it has defaults, matching
+ * them by key, so entries appended after those are never looked at. If such
+ * a reader saves the block, it writes only its own entries: the appended
+ * parameters go back to their defaults, nothing else is lost. Bumping the
+ * version instead would make every older reader discard the whole block.
+ * Reordering or removing rows can move an entry out of the window of an older
+ * reader, and retyping one changes what it parses: those need a version bump.
+ */
+#define GCONFIG_PARAMS(X)                                               \
+  X(BOOT_FEATURE, PARAM_BOOT_FEATURE, SETTINGS_TYPE_STRING, "IKBD")     \
+  X(HOSTNAME, PARAM_HOSTNAME, SETTINGS_TYPE_STRING, "croissant")        \
+  X(WIFI_AUTH, PARAM_WIFI_AUTH, SETTINGS_TYPE_INT, "5")                 \
+  X(WIFI_CONNECT_TIMEOUT, PARAM_WIFI_CONNECT_TIMEOUT, SETTINGS_TYPE_INT, \
+    "30")                                                               \
+  X(WIFI_COUNTRY, PARAM_WIFI_COUNTRY, SETTINGS_TYPE_STRING, "XX")       \
+  X(WIFI_PASSWORD, PARAM_WIFI_PASSWORD, SETTINGS_TYPE_STRING, "sidecart") \
+  X(WIFI_SCAN_SECONDS, PARAM_WIFI_SCAN_SECONDS, SETTINGS_TYPE_INT, "10") \
+  X(WIFI_SSID, PARAM_WIFI_SSID, SETTINGS_TYPE_STRING, "")               \
+  X(WIFI_MODE, PARAM_WIFI_MODE, SETTINGS_TYPE_INT, "0")                 \
+  /* 0 -> Native, 1 -> USB, 2 -> BT, 255 -> Config */                   \
+  X(MODE, PARAM_MODE, SETTINGS_TYPE_INT, "255")                         \
+  X(MOUSE_SPEED, PARAM_MOUSE_SPEED, SETTINGS_TYPE_INT, "5")             \
+  X(USB_KB_LAYOUT, PARAM_USB_KB_LAYOUT, SETTINGS_TYPE_STRING, "US")     \
+  X(USB_KB_TYPE, PARAM_USB_KB_TYPE, SETTINGS_TYPE_INT, "0")             \
+  X(JOYSTICK_USB, PARAM_JOYSTICK_USB, SETTINGS_TYPE_BOOL, "false")      \
+  X(JOYSTICK_USB_PORT, PARAM_JOYSTICK_USB_PORT, SETTINGS_TYPE_INT, "1") \
+  /* 0 -> Disabled, 1 -> Slowest , 10 > Fastest */                      \
+  X(JOYSTICK_USB_AUTOSHOOT, PARAM_JOYSTICK_USB_AUTOSHOOT,               \
+    SETTINGS_TYPE_INT, "0")                                             \
+  X(MOUSE_ORIGINAL, PARAM_MOUSE_ORIGINAL, SETTINGS_TYPE_BOOL, "false")  \
+  X(BT_ENABLED, PARAM_BT_ENABLED, SETTINGS_TYPE_BOOL, "true")           \
+  X(BT_MODE, PARAM_BT_MODE, SETTINGS_TYPE_INT, "2")                     \
+  X(BT_KB_LAYOUT, PARAM_BT_KB_LAYOUT, SETTINGS_TYPE_STRING, "US")       \
+  X(BT_KB_TYPE, PARAM_BT_KB_TYPE, SETTINGS_TYPE_INT, "0")               \
+  X(BT_KEYBOARD, PARAM_BT_KEYBOARD, SETTINGS_TYPE_STRING, "")           \
+  X(BT_MOUSE, PARAM_BT_MOUSE, SETTINGS_TYPE_STRING, "")                 \
+  X(BT_GAMEPAD, PARAM_BT_GAMEPAD, SETTINGS_TYPE_STRING, "")             \
+  /* 0 -> Disabled, 1 -> Slowest , 10 > Fastest */                      \
+  X(BT_GAMEPADSHOOT, PARAM_BT_GAMEPADSHOOT, SETTINGS_TYPE_INT, "0")    \
+  /* Last STA join for a fast rejoin: "bssid,channel,auth,lease,ssid" */  \
+  X(WIFI_JOIN, PARAM_WIFI_JOIN, SETTINGS_TYPE_STRING, "")               \
+  /* 0 -> Driver default, -1 -> Least congested of 1/6/11, n -> Fixed */ \
+  X(WIFI_AP_CHANNEL, PARAM_WIFI_AP_CHANNEL, SETTINGS_TYPE_INT, "0")      \
+  /* STA address "ip,netmask,gateway[,dns]", empty -> DHCP */             \
+  X(WIFI_STATIC_IP, PARAM_WIFI_STATIC_IP, SETTINGS_TYPE_STRING, "")
+
+/**
+ * @brief Compile-time IDs of the global configuration parameters.
+ */
+typedef enum {
+#define GCONFIG_PARAM_ID(id, key, type, value) GCONFIG_ID_##id,
+  GCONFIG_PARAMS(GCONFIG_PARAM_ID)
+#undef GCONFIG_PARAM_ID
+      GCONFIG_PARAM_COUNT
+} gconfig_param_id_t;
+
+/**
+ * @brief Position of the first parameter in the settings entries array. The
+ * settings library always stores MAGICVERSION in front of the defaults.
+ */
+#define GCONFIG_FIRST_ENTRY_POSITION 1
+
+// The global block is a single 4 KB sector read by the IKBD firmware too: it
+// holds at most 32 entries (MAGICVERSION plus 31 parameters).
+#define GCONFIG_MAX_PARAMS 31
+
+// Write-behind: a commit is flushed once no other commit arrived for
+// GCONFIG_COMMIT_QUIET_MS, and never later than GCONFIG_COMMIT_MAX_DELAY_MS
+// after the first pending one.
+#define GCONFIG_COMMIT_QUIET_MS 1000
+#define GCONFIG_COMMIT_MAX_DELAY_MS 5000
+
+// Lookup table in GLOBAL_LOOKUP_FLASH: app UUID -> sector in CONFIG_FLASH.
+// A header followed by records sorted by UUID.
+#define GCONFIG_LOOKUP_SIGNATURE 0x504B4C47  // "GLKP"
+#define GCONFIG_LOOKUP_VERSION 1
+#define GCONFIG_APP_UUID_SIZE 16
+#define GCONFIG_APP_UUID_STRING_LENGTH 36  // 8-4-4-4-12 hex digits
+
+typedef struct {
+  uint32_t signature;  // GCONFIG_LOOKUP_SIGNATURE
+  uint16_t version;    // GCONFIG_LOOKUP_VERSION
+  uint16_t count;      // Number of records
+  uint32_t check;      // FNV-1a of the records
+  uint32_t reserved;
+} gconfig_lookup_header_t;
+
+typedef struct {
+  uint8_t uuid[GCONFIG_APP_UUID_SIZE];  // Big endian, as written in text
+  uint16_t sector;                      // Sector index in CONFIG_FLASH
+  uint16_t reserved;
+} gconfig_lookup_record_t;
 
 #define GCONFIG_SUCCESS 0
 #define GCONFIG_INIT_ERROR -1
 #define GCONFIG_MISMATCHED_APP -2
+#define GCONFIG_INVALID_UUID -3
+#define GCONFIG_LOOKUP_FULL -4
+#define GCONFIG_NOT_FOUND -5
 
 int gconfig_init(const char *currentAppName);
 SettingsContext *gconfig_getContext(void);
 
+/**
+ * @brief Typed accessors for the global configuration parameters.
+ *
+ * The entry is reached by position, without any key lookup. Integer and
+ * boolean values are parsed once and cached until the settings change.
+ */
+int gconfig_get_int(gconfig_param_id_t id);
+bool gconfig_get_bool(gconfig_param_id_t id);
+
+/**
+ * @brief The string value of a parameter, never NULL.
+ *
+ * The pointer is only valid until the next gconfig_poll() or gconfig_flush():
+ * a save drops the RAM copy of a changed entry. Copy the value rather than
+ * keeping the pointer. The web UI saves from the lwIP background context, so
+ * code outside it reads and copies the value with the lwIP lock held
+ * (cyw43_arch_lwip_begin()).
+ */
+const char *gconfig_get_str(gconfig_param_id_t id);
+
+/**
+ * @brief Write-behind persistence of the global configuration.
+ *
+ * gconfig_commit() schedules a save of the pending changes instead of
+ * writing the flash right away, so a burst of updates collapses into a
+ * single erase/program. gconfig_poll() runs the save once the quiet period
+ * expires and must be called from the main loop. gconfig_flush() is the
+ * barrier: it saves the pending changes now (before a reboot or a mode
+ * switch) and returns the settings_save() result.
+ */
+void gconfig_commit(void);
+void gconfig_poll(void);
+int gconfig_flush(void);
+
+/**
+ * @brief Opens the configuration context of an app.
+ *
+ * The app UUID ("xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx") is resolved to its
+ * sector in CONFIG_FLASH with gconfig_app_sector_offset(), which assigns a
+ * free sector the first time the app is seen. The sector is then opened as
+ * a settings context with the given defaults, replacing (and saving) the app
+ * context opened before, if any: switching between the booster and the IKBD
+ * app profiles is opening another context, the global block is untouched. A
+ * new context holds the defaults, not yet saved.
+ *
+ * @return SettingsContext* The app context, or NULL if the UUID is invalid,
+ * no sector is left or the context cannot be allocated.
+ */
+SettingsContext *gconfig_open_app(const char *uuid,
+                                  const SettingsConfigEntry *defaultEntries,
+                                  uint16_t defaultNumEntries);
+
+/**
+ * @brief Returns the context opened by gconfig_open_app(), or NULL.
+ */
+SettingsContext *gconfig_getAppContext(void);
+
+/**
+ * @brief Closes the app context, saving its pending changes.
+ */
+void gconfig_close_app(void);
+
+/**
+ * @brief Resolves the sector in CONFIG_FLASH of an app UUID with a binary
+ * search of the lookup table. gconfig_open_app() opens the sector it
+ * returns; apps that keep raw data instead of a settings context use it
+ * directly, with gconfig_write_app_sector().
+ *
+ * With create, a free (erased) sector is assigned, and recorded in the table,
+ * the first time the UUID is seen; otherwise GCONFIG_NOT_FOUND is returned
+ * for an unknown UUID. On success, offset is the flash offset of the sector.
+ *
+ * @return int GCONFIG_SUCCESS, GCONFIG_INVALID_UUID, GCONFIG_NOT_FOUND,
+ * GCONFIG_LOOKUP_FULL if no erased sector is left, or GCONFIG_INIT_ERROR.
+ */
+int gconfig_app_sector_offset(const char *uuid, bool create, uint32_t *offset);
+
+/**
+ * @brief Erases the app sector at offset (from gconfig_app_sector_offset())
+ * and programs size bytes, a multiple of the flash page size, at its start.
+ *
+ * The erase and each page run in their own settings_flash_execute() call:
+ * interrupts stay masked for one chunk at a time, not the whole write.
+ */
+int gconfig_write_app_sector(uint32_t offset, const uint8_t *data,
+                             uint32_t size);
+
 #endif  // GCONFIG_H
@@ -0,0 +1,49 @@
+/**
+ * File: mngr_json.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Streaming reader of the settings JSON sent by the web UI
+ */
+
+#ifndef MNGR_JSON_H
+#define MNGR_JSON_H
+
+#include <stdbool.h>
+
+// Deepest nesting of the values skipped in the parameter objects
+#define MNGR_JSON_MAX_DEPTH 8
+
+typedef enum {
+  MNGR_JSON_OK = 0,
+  MNGR_JSON_ERR_SYNTAX = -1,     // Not valid JSON
+  MNGR_JSON_ERR_STRUCTURE = -2,  // Not an array of name/type/value objects
+  MNGR_JSON_ERR_CALLBACK = -3    // The callback rejected a parameter
+} mngr_json_status_t;
+
+/**
+ * @brief Called for every parameter object, in document order.
+ *
+ * @return false to stop the parsing with MNGR_JSON_ERR_CALLBACK.
+ */
+typedef bool (*mngr_json_param_cb_t)(const char *name, const char *type,
+                                     const char *value, void *user_data);
+
+/**
+ * @brief Reads a JSON array of {"name","type","value"} objects with string
+ * members, and passes every parameter to the callback as it is read.
+ *
+ * No tree is built and nothing is allocated: the strings are unescaped in
+ * place, so the callback gets pointers into json. Other members of the
+ * objects are skipped.
+ *
+ * @param json The null terminated document, modified if cb is not NULL.
+ * @param cb The callback, or NULL to only check the document. Then json is
+ * left untouched and can be parsed again.
+ * @param user_data Passed to the callback.
+ * @return MNGR_JSON_OK, or why the parsing stopped.
+ */
+mngr_json_status_t mngr_json_parse_params(char *json, mngr_json_param_cb_t cb,
+                                          void *user_data);
+
+#endif  // MNGR_JSON_H
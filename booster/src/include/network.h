@@ -19,7 +19,9 @@
 #endif
 
 #ifdef CYW43_WL_GPIO_LED_PIN
+#include "lwip/dhcp.h"
 #include "lwip/dns.h"
+#include "lwip/init.h"
 #include "lwip/ip4_addr.h"
 #include "lwip/netif.h"
 #include "pico/cyw43_arch.h"
@@ -41,6 +43,13 @@
 
 #define NETWORK_POLLING_INTERVAL 100  // 100 ms
 #define NETWORK_CONNECT_TIMEOUT 30    // 30 seconds
+// Directed join to the cached BSSID and channel before the full join
+#define NETWORK_FAST_JOIN_TIMEOUT_MS 1500
+// Scan to find the SSID of a BSSID given as SSID parameter
+#define NETWORK_BSSID_SCAN_TIMEOUT_MS 6000
+// Wait between STA connection attempts, doubled after every failure
+#define NETWORK_STA_BACKOFF_MIN_MS 500
+#define NETWORK_STA_BACKOFF_MAX_MS 8000
 
 #define NETWORK_POWER_MGMT_DISABLED CYW43_NONE_PM
 #define NETWORK_POWER_MGMT_MAX_OPTIONS 5
@@ -49,7 +58,32 @@
 
 #define NETWORK_MAC_SIZE 6
 
-#define MAX_NETWORKS 100
+// Scan results keep the MAX_NETWORKS strongest BSSIDs. Every SSID is stored
+// once, so there are never more SSIDs than BSSIDs.
+#define MAX_NETWORKS 32
+#define NETWORK_SCAN_MAX_SSIDS MAX_NETWORKS
+#define NETWORK_SSID_MAX_LEN 32
+#define NETWORK_SCAN_NONE 0xFF
+// Open-addressing set of the scanned BSSIDs (power of two, > MAX_NETWORKS)
+#define NETWORK_SCAN_HASH_SLOTS 64
+#define NETWORK_SCAN_HASH_EMPTY NETWORK_SCAN_NONE
+// Networks not heard for NETWORK_SCAN_TTL_MS are dropped. While idle, a scan
+// refreshes them every NETWORK_SCAN_REFRESH_MS.
+#define NETWORK_SCAN_TTL_MS (15 * 60 * 1000)
+#define NETWORK_SCAN_REFRESH_MS (5 * 60 * 1000)
+// The scan results snapshot lives in its own CONFIG_FLASH sector, rewritten
+// when the set of networks changed, at most every
+// NETWORK_SCAN_SNAPSHOT_INTERVAL_MS.
+#define NETWORK_SCAN_SNAPSHOT_UUID "5ca9f1a0-83e2-4c1b-9d6e-2b7f04c3a51e"
+#define NETWORK_SCAN_SNAPSHOT_MAGIC 0x4E435357  // "WSCN"
+#define NETWORK_SCAN_SNAPSHOT_INTERVAL_MS (30 * 60 * 1000)
+// Networks known to the STA mode besides WIFI_SSID, in order of preference.
+// They live in their own CONFIG_FLASH sector.
+#define NETWORK_KNOWN_MAX 8
+#define NETWORK_KNOWN_UUID "0b7e2d5c-4f61-4a8e-b3c9-7d15e6a2f804"
+#define NETWORK_KNOWN_MAGIC 0x4E4B4E57  // "WNKN"
+// Scan to rank WIFI_SSID and the known networks before the first attempt
+#define NETWORK_STA_SELECT_TIMEOUT_MS 4000
 #define MAX_SSID_LENGTH \
   36  // SSID can have up to 32 characters + null terminator + padding
 #define MAX_BSSID_LENGTH 20
@@ -62,6 +96,10 @@
 #define WIFI_AP_AUTH 5
 #define WIFI_AP_HOSTNAME "croissant"
 #define WIFI_AP_PASS_MAX_LENGTH 9
+// WIFI_AP_CHANNEL value to survey channels 1, 6 and 11 before starting the AP
+#define NETWORK_AP_CHANNEL_AUTO -1
+#define NETWORK_AP_CHANNEL_MAX 13
+#define NETWORK_AP_SURVEY_TIMEOUT_MS 4000
 
 // Connection errors as an enumeration
 typedef enum {
@@ -95,24 +133,64 @@ typedef enum {
   NOT_SUPPORTED
 } wifi_sta_conn_status_t;
 
+// States of the non-blocking STA connection
 typedef enum {
-  WIFI_MODE_AP = 0,  // Access Point mode
-  WIFI_MODE_STA = 1  // Station mode
+  NETWORK_STA_IDLE = 0,   // No connection started
+  NETWORK_STA_SELECTING,  // Scanning to join the strongest known network
+  NETWORK_STA_FAST_JOIN,  // Joining the cached BSSID on its channel
+  NETWORK_STA_RESOLVING,  // Scanning for the SSID of the configured BSSID
+  NETWORK_STA_JOINING,    // Join started, waiting for the link and the IP
+  NETWORK_STA_BACKOFF,    // Waiting before the next attempt
+  NETWORK_STA_CONNECTED,  // Connected with an IP address
+  NETWORK_STA_FAILED      // All the attempts failed
+} network_sta_state_t;
+
+typedef enum {
+  WIFI_MODE_AP = 0,     // Access Point mode
+  WIFI_MODE_STA = 1,    // Station mode
+  WIFI_MODE_AP_STA = 2  // Default Access Point, Station in the background
 } wifi_mode_t;
 
 typedef struct {
-  char ssid[MAX_SSID_LENGTH];    // SSID can have up to 32 characters + null
-                                 // terminator
-  char bssid[MAX_BSSID_LENGTH];  // BSSID in the format xx:xx:xx:xx:xx:xx + null
-                                 // terminator
-  uint16_t auth_mode;            // MSB is not used, the data is in the LSB
-  int16_t rssi;                  // Received Signal Strength Indicator
+  uint8_t bssid[NETWORK_MAC_SIZE];  // Raw BSSID, see network_formatBssid()
+  uint8_t ssid;       // Index of the SSID in wifi_scan_data_t.ssids
+  uint8_t next;       // Next BSSID of the same SSID, or NETWORK_SCAN_NONE
+  uint8_t auth_mode;  // The LSB of the CYW43 auth mode, the MSB is not used
+  uint8_t channel;    // Channel the BSSID was heard on
+  int8_t rssi;        // Received Signal Strength Indicator
+  uint32_t generation;  // wifi_scan_data_t.generation of the last update
+  uint32_t seen;        // Milliseconds since boot of the last result
 } wifi_network_info_t;
 
+// Last successful STA join, kept in the WIFI_JOIN parameter
+typedef struct {
+  char ssid[MAX_SSID_LENGTH];
+  uint8_t bssid[NETWORK_MAC_SIZE];
+  uint32_t channel;
+  uint32_t auth;   // CYW43 auth type
+  uint32_t lease;  // DHCP address of the join (network order), 0 if none
+} network_join_cache_t;
+
+// Network the STA mode can join besides WIFI_SSID
+typedef struct {
+  char ssid[MAX_SSID_LENGTH];  // SSID, or BSSID as xx:xx:xx:xx:xx:xx
+  char password[MAX_PASSWORD_LENGTH];  // Empty joins without password
+  uint8_t auth;                        // Same codes as WIFI_AUTH
+} network_known_t;
+
+typedef struct {
+  char name[NETWORK_SSID_MAX_LEN + 1];  // SSID, null terminated
+  uint8_t first;  // First BSSID of this SSID, or NETWORK_SCAN_NONE if unused
+} wifi_ssid_info_t;
+
 typedef struct {
   uint32_t magic;  // Some magic value for identification/validation
-  wifi_network_info_t networks[MAX_NETWORKS];
-  uint16_t count;  // The number of networks found/stored
+  wifi_network_info_t networks[MAX_NETWORKS];  // In use: 0..count-1
+  wifi_ssid_info_t ssids[NETWORK_SCAN_MAX_SSIDS];
+  uint8_t heap[MAX_NETWORKS];  // Min-heap of networks by RSSI, weakest first
+  uint8_t count;               // The number of networks found/stored
+  uint32_t generation;  // Bumped on every network added or refreshed
+  uint32_t epoch;       // Bumped when a network is dropped from the store
 } wifi_scan_data_t;
 
 // Function to handle callback when trying to connect
@@ -184,24 +262,132 @@ int network_scan(absolute_time_t* wifi_scan_time, int wifi_scan_interval);
  */
 int network_scanIsActive();
 
+/**
+ * @brief Starts a WiFi scan right away, unless one is already running.
+ *
+ * Results are merged into the found networks as they arrive: every network
+ * added or refreshed gets the next wifi_scan_data_t.generation, so a reader
+ * can fetch only what changed since the generation it saw last. Dropping a
+ * network bumps wifi_scan_data_t.epoch instead, and readers of an older
+ * epoch have to start over from generation 0.
+ *
+ * @return 0 if a scan was started or is already running, -1 if the network
+ * is not initialized, or the CYW43 error code.
+ */
+int network_scanStart(void);
+
+/**
+ * @brief Maintains the scan results from the main loop.
+ *
+ * Drops the networks older than NETWORK_SCAN_TTL_MS, starts a background
+ * scan every NETWORK_SCAN_REFRESH_MS while no STA join is in progress, and
+ * saves the flash snapshot of the results when they changed. The snapshot is
+ * loaded back with the first access to the results after boot.
+ */
+void network_scanPoll(void);
+
 /**
  * @brief Retrieves information about found WiFi networks.
  *
- * Provides the data structure containing the list of scanned networks.
+ * Provides the data structure containing the list of scanned networks: the
+ * strongest BSSIDs found in networks[0..count-1], in no particular order. The
+ * BSSIDs of one SSID are chained from ssids[i].first through networks[].next.
  *
  * @return Pointer to a wifi_scan_data_t structure with network details.
  */
 wifi_scan_data_t* network_getFoundNetworks();
 
+/**
+ * @brief Formats a raw BSSID as text (xx:xx:xx:xx:xx:xx).
+ *
+ * @param bssid Raw 6-byte BSSID.
+ * @param outBssidStr Buffer of at least MAX_BSSID_LENGTH characters.
+ */
+void network_formatBssid(const uint8_t bssid[NETWORK_MAC_SIZE],
+                         char outBssidStr[MAX_BSSID_LENGTH]);
+
+/**
+ * @brief Copies the known networks, in order of preference.
+ *
+ * Runs in the lwIP context (httpd), or with cyw43_arch_lwip_begin() held.
+ *
+ * @param out Buffer for up to max networks.
+ * @return The number of networks copied.
+ */
+size_t network_knownGet(network_known_t* out, size_t max);
+
+/**
+ * @brief Replaces the known networks. They are written to flash by
+ * network_knownPoll().
+ *
+ * Runs in the lwIP context (httpd), or with cyw43_arch_lwip_begin() held.
+ *
+ * @return false, leaving the list untouched, if there are more than
+ * NETWORK_KNOWN_MAX networks or one of them is not valid.
+ */
+bool network_knownSet(const network_known_t* list, size_t count);
+
+/**
+ * @brief Writes the known networks to flash if they changed. Call it from
+ * the main loop.
+ */
+void network_knownPoll(void);
+
 /**
  * @brief Attempts connecting to a WiFi network in station mode.
  *
- * Implements connection logic including error handling and retries.
+ * Blocking form of network_wifiStaConnectStart() with a single attempt: runs
+ * network_wifiStaConnectPoll() until connected or failed.
  *
  * @return Status code indicating connection success or failure.
  */
 wifi_sta_conn_process_status_t network_wifiStaConnect();
 
+/**
+ * @brief Starts connecting to the configured WiFi network in station mode
+ * without blocking.
+ *
+ * Sets up the interface and starts the first attempt. The connection then
+ * advances with network_wifiStaConnectPoll(), to be called from the main
+ * loop. With known networks besides WIFI_SSID, a scan ranks them first and
+ * the strongest one heard is tried first; a failed network moves on to the
+ * next one. When all of them failed, the attempt is retried after a backoff
+ * that doubles every time, from NETWORK_STA_BACKOFF_MIN_MS to
+ * NETWORK_STA_BACKOFF_MAX_MS.
+ *
+ * @param attempts Number of attempts before giving up.
+ * @return NETWORK_WIFI_STA_CONN_OK if started, or the configuration error.
+ */
+wifi_sta_conn_process_status_t network_wifiStaConnectStart(int attempts);
+
+/**
+ * @brief Advances the connection started by network_wifiStaConnectStart().
+ *
+ * @return network_sta_state_t The state after the step. NETWORK_STA_CONNECTED
+ * and NETWORK_STA_FAILED are final.
+ */
+network_sta_state_t network_wifiStaConnectPoll(void);
+
+/**
+ * @brief Returns why the last STA connection failed, or
+ * NETWORK_WIFI_STA_CONN_OK if connected.
+ */
+wifi_sta_conn_process_status_t network_wifiStaConnectError(void);
+
+/**
+ * @brief Returns the state of the STA connection without advancing it, and
+ * a short description of it for the web UI.
+ */
+network_sta_state_t network_wifiStaState(void);
+const char *network_wifiStaStateString(void);
+
+/**
+ * @brief Returns the mode the network was initialized with, and whether it
+ * includes the STA interface (WIFI_MODE_STA or WIFI_MODE_AP_STA).
+ */
+wifi_mode_t network_getWifiMode(void);
+bool network_staEnabled(void);
+
 /**
  * @brief Obtains the current WiFi connection status.
  *
@@ -209,7 +395,7 @@ wifi_sta_conn_process_status_t network_wifiStaConnect();
  * verification.
  *
  * @param wifi_conn_status_time Pointer to an absolute time structure updated
- * upon status check.
+ * upon status check, or NULL to check the status now.
  * @param wifi_con_status_interval Interval for checking status in milliseconds.
  * @return Enumerated WiFi connection status.
  */
@@ -254,6 +440,13 @@ const char* network_getAuthTypeStringShort(uint16_t connect_code);
  */
 ip_addr_t network_getCurrentIp();
 
+/**
+ * @brief Returns the channel the AP is on, or 0 if the AP is not up.
+ *
+ * In AP+STA mode the AP follows the channel of the STA network once joined.
+ */
+uint32_t network_getApChannel(void);
+
 /**
  * @brief Parses and cleans up an SSID string.
  *
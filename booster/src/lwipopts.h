@@ -129,11 +129,25 @@
 // debug
 #define LWIP_HTTPD_SSI_INCLUDE_TAG 0
 #define LWIP_HTTPD_SSI_MULTIPART 1
-#define LWIP_HTTPD_DYNAMIC_HEADERS 0
+// Only the files flagged FS_FILE_FLAGS_SSI by makefsdata are parsed
+#define LWIP_HTTPD_SSI_BY_FILE_EXTENSION 0
+#define LWIP_HTTPD_DYNAMIC_HEADERS 1
 #define LWIP_HTTPD_SUPPORT_POST 1
-#define LWIP_HTTPD_SUPPORT_11_KEEPALIVE 0
+#define LWIP_HTTPD_SUPPORT_11_KEEPALIVE 1
+// fs_open_custom in mngr_httpd.c serves the CGI JSON answers with a length
+#define LWIP_HTTPD_CUSTOM_FILES 1
+// The custom files live in the mngr_httpd.c arena, emptied when the file is
+// closed, which can be before the peer ACKs the data: tcp_write must copy
+// them (as the SSI output) so a retransmission never reads a reused arena.
+#define HTTP_IS_DATA_VOLATILE(hs)                           \
+  (((hs)->ssi != NULL ||                                    \
+    ((hs)->handle != NULL && (hs)->handle->is_custom_file)) \
+       ? TCP_WRITE_FLAG_COPY                                \
+       : 0)
 
 #define LWIP_HTTPD_FS_ASYNC_READ 0
+// fs_state_init/fs_state_free in mngr_httpd.c track the responses in flight
+#define LWIP_HTTPD_FILE_STATE 1
 #define HTTPD_POLL_INTERVAL 1
 #define HTTPD_PRECALCULATED_CHECKSUM 1
 #define HTTPD_USE_MEM_POOL 1
@@ -103,7 +103,9 @@ int main() {
   // If we are here, the next time we boot in IKBD mode
   settings_put_string(gconfig_getContext(), PARAM_BOOT_FEATURE, "IKBD");
   settings_save(gconfig_getContext(), true);
-  DPRINTF("Boot feature set to IKBD for next boot\n");
+  DPRINTF("Boot feature set to IKBD for next boot (%lu saved, %lu skipped)\n",
+          (unsigned long)gconfig_getContext()->saveCount,
+          (unsigned long)gconfig_getContext()->skipCount);
   mngr_init();
   mngr_loop();
   return 0;
@@ -19,14 +19,60 @@
 #include "pico/stdlib.h"
 
 #define MNGR_BLINK_PERIOD_MS 500
+#define MNGR_STA_CONNECT_ATTEMPTS 3
+
+// STA connection still in progress. In STA mode the httpd starts once it is
+// resolved; in AP+STA mode it is already serving on the AP.
+static bool staConnecting = false;
+static bool httpdStarted = false;
+
+static void mngr_startHttpd(void) {
+  if (!httpdStarted) {
+    mngr_httpd_start();
+    httpdStarted = true;
+  }
+}
+
+static void mngr_staResolved(bool connected) {
+  staConnecting = false;
+  if (connected) {
+    DPRINTF("WiFi STA connected.\n");
+  } else if (network_getWifiMode() == WIFI_MODE_AP_STA) {
+    DPRINTF("STA connection failed after retries. The AP stays up.\n");
+  } else {
+    DPRINTF("STA connection failed after retries.\n");
+#ifdef CYW43_WL_GPIO_LED_PIN
+    DPRINTF("Falling back to AP mode.\n");
+    // Use AP fallback defaults instead of STA credentials.
+    settings_put_integer(gconfig_getContext(), PARAM_WIFI_MODE, WIFI_MODE_AP);
+    settings_put_string(gconfig_getContext(), PARAM_HOSTNAME, WIFI_AP_HOSTNAME);
+    settings_put_string(gconfig_getContext(), PARAM_WIFI_PASSWORD, WIFI_AP_PASS);
+    settings_put_integer(gconfig_getContext(), PARAM_WIFI_AUTH, WIFI_AP_AUTH);
+    // Mode switch: persist the fallback before tearing down the network
+    gconfig_commit();
+    int err = gconfig_flush();
+    if (err != 0) {
+      DPRINTF("Error saving AP fallback settings: %i\n", err);
+    }
+    network_deInit();
+    err = network_wifiInit(WIFI_MODE_AP);
+    if (err != 0) {
+      DPRINTF("Error initializing AP fallback: %i\n", err);
+      return;
+    }
+#else
+    return;
+#endif
+  }
+  mngr_startHttpd();
+}
 
 int __not_in_flash_func(mngr_init)() {
   wifi_mode_t wifi_mode_value = WIFI_MODE_AP;
-  SettingsConfigEntry *wifi_mode_param =
-      settings_find_entry(gconfig_getContext(), PARAM_WIFI_MODE);
-  if (wifi_mode_param != NULL && wifi_mode_param->value != NULL &&
-      atoi(wifi_mode_param->value) == 1) {
+  if (gconfig_get_int(GCONFIG_ID_WIFI_MODE) == WIFI_MODE_STA) {
     wifi_mode_value = WIFI_MODE_STA;
+  } else if (gconfig_get_int(GCONFIG_ID_WIFI_MODE) == WIFI_MODE_AP_STA) {
+    wifi_mode_value = WIFI_MODE_AP_STA;
   }
 
   int err = network_wifiInit(wifi_mode_value);
@@ -35,54 +81,31 @@ int __not_in_flash_func(mngr_init)() {
     return err;
   }
 
-  if (wifi_mode_value == WIFI_MODE_STA) {
+  // Bluetooth scanning remains disabled until explicitly started via CGI.
+  btloop_disable();
+
+  if (wifi_mode_value == WIFI_MODE_AP_STA) {
+    // The config UI is reachable on the AP while the STA joins
+    DPRINTF("WiFi AP ready. Joining the STA network in the background.\n");
+    mngr_startHttpd();
+  }
+
+  if (wifi_mode_value != WIFI_MODE_AP) {
+    // The join runs from mngr_loop, so the rest of the firmware keeps
+    // running while it is in progress.
     DPRINTF("Connecting to WiFi network (STA mode)...\n");
-    int numRetries = 3;
-    int staErr = NETWORK_WIFI_STA_CONN_ERR_TIMEOUT;
-    while (staErr != NETWORK_WIFI_STA_CONN_OK && numRetries > 0) {
-      staErr = network_wifiStaConnect();
-      if (staErr < 0) {
-        DPRINTF("Error connecting to WiFi in STA mode: %i\n", staErr);
-        DPRINTF("Number of retries left: %i\n", numRetries - 1);
-        numRetries--;
-        if (numRetries > 0) {
-          sleep_ms(1000);
-        }
-      }
-    }
+    int staErr = network_wifiStaConnectStart(MNGR_STA_CONNECT_ATTEMPTS);
     if (staErr != NETWORK_WIFI_STA_CONN_OK) {
-      DPRINTF("STA connection failed after retries.\n");
-#ifdef CYW43_WL_GPIO_LED_PIN
-      DPRINTF("Falling back to AP mode.\n");
-      // Use AP fallback defaults instead of STA credentials.
-      settings_put_integer(gconfig_getContext(), PARAM_WIFI_MODE, WIFI_MODE_AP);
-      settings_put_string(gconfig_getContext(), PARAM_HOSTNAME, WIFI_AP_HOSTNAME);
-      settings_put_string(gconfig_getContext(), PARAM_WIFI_PASSWORD, WIFI_AP_PASS);
-      settings_put_integer(gconfig_getContext(), PARAM_WIFI_AUTH, WIFI_AP_AUTH);
-      err = settings_save(gconfig_getContext(), true);
-      if (err != 0) {
-        DPRINTF("Error saving AP fallback settings: %i\n", err);
-      }
-      network_deInit();
-      err = network_wifiInit(WIFI_MODE_AP);
-      if (err != 0) {
-        DPRINTF("Error initializing AP fallback: %i\n", err);
-        return err;
-      }
-#else
-      return staErr;
-#endif
+      DPRINTF("Error connecting to WiFi in STA mode: %i\n", staErr);
+      mngr_staResolved(false);
     } else {
-      DPRINTF("WiFi STA connected.\n");
+      staConnecting = true;
     }
   } else {
     DPRINTF("WiFi AP ready.\n");
+    mngr_startHttpd();
   }
 
-  // Bluetooth scanning remains disabled until explicitly started via CGI.
-  btloop_disable();
-  mngr_httpd_start();
-
   return 0;
 }
 
@@ -98,7 +121,16 @@ void __not_in_flash_func(mngr_loop)() {
 #else
     sleep_ms(10);
 #endif
+    if (staConnecting) {
+      network_sta_state_t staState = network_wifiStaConnectPoll();
+      if (staState == NETWORK_STA_CONNECTED || staState == NETWORK_STA_FAILED) {
+        mngr_staResolved(staState == NETWORK_STA_CONNECTED);
+      }
+    }
+    network_scanPoll();
+    network_knownPoll();
     btloop_poll();
+    gconfig_poll();
     if (absolute_time_diff_us(get_absolute_time(), next_blink) <= 0) {
       usb_active = !usb_active;
       gpio_put(KBD_USB_OUT_3V3_GPIO, usb_active);
@@ -17,63 +17,170 @@
 
 #include "btstack.h"
 #include "btstack_util.h"
-#include "cjson/cJSON.h"
 #include "constants.h"
 #include "debug.h"
 #include "gconfig.h"
 #include "include/btloop.h"
+#include "lwip/apps/fs.h"
 #include "lwip/apps/httpd.h"
 #include "lwip/err.h"
 #include "lwip/pbuf.h"
-#include "mbedtls/base64.h"
+#include "mngr_json.h"
 #include "network.h"
 #include "version.h"
 
-// Basic stubs for LWIP_HTTPD_SUPPORT_POST to satisfy linker; POST bodies are
-// ignored.
-err_t httpd_post_begin(void *connection, const char *uri,
-                       const char *http_request, u16_t http_request_len,
-                       int content_len, char *response_uri,
-                       u16_t response_uri_len, u8_t *post_auto_wnd) {
-  (void)connection;
-  (void)uri;
-  (void)http_request;
-  (void)http_request_len;
-  (void)content_len;
-  if (post_auto_wnd != NULL) {
-    *post_auto_wnd = 1;  // let httpd handle windowing
+#define WIFI_PASS_BUFSIZE 64
+static char *ssid = NULL;
+static char *pass = NULL;
+static int auth = -1;
+static void *current_connection;
+static void *valid_connection;
+static mngr_httpd_response_status_t response_status = MNGR_HTTPD_RESPONSE_OK;
+static char httpd_response_message[128] = {0};
+static char httpd_json_payload[2048] = "[]";
+
+// Room kept at the end of the scan payload for the closing fields
+#define WIFI_SCAN_JSON_TAIL 64
+
+// Request scoped bump arena for the POST bodies, the scratch memory of the
+// CGI handlers and the JSON answers. It is emptied at once when the last
+// response in flight completes and no POST body is being received.
+#define MNGR_HTTPD_ARENA_SIZE 4096
+#define MNGR_HTTPD_ARENA_ALIGN 8
+
+static uint8_t arena[MNGR_HTTPD_ARENA_SIZE]
+    __attribute__((aligned(MNGR_HTTPD_ARENA_ALIGN)));
+static size_t arena_used = 0;
+static int arena_users = 0;  // Open responses and POST bodies in progress
+
+// POST bodies are collected in a slot per connection until complete
+#define MNGR_HTTPD_POST_SLOTS 2
+#define MNGR_HTTPD_POST_MAX_LEN 2048
+#define MNGR_HTTPD_POST_TIMEOUT_MS 10000
+
+typedef struct {
+  void *connection;  // NULL if free
+  uint32_t started_ms;
+  u16_t len;
+  u16_t capacity;  // Content-Length of the request
+  bool overflow;
+  char *body;  // In the arena
+  const char *(*apply)(char *body);  // Handler of the target, see post_targets
+} post_slot_t;
+
+static post_slot_t post_slots[MNGR_HTTPD_POST_SLOTS];
+
+/**
+ * @brief Allocates scratch memory for the request being handled. It stays
+ * valid until the response completes; there is no free.
+ *
+ * @return The memory, aligned to MNGR_HTTPD_ARENA_ALIGN, or NULL if the
+ * arena is full.
+ */
+static void *arena_alloc(size_t size) {
+  size_t start = (arena_used + MNGR_HTTPD_ARENA_ALIGN - 1) &
+                 ~(size_t)(MNGR_HTTPD_ARENA_ALIGN - 1);
+  if (size > MNGR_HTTPD_ARENA_SIZE - start) {
+    DPRINTF("HTTPD arena full: %u bytes requested, %u used\n",
+            (unsigned)size, (unsigned)arena_used);
+    return NULL;
+  }
+  arena_used = start + size;
+  return &arena[start];
+}
+
+static void arena_hold(void) { arena_users++; }
+
+static void arena_release(void) {
+  if (arena_users > 0) {
+    arena_users--;
   }
-  if (response_uri != NULL && response_uri_len > 0) {
-    response_uri[0] = '\0';  // default response
+  if (arena_users == 0) {
+    arena_used = 0;
   }
-  return ERR_OK;
 }
 
-err_t httpd_post_receive_data(void *connection, struct pbuf *p) {
-  (void)connection;
-  if (p != NULL) {
-    pbuf_free(p);  // free received data
+// Frees the slots of connections that went away without finishing the body
+static void post_reclaim_stale(uint32_t now) {
+  for (size_t i = 0; i < MNGR_HTTPD_POST_SLOTS; i++) {
+    if (post_slots[i].connection != NULL &&
+        now - post_slots[i].started_ms >= MNGR_HTTPD_POST_TIMEOUT_MS) {
+      DPRINTF("Reclaiming a stale POST slot\n");
+      post_slots[i].connection = NULL;
+      arena_release();
+    }
   }
-  return ERR_OK;
 }
 
-void httpd_post_finished(void *connection, char *response_uri,
-                         u16_t response_uri_len) {
-  (void)connection;
-  if (response_uri != NULL && response_uri_len > 0) {
-    response_uri[0] = '\0';
+/**
+ * @brief Called by the httpd when it opens a file from fsdata. The arena is
+ * held until the file is closed. The httpd does not call it for the custom
+ * files, which take their hold in custom_file_serve().
+ */
+void *fs_state_init(struct fs_file *file, const char *name) {
+  (void)file;
+  (void)name;
+  arena_hold();
+  return NULL;
+}
+
+void fs_state_free(struct fs_file *file, void *state) {
+  (void)file;
+  (void)state;
+  post_reclaim_stale(to_ms_since_boot(get_absolute_time()));
+  arena_release();
+}
+
+// Copies a response body to the arena and serves it from there. The httpd
+// hands it to tcp_write() as volatile data (HTTP_IS_DATA_VOLATILE in
+// lwipopts.h), so the arena can be emptied before the peer ACKs it. The hold
+// taken here is released by fs_state_free() when the file is closed.
+static int custom_file_serve(struct fs_file *file, const char *body,
+                             size_t len) {
+  char *data = arena_alloc(len + 1);
+  if (data == NULL) {
+    return 0;
   }
+  memcpy(data, body, len + 1);
+  memset(file, 0, sizeof(*file));
+  file->data = data;
+  file->len = (int)len;
+  file->index = (int)len;
+  // No header in the data: the httpd generates one with a Content-Length,
+  // and keeps the connection alive
+  file->flags = FS_FILE_FLAGS_HEADER_PERSISTENT;
+  arena_hold();
+  return 1;
 }
 
-#define WIFI_PASS_BUFSIZE 64
-static char *ssid = NULL;
-static char *pass = NULL;
-static int auth = -1;
-static void *current_connection;
-static void *valid_connection;
-static mngr_httpd_response_status_t response_status = MNGR_HTTPD_RESPONSE_OK;
-static char httpd_response_message[128] = {0};
-static char httpd_json_payload[1024] = "[]";
+/**
+ * @brief Called by the httpd before it looks a file up in fsdata. The JSON
+ * answers of the CGI handlers are served from here instead of through
+ * their SSI pages: their length is known, so httpd sends a Content-Length
+ * and keeps the connection alive. The body is copied because the next
+ * request may overwrite the payload while this one is still being sent.
+ *
+ * @return 1 if the file was opened, 0 to fall back to fsdata, which also
+ * happens if the arena is full.
+ */
+int fs_open_custom(struct fs_file *file, const char *name) {
+  if (strcmp(name, "/json.shtml") == 0) {
+    return custom_file_serve(file, httpd_json_payload,
+                             strlen(httpd_json_payload));
+  }
+  if (strcmp(name, "/response.shtml") == 0) {
+    char body[sizeof(httpd_response_message) + 32];
+    int len = snprintf(body, sizeof(body), "{\"status\":%d,\"message\":\"%s\"}",
+                       response_status, httpd_response_message);
+    if (len < 0 || len >= (int)sizeof(body)) {
+      return 0;
+    }
+    return custom_file_serve(file, body, (size_t)len);
+  }
+  return 0;
+}
+
+void fs_close_custom(struct fs_file *file) { (void)file; }
 
 static bool parse_addr_from_setting_value(const char *value, bd_addr_t addr) {
   if (value == NULL || value[0] == '\0') {
@@ -115,13 +222,6 @@ static int starts_with_case_insensitive(const char *str, const char *chars) {
   return 0;
 }
 
-static int hex_to_int(char c) {
-  if (c >= '0' && c <= '9') return c - '0';
-  if (c >= 'a' && c <= 'f') return 10 + (c - 'a');
-  if (c >= 'A' && c <= 'F') return 10 + (c - 'A');
-  return -1;
-}
-
 static void to_lowercase_copy(const char *src, char *dst, size_t dst_len) {
   if (dst_len == 0) {
     return;
@@ -134,64 +234,35 @@ static void to_lowercase_copy(const char *src, char *dst, size_t dst_len) {
 }
 
 /**
- * @brief URL-decode a percent-encoded string.
+ * @brief Escape a string to be embedded in a JSON string literal.
  *
- * @param src Source string (null-terminated).
- * @param dst Destination buffer.
- * @param dst_len Length of destination buffer.
- * @return 0 on success, -1 on overflow or invalid hex.
+ * @param src The source string.
+ * @param dst The destination buffer.
+ * @param dst_len The size of the destination buffer.
  */
-static int url_decode(const char *src, char *dst, size_t dst_len) {
-  size_t si = 0;
+static void json_escape(const char *src, char *dst, size_t dst_len) {
   size_t di = 0;
-  while (src[si] != '\0') {
-    if (di + 1 >= dst_len) {  // leave space for null terminator
-      return -1;
-    }
-    if (src[si] == '%' && src[si + 1] && src[si + 2]) {
-      int hi = hex_to_int(src[si + 1]);
-      int lo = hex_to_int(src[si + 2]);
-      if (hi < 0 || lo < 0) {
-        return -1;
-      }
-      dst[di++] = (char)((hi << 4) | lo);
-      si += 3;
-    } else if (src[si] == '+') {
-      dst[di++] = ' ';
-      si++;
+  for (size_t si = 0; src[si] != '\0'; si++) {
+    unsigned char c = (unsigned char)src[si];
+    char esc[7];
+    size_t len;
+    if (c == '"' || c == '\\') {
+      esc[0] = '\\';
+      esc[1] = (char)c;
+      len = 2;
+    } else if (c < 0x20) {
+      len = (size_t)snprintf(esc, sizeof(esc), "\\u%04x", c);
     } else {
-      dst[di++] = src[si++];
+      esc[0] = (char)c;
+      len = 1;
     }
-  }
-  dst[di] = '\0';
-  return 0;
-}
-
-static char *get_status_message(mngr_httpd_response_status_t status,
-                                const char *detail) {
-  // Concatenate the detail
-  char *message = (char *)malloc(128);
-  if (message == NULL) {
-    return NULL;
-  }
-  switch (status) {
-    case MNGR_HTTPD_RESPONSE_OK:
-      snprintf(message, 128, "OK: %s", detail);
-      break;
-    case MNGR_HTTPD_RESPONSE_BAD_REQUEST:
-      snprintf(message, 128, "Bad Request: %s", detail);
-      break;
-    case MNGR_HTTPD_RESPONSE_NOT_FOUND:
-      snprintf(message, 128, "Not Found: %s", detail);
-      break;
-    case MNGR_HTTPD_RESPONSE_INTERNAL_SERVER_ERROR:
-      snprintf(message, 128, "Internal Server Error: %s", detail);
-      break;
-    default:
-      snprintf(message, 128, "Unknown status: %s", detail);
+    if (di + len >= dst_len) {
       break;
+    }
+    memcpy(&dst[di], esc, len);
+    di += len;
   }
-  return message;
+  dst[di] = '\0';
 }
 
 /**
@@ -220,7 +291,7 @@ static const char *ssi_tags[] = {
     "CTARGET",   // 14 - Computer target mask
     "BTGSHT",    // 15 - BT gamepad auto-shoot speed
     "JASHT",     // 16 - USB joystick auto-shoot speed
-    "WFIMODE",   // 17 - WiFi mode (0=AP,1=STA)
+    "WFIMODE",   // 17 - WiFi mode (0=AP,1=STA,2=AP+STA)
     "WFIHOST",   // 18 - WiFi hostname
     "WFISSID",   // 19 - WiFi SSID
     "WFIPASS",   // 20 - WiFi password
@@ -228,6 +299,10 @@ static const char *ssi_tags[] = {
     "WDFHOST",   // 22 - WiFi default AP hostname
     "WDFPASS",   // 23 - WiFi default AP password
     "WDFAUTH",   // 24 - WiFi default AP auth mode
+    "WFISTA",    // 25 - WiFi STA connection progress
+    "WFIAPCH",   // 26 - WiFi AP channel setting (0=default,-1=auto)
+    "WFICHAN",   // 27 - WiFi AP current channel
+    "WFISTIP",   // 28 - WiFi STA static IP (empty=DHCP)
 };
 
 /**
@@ -247,151 +322,219 @@ static const char *cgi_test(int iIndex, int iNumParams, char *pcParam[],
 }
 
 /**
- * @brief Update the given params with the new values
+ * @brief Applies one parameter of the settings JSON.
+ *
+ * @param user_data The mode requested by a MODE parameter, int.
+ * @return false if the type is not STRING, INT or BOOL.
+ */
+static bool apply_setting(const char *name, const char *type,
+                          const char *value, void *user_data) {
+  int *requested_mode = (int *)user_data;
+  DPRINTF("Param Name: %s, Type: %s, Value: %s\n", name, type, value);
+  if (strcasecmp(type, "STRING") == 0) {
+    // Lowercase USB KB layout to keep stored value consistent
+    if (strcasecmp(name, PARAM_USB_KB_LAYOUT) == 0) {
+      char lower_buf[16];
+      to_lowercase_copy(value, lower_buf, sizeof(lower_buf));
+      settings_put_string(gconfig_getContext(), name, lower_buf);
+      DPRINTF("Setting %s to %s saved (normalized lowercase).\n", name,
+              lower_buf);
+    } else {
+      settings_put_string(gconfig_getContext(), name, value);
+      DPRINTF("Setting %s to %s saved.\n", name, value);
+    }
+  } else if (strcasecmp(type, "INT") == 0) {
+    int int_value = atoi(value);
+    if (strcasecmp(name, PARAM_MODE) == 0) {
+      *requested_mode = int_value;
+    }
+    settings_put_integer(gconfig_getContext(), name, int_value);
+    DPRINTF("Setting %s to %d saved.\n", name, int_value);
+  } else if (strcasecmp(type, "BOOL") == 0) {
+    // Check if the value starts with "Y", "y", "T", or "t"
+    int bool_value = starts_with_case_insensitive(value, "YyTt");
+    settings_put_bool(gconfig_getContext(), name, bool_value);
+    DPRINTF("Setting %s to %s saved.\n", name, bool_value ? "true" : "false");
+  } else {
+    DPRINTF("Invalid parameter type in JSON\n");
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Applies a JSON array of {"name","type","value"} settings and
+ * saves them to flash before answering. Sets response_status and
+ * httpd_response_message.
  *
+ * The parameters are applied as they are read, without building a tree. The
+ * whole document is checked first, so a malformed one changes nothing.
  *
- * @param iIndex The index of the CGI handler.
- * @param iNumParams The number of parameters passed to the CGI handler.
- * @param pcParam An array of parameter names.
- * @param pcValue An array of parameter values.
- * @return The URL of the page to redirect to wait for the download process
+ * @param json The null terminated JSON document, modified.
+ * @return The response page.
  */
-const char *cgi_saveparams(int iIndex, int iNumParams, char *pcParam[],
-                          char *pcValue[]) {
-  DPRINTF("cgi_saveparams called with index %d\n", iIndex);
+static const char *apply_settings_json(char *json) {
   int requested_mode = -1;
-  for (size_t i = 0; i < iNumParams; i++) {
-    /* check if parameter is "json" */
-    if (strcmp(pcParam[i], "json") == 0) {
-      DPRINTF("JSON encoded value: %s\n", pcValue[i]);
-      int ret;
-      size_t len = 0;
-      char url_decoded_param[4096];
-      char output_buffer[4096];
-      if (url_decode(pcValue[i], url_decoded_param,
-                     sizeof(url_decoded_param)) != 0) {
-        DPRINTF("Error URL-decoding base64 param\n");
-        response_status = MNGR_HTTPD_RESPONSE_BAD_REQUEST;
-        snprintf(httpd_response_message, sizeof(httpd_response_message), "%s",
-                 "Error URL-decoding parameter");
-        return "/response.shtml";
-      }
-      ret = mbedtls_base64_decode(
-          (unsigned char *)output_buffer,  // destination
-          sizeof(output_buffer),           // dest size
-          &len,                            // number of bytes decoded
-          (const unsigned char *)url_decoded_param, strlen(url_decoded_param));
-      // Place a null terminator at the end of the string
-      output_buffer[len] = '\0';
-      if (ret != 0) {
-        DPRINTF("Error decoding base64: %d\n", ret);
-        response_status = MNGR_HTTPD_RESPONSE_BAD_REQUEST;
-        char detail[64] = {0};
-        snprintf(detail, sizeof(detail), "Error decoding base64: %d", ret);
-        snprintf(httpd_response_message, sizeof(httpd_response_message), "%s",
-                 get_status_message(response_status, detail));
-      } else {
-        DPRINTF("Decoded value: %s\n", output_buffer);
-        // Parse the JSON object
-        bool valid_json = true;
-        cJSON *root = cJSON_Parse(output_buffer);
-        if (root == NULL) {
-          DPRINTF("Error parsing JSON\n");
-          response_status = MNGR_HTTPD_RESPONSE_BAD_REQUEST;
-          snprintf(httpd_response_message, sizeof(httpd_response_message),
-                   "Error parsing JSON");
-          valid_json = false;
-        } else {
-          // Iterate over the JSON array
-          cJSON *item = NULL;
-          cJSON_ArrayForEach(item, root) {
-            cJSON *name = cJSON_GetObjectItem(item, "name");
-            cJSON *type = cJSON_GetObjectItem(item, "type");
-            cJSON *value = cJSON_GetObjectItem(item, "value");
-
-            // Print each parameter
-            if (cJSON_IsString(name) && cJSON_IsString(type) &&
-                cJSON_IsString(value)) {
-              DPRINTF("Param Name: %s, Type: %s, Value: %s\n",
-                      name->valuestring, type->valuestring, value->valuestring);
-              if (strcasecmp(type->valuestring, "STRING") == 0) {
-                // Lowercase USB KB layout to keep stored value consistent
-                if (strcasecmp(name->valuestring, PARAM_USB_KB_LAYOUT) == 0) {
-                  char lower_buf[16];
-                  to_lowercase_copy(value->valuestring, lower_buf,
-                                    sizeof(lower_buf));
-                  settings_put_string(gconfig_getContext(), name->valuestring,
-                                      lower_buf);
-                  DPRINTF("Setting %s to %s saved (normalized lowercase).\n",
-                          name->valuestring, lower_buf);
-                } else {
-                  settings_put_string(gconfig_getContext(), name->valuestring,
-                                      value->valuestring);
-                  DPRINTF("Setting %s to %s saved.\n", name->valuestring,
-                          value->valuestring);
-                }
-              } else if (strcasecmp(type->valuestring, "INT") == 0) {
-                int int_value = atoi(value->valuestring);
-                if (strcasecmp(name->valuestring, PARAM_MODE) == 0) {
-                  requested_mode = int_value;
-                }
-                settings_put_integer(gconfig_getContext(), name->valuestring,
-                                     int_value);
-                DPRINTF("Setting %s to %d saved.\n", name->valuestring,
-                        int_value);
-              } else if (strcasecmp(type->valuestring, "BOOL") == 0) {
-                // Check if the value starts with "Y", "y", "T", or "t"
-                int bool_value =
-                    starts_with_case_insensitive(value->valuestring, "YyTt");
-                settings_put_bool(gconfig_getContext(), name->valuestring,
-                                  bool_value);
-                DPRINTF("Setting %s to %s saved.\n", name->valuestring,
-                        bool_value ? "true" : "false");
-              } else {
-                DPRINTF("Invalid parameter type in JSON\n");
-                response_status = MNGR_HTTPD_RESPONSE_BAD_REQUEST;
-                snprintf(httpd_response_message, sizeof(httpd_response_message),
-                         "Invalid parameter type in JSON");
-                valid_json = false;
-              }
-            } else {
-              DPRINTF("Invalid parameter structure in JSON\n");
-              response_status = MNGR_HTTPD_RESPONSE_BAD_REQUEST;
-              snprintf(httpd_response_message, sizeof(httpd_response_message),
-                       "Invalid parameter structure in JSON");
-              valid_json = false;
-            }
-          }
-
-          // Free the parsed JSON object
-          cJSON_Delete(root);
-
-          if (valid_json) {
-            if (requested_mode == 1 || requested_mode == 2) {
-              settings_put_integer(gconfig_getContext(), PARAM_MODE,
-                                   requested_mode);
-              DPRINTF("Setting %s to %d saved (selected mode).\n", PARAM_MODE,
-                      requested_mode);
-            }
-            settings_save(gconfig_getContext(), true);
-            DPRINTF("Settings saved\n");
-            response_status = MNGR_HTTPD_RESPONSE_OK;
-            snprintf(httpd_response_message, sizeof(httpd_response_message),
-                     "");
-          }
-        }
-      }
-      return "/response.shtml";
-    }
+  mngr_json_status_t status = mngr_json_parse_params(json, NULL, NULL);
+  if (status == MNGR_JSON_OK) {
+    status = mngr_json_parse_params(json, apply_setting, &requested_mode);
+  }
+  if (status != MNGR_JSON_OK) {
+    response_status = MNGR_HTTPD_RESPONSE_BAD_REQUEST;
+    snprintf(httpd_response_message, sizeof(httpd_response_message), "%s",
+             status == MNGR_JSON_ERR_SYNTAX ? "Error parsing JSON"
+             : status == MNGR_JSON_ERR_STRUCTURE
+                 ? "Invalid parameter structure in JSON"
+                 : "Invalid parameter type in JSON");
+    return "/response.shtml";
   }
 
-  // If no "json" parameter is found
-  response_status = MNGR_HTTPD_RESPONSE_BAD_REQUEST;
-  snprintf(httpd_response_message, sizeof(httpd_response_message),
-           "Missing 'json' parameter");
+  if (requested_mode == 1 || requested_mode == 2) {
+    settings_put_integer(gconfig_getContext(), PARAM_MODE, requested_mode);
+    DPRINTF("Setting %s to %d saved (selected mode).\n", PARAM_MODE,
+            requested_mode);
+  }
+  // The page tells the user the values are stored: save them before the
+  // answer instead of leaving them to the write-behind
+  gconfig_commit();
+  int err = gconfig_flush();
+  if (err != 0) {
+    response_status = MNGR_HTTPD_RESPONSE_INTERNAL_SERVER_ERROR;
+    snprintf(httpd_response_message, sizeof(httpd_response_message),
+             "Unable to save the settings (%d)", err);
+    return "/response.shtml";
+  }
+  DPRINTF("Settings saved\n");
+  response_status = MNGR_HTTPD_RESPONSE_OK;
+  httpd_response_message[0] = '\0';
   return "/response.shtml";
 }
 
+/**
+ * @brief Finds the POST slot of a connection, or NULL.
+ */
+static post_slot_t *post_slot_find(const void *connection) {
+  for (size_t i = 0; i < MNGR_HTTPD_POST_SLOTS; i++) {
+    if (post_slots[i].connection == connection) {
+      return &post_slots[i];
+    }
+  }
+  return NULL;
+}
+
+static void post_reply(char *response_uri, u16_t response_uri_len,
+                       mngr_httpd_response_status_t status,
+                       const char *message) {
+  response_status = status;
+  snprintf(httpd_response_message, sizeof(httpd_response_message), "%s",
+           message);
+  snprintf(response_uri, response_uri_len, "/response.shtml");
+}
+
+static const char *apply_wifinets_json(char *json);
+
+// The URLs taking a POST body, a JSON array of {"name","type","value"}, and
+// the handlers applying it once complete
+static const struct {
+  const char *uri;
+  const char *(*apply)(char *body);
+} post_targets[] = {{"/saveparams.cgi", apply_settings_json},
+                    {"/wifinets.cgi", apply_wifinets_json}};
+
+/**
+ * @brief Starts a POST request to one of post_targets. The body is up to
+ * MNGR_HTTPD_POST_MAX_LEN bytes.
+ *
+ * The body is collected in a free slot. A slot whose connection went away
+ * without finishing is reclaimed after MNGR_HTTPD_POST_TIMEOUT_MS.
+ */
+err_t httpd_post_begin(void *connection, const char *uri,
+                       const char *http_request, u16_t http_request_len,
+                       int content_len, char *response_uri,
+                       u16_t response_uri_len, u8_t *post_auto_wnd) {
+  (void)http_request;
+  (void)http_request_len;
+  *post_auto_wnd = 1;  // let httpd handle windowing
+  const char *(*apply)(char *body) = NULL;
+  for (size_t i = 0; i < sizeof(post_targets) / sizeof(post_targets[0]); i++) {
+    if (strcmp(uri, post_targets[i].uri) == 0) {
+      apply = post_targets[i].apply;
+    }
+  }
+  if (apply == NULL) {
+    post_reply(response_uri, response_uri_len,
+               MNGR_HTTPD_RESPONSE_NOT_FOUND, "Unknown POST target");
+    return ERR_ARG;
+  }
+  if (content_len <= 0 || content_len > MNGR_HTTPD_POST_MAX_LEN) {
+    DPRINTF("POST body of %d bytes rejected\n", content_len);
+    post_reply(response_uri, response_uri_len,
+               MNGR_HTTPD_RESPONSE_BAD_REQUEST, "Request body too large");
+    return ERR_ARG;
+  }
+  uint32_t now = to_ms_since_boot(get_absolute_time());
+  post_reclaim_stale(now);
+  post_slot_t *slot = post_slot_find(NULL);
+  char *body = slot != NULL ? arena_alloc((size_t)content_len + 1) : NULL;
+  if (body == NULL) {
+    post_reply(response_uri, response_uri_len,
+               MNGR_HTTPD_RESPONSE_INTERNAL_SERVER_ERROR, "Server busy");
+    return ERR_MEM;
+  }
+  arena_hold();
+  slot->connection = connection;
+  slot->started_ms = now;
+  slot->len = 0;
+  slot->capacity = (u16_t)content_len;
+  slot->overflow = false;
+  slot->body = body;
+  slot->apply = apply;
+  return ERR_OK;
+}
+
+/**
+ * @brief Appends a chunk of the body to the slot of the connection.
+ */
+err_t httpd_post_receive_data(void *connection, struct pbuf *p) {
+  post_slot_t *slot = post_slot_find(connection);
+  err_t err = ERR_OK;
+  if (slot == NULL) {
+    err = ERR_ARG;
+  } else if (slot->len + p->tot_len > slot->capacity) {
+    // More than Content-Length announced
+    slot->overflow = true;
+    err = ERR_BUF;
+  } else {
+    slot->len += pbuf_copy_partial(p, slot->body + slot->len, p->tot_len, 0);
+  }
+  pbuf_free(p);
+  return err;
+}
+
+/**
+ * @brief Applies the complete body and answers with the response page.
+ */
+void httpd_post_finished(void *connection, char *response_uri,
+                         u16_t response_uri_len) {
+  post_slot_t *slot = post_slot_find(connection);
+  if (slot == NULL) {
+    post_reply(response_uri, response_uri_len,
+               MNGR_HTTPD_RESPONSE_INTERNAL_SERVER_ERROR,
+               "Request timed out");
+    return;
+  }
+  if (slot->overflow) {
+    post_reply(response_uri, response_uri_len,
+               MNGR_HTTPD_RESPONSE_BAD_REQUEST, "Request body too large");
+  } else {
+    slot->body[slot->len] = '\0';
+    DPRINTF("POST body: %s\n", slot->body);
+    snprintf(response_uri, response_uri_len, "%s", slot->apply(slot->body));
+  }
+  slot->connection = NULL;
+  arena_release();
+}
+
 const char *cgi_btlist(int iIndex, int iNumParams, char *pcParam[],
                        char *pcValue[]) {
   (void)iIndex;
@@ -533,6 +676,13 @@ const char *cgi_btclean(int iIndex, int iNumParams, char *pcParam[],
   (void)pcParam;
   (void)pcValue;
   btloop_clear_pairings();
+  int err = gconfig_flush();
+  if (err != 0) {
+    response_status = MNGR_HTTPD_RESPONSE_INTERNAL_SERVER_ERROR;
+    snprintf(httpd_response_message, sizeof(httpd_response_message),
+             "Unable to save the cleared pairings (%d)", err);
+    return "/response.shtml";
+  }
   response_status = MNGR_HTTPD_RESPONSE_OK;
   snprintf(httpd_response_message, sizeof(httpd_response_message),
            "Bluetooth pairings cleared");
@@ -593,7 +743,14 @@ const char *cgi_btunpair(int iIndex, int iNumParams, char *pcParam[],
   }
 
   settings_put_string(gconfig_getContext(), param_key, "");
-  settings_save(gconfig_getContext(), true);
+  gconfig_commit();
+  int err = gconfig_flush();
+  if (err != 0) {
+    response_status = MNGR_HTTPD_RESPONSE_INTERNAL_SERVER_ERROR;
+    snprintf(httpd_response_message, sizeof(httpd_response_message),
+             "Unable to save the cleared %s pairing (%d)", label, err);
+    return "/response.shtml";
+  }
 
   response_status = MNGR_HTTPD_RESPONSE_OK;
   snprintf(httpd_response_message, sizeof(httpd_response_message),
@@ -601,6 +758,275 @@ const char *cgi_btunpair(int iIndex, int iNumParams, char *pcParam[],
   return "/response.shtml";
 }
 
+/**
+ * @brief Returns the scanned Wi-Fi networks added or refreshed since the
+ * generation given by the client, and optionally starts a scan.
+ *
+ * Query parameters: "start=1" starts a scan, "epoch" and "since" are the
+ * values returned by the previous call. When the epoch changed (a network was
+ * dropped) the whole list is sent with "full":true. Networks are sent in
+ * generation order; if they do not fit, "more":true tells the client to ask
+ * again right away from the returned "gen".
+ */
+const char *cgi_wifiscan(int iIndex, int iNumParams, char *pcParam[],
+                         char *pcValue[]) {
+  (void)iIndex;
+  uint32_t since = 0;
+  uint32_t epoch = 0;
+  bool have_epoch = false;
+  bool start = false;
+  for (int i = 0; i < iNumParams; i++) {
+    if (strcmp(pcParam[i], "since") == 0) {
+      since = (uint32_t)strtoul(pcValue[i], NULL, 10);
+    } else if (strcmp(pcParam[i], "epoch") == 0) {
+      epoch = (uint32_t)strtoul(pcValue[i], NULL, 10);
+      have_epoch = true;
+    } else if (strcmp(pcParam[i], "start") == 0) {
+      start = (pcValue[i][0] == '1');
+    }
+  }
+
+  if (start) {
+    int err = network_scanStart();
+    if (err != 0) {
+      DPRINTF("Wi-Fi scan start failed via CGI: %d\n", err);
+      response_status = MNGR_HTTPD_RESPONSE_INTERNAL_SERVER_ERROR;
+      snprintf(httpd_response_message, sizeof(httpd_response_message),
+               "Unable to start the Wi-Fi scan (%d)", err);
+      return "/response.shtml";
+    }
+  }
+
+  const wifi_scan_data_t *scan = network_getFoundNetworks();
+  bool full = !have_epoch || epoch != scan->epoch;
+  if (full) {
+    since = 0;
+  }
+
+  // Networks changed since the client's generation, oldest change first
+  uint8_t order[MAX_NETWORKS];
+  size_t changed = 0;
+  for (uint8_t i = 0; i < scan->count; i++) {
+    if (scan->networks[i].generation <= since) {
+      continue;
+    }
+    size_t pos = changed++;
+    while (pos > 0 && scan->networks[order[pos - 1]].generation >
+                          scan->networks[i].generation) {
+      order[pos] = order[pos - 1];
+      pos--;
+    }
+    order[pos] = i;
+  }
+
+  int offset = snprintf(httpd_json_payload, sizeof(httpd_json_payload),
+                        "{\"epoch\":%lu,\"full\":%s,\"scanning\":%s,"
+                        "\"networks\":[",
+                        (unsigned long)scan->epoch, full ? "true" : "false",
+                        network_scanIsActive() > 0 ? "true" : "false");
+  uint32_t gen = scan->generation;
+  bool more = false;
+  for (size_t i = 0; i < changed; i++) {
+    const wifi_network_info_t *network = &scan->networks[order[i]];
+    char bssid[MAX_BSSID_LENGTH];
+    char ssid_json[NETWORK_SSID_MAX_LEN * 6 + 1];
+    char entry[sizeof(ssid_json) + 96];
+    network_formatBssid(network->bssid, bssid);
+    json_escape(scan->ssids[network->ssid].name, ssid_json,
+                sizeof(ssid_json));
+    int written = snprintf(
+        entry, sizeof(entry),
+        "%s{\"bssid\":\"%s\",\"ssid\":\"%s\",\"rssi\":%d,\"ch\":%u,"
+        "\"auth\":%u}",
+        (i > 0) ? "," : "", bssid, ssid_json, network->rssi,
+        network->channel, network->auth_mode);
+    if (written < 0 ||
+        offset + written + WIFI_SCAN_JSON_TAIL >
+            (int)sizeof(httpd_json_payload)) {
+      // The rest goes in the next call
+      gen = (i > 0) ? scan->networks[order[i - 1]].generation : since;
+      more = true;
+      break;
+    }
+    memcpy(httpd_json_payload + offset, entry, (size_t)written + 1);
+    offset += written;
+  }
+  snprintf(httpd_json_payload + offset,
+           sizeof(httpd_json_payload) - (size_t)offset,
+           "],\"gen\":%lu,\"more\":%s}", (unsigned long)gen,
+           more ? "true" : "false");
+
+  response_status = MNGR_HTTPD_RESPONSE_OK;
+  httpd_response_message[0] = '\0';
+  return "/json.shtml";
+}
+
+// Edit of the known networks, read from the POST body of /wifinets.cgi
+typedef struct {
+  const char *op;
+  const char *ssid;
+  const char *pass;
+  int auth;
+  int index;
+} wifinets_edit_t;
+
+static bool wifinets_param(const char *name, const char *type,
+                           const char *value, void *user_data) {
+  (void)type;
+  wifinets_edit_t *edit = (wifinets_edit_t *)user_data;
+  if (strcmp(name, "op") == 0) {
+    edit->op = value;
+  } else if (strcmp(name, "ssid") == 0) {
+    edit->ssid = value;
+  } else if (strcmp(name, "pass") == 0) {
+    edit->pass = value;
+  } else if (strcmp(name, "auth") == 0) {
+    edit->auth = atoi(value);
+  } else if (strcmp(name, "i") == 0) {
+    edit->index = atoi(value);
+  }
+  return true;
+}
+
+/**
+ * @brief Applies an edit (if any) to the known networks and answers with
+ * the resulting list. Passwords are never sent back, only whether a network
+ * has one.
+ *
+ * @param edit The edit, or NULL to only return the list.
+ * @return The response page.
+ */
+static const char *wifinets_answer(const wifinets_edit_t *edit) {
+  // The list does not outlive this call. The hold keeps the arena from being
+  // emptied under it, and gives the memory back at once when no response is
+  // in flight
+  arena_hold();
+  network_known_t *list =
+      arena_alloc(NETWORK_KNOWN_MAX * sizeof(network_known_t));
+  if (list == NULL) {
+    arena_release();
+    response_status = MNGR_HTTPD_RESPONSE_INTERNAL_SERVER_ERROR;
+    snprintf(httpd_response_message, sizeof(httpd_response_message),
+             "Server busy");
+    return "/response.shtml";
+  }
+  size_t count = network_knownGet(list, NETWORK_KNOWN_MAX);
+  const char *op = edit != NULL ? edit->op : NULL;
+  const char *error = NULL;
+  if (edit == NULL) {
+    // Only the list
+  } else if (op == NULL) {
+    error = "Invalid operation";
+  } else if (strcmp(op, "add") == 0) {
+    network_known_t known = {0};
+    if (edit->ssid == NULL || strlen(edit->ssid) >= sizeof(known.ssid) ||
+        strlen(edit->pass) >= sizeof(known.password)) {
+      error = "Invalid SSID or password";
+    } else {
+      strcpy(known.ssid, edit->ssid);
+      strcpy(known.password, edit->pass);
+      known.auth = (uint8_t)edit->auth;
+      size_t pos = 0;
+      while (pos < count && strcmp(list[pos].ssid, known.ssid) != 0) {
+        pos++;
+      }
+      if (pos == NETWORK_KNOWN_MAX) {
+        error = "The list of known networks is full";
+      } else {
+        list[pos] = known;
+        count = pos == count ? count + 1 : count;
+      }
+    }
+  } else if ((strcmp(op, "del") == 0 || strcmp(op, "up") == 0) &&
+             edit->index >= 0 && (size_t)edit->index < count) {
+    size_t index = (size_t)edit->index;
+    if (op[0] == 'd') {
+      memmove(&list[index], &list[index + 1],
+              (count - index - 1) * sizeof(list[0]));
+      count--;
+    } else if (index > 0) {
+      network_known_t swap = list[index - 1];
+      list[index - 1] = list[index];
+      list[index] = swap;
+    }
+  } else {
+    error = "Invalid operation";
+  }
+  if (error == NULL && edit != NULL && !network_knownSet(list, count)) {
+    error = "Invalid SSID or password";
+  }
+  if (error != NULL) {
+    arena_release();
+    response_status = MNGR_HTTPD_RESPONSE_BAD_REQUEST;
+    snprintf(httpd_response_message, sizeof(httpd_response_message), "%s",
+             error);
+    return "/response.shtml";
+  }
+
+  // Without control characters (rejected by network_knownSet()) the escaped
+  // list always fits the payload
+  int offset = snprintf(httpd_json_payload, sizeof(httpd_json_payload),
+                        "{\"networks\":[");
+  for (size_t i = 0; i < count; i++) {
+    char ssid_json[NETWORK_SSID_MAX_LEN * 2 + 1];
+    json_escape(list[i].ssid, ssid_json, sizeof(ssid_json));
+    offset += snprintf(httpd_json_payload + offset,
+                       sizeof(httpd_json_payload) - (size_t)offset,
+                       "%s{\"ssid\":\"%s\",\"haspass\":%s,\"auth\":%u}",
+                       (i > 0) ? "," : "", ssid_json,
+                       list[i].password[0] != '\0' ? "true" : "false",
+                       list[i].auth);
+  }
+  snprintf(httpd_json_payload + offset,
+           sizeof(httpd_json_payload) - (size_t)offset, "]}");
+  arena_release();
+
+  response_status = MNGR_HTTPD_RESPONSE_OK;
+  httpd_response_message[0] = '\0';
+  return "/json.shtml";
+}
+
+/**
+ * @brief Applies the POST body of /wifinets.cgi: a JSON array of
+ * {"name","type","value"} parameters, as for /saveparams.cgi.
+ *
+ * "op" is "add" (with "ssid", "pass" and "auth"; replaces the network with
+ * the same SSID), "del" or "up" (with "i", the index of the network). The
+ * answer is the resulting list. The list is written to flash from the main
+ * loop.
+ *
+ * @param json The null terminated JSON document, modified.
+ * @return The response page.
+ */
+static const char *apply_wifinets_json(char *json) {
+  wifinets_edit_t edit = {NULL, NULL, "", 0, -1};
+  mngr_json_status_t status = mngr_json_parse_params(json, NULL, NULL);
+  if (status == MNGR_JSON_OK) {
+    status = mngr_json_parse_params(json, wifinets_param, &edit);
+  }
+  if (status != MNGR_JSON_OK) {
+    response_status = MNGR_HTTPD_RESPONSE_BAD_REQUEST;
+    snprintf(httpd_response_message, sizeof(httpd_response_message),
+             "Error parsing JSON");
+    return "/response.shtml";
+  }
+  return wifinets_answer(&edit);
+}
+
+/**
+ * @brief Returns the networks known to the STA mode besides WIFI_SSID. The
+ * list is edited with a POST to the same URL, which keeps the passwords out
+ * of the query string.
+ */
+const char *cgi_wifinets(int iIndex, int iNumParams, char *pcParam[],
+                         char *pcValue[]) {
+  (void)iIndex;
+  (void)iNumParams;
+  (void)pcParam;
+  (void)pcValue;
+  return wifinets_answer(NULL);
+}
+
 /**
  * @brief Array of CGI handlers for floppy select and eject operations.
  *
@@ -609,13 +1035,14 @@ const char *cgi_btunpair(int iIndex, int iNumParams, char *pcParam[],
  * and drive B.
  */
 static const tCGI cgi_handlers[] = {{"/test.cgi", cgi_test},
-                                    {"/saveparams.cgi", cgi_saveparams},
                                     {"/btlist.cgi", cgi_btlist},
                                     {"/btstart.cgi", cgi_btstart},
                                     {"/btstop.cgi", cgi_btstop},
                                     {"/btpairings.cgi", cgi_btpairings},
                                     {"/btclean.cgi", cgi_btclean},
-                                    {"/btunpair.cgi", cgi_btunpair}};
+                                    {"/btunpair.cgi", cgi_btunpair},
+                                    {"/wifiscan.cgi", cgi_wifiscan},
+                                    {"/wifinets.cgi", cgi_wifinets}};
 /**
  * @brief Initializes the HTTP server with optional SSI tags, CGI handlers, and
  * an SSI handler function.
@@ -697,8 +1124,7 @@ static u16_t ssi_handler(int iIndex, char *pcInsert, int iInsertLen
       break;
     case 1: /* "SSID" */
     {
-      char *ssid =
-          settings_find_entry(gconfig_getContext(), PARAM_WIFI_SSID)->value;
+      const char *ssid = gconfig_get_str(GCONFIG_ID_WIFI_SSID);
       if (ssid != NULL) {
         printed = snprintf(pcInsert, iInsertLen, "%s", ssid);
       } else {
@@ -780,49 +1206,37 @@ static u16_t ssi_handler(int iIndex, char *pcInsert, int iInsertLen
     }
     case 7: /* MODE */
     {
-      SettingsConfigEntry *ikbd_mode_param =
-          settings_find_entry(gconfig_getContext(), PARAM_MODE);
-      int ikbd_mode = atoi(ikbd_mode_param->value);
-      printed = snprintf(pcInsert, iInsertLen, "%i", ikbd_mode);
+      printed = snprintf(pcInsert, iInsertLen, "%i",
+                         gconfig_get_int(GCONFIG_ID_MODE));
       break;
     }
     case 8: /* JUSB */
     {
-      SettingsConfigEntry *entry =
-          settings_find_entry(gconfig_getContext(), PARAM_JOYSTICK_USB);
-      const char *val = (entry && entry->value) ? entry->value : "false";
+      const char *val = gconfig_get_str(GCONFIG_ID_JOYSTICK_USB);
       printed = snprintf(pcInsert, iInsertLen, "%s", val);
       break;
     }
     case 9: /* JPORT */
     {
-      SettingsConfigEntry *entry =
-          settings_find_entry(gconfig_getContext(), PARAM_JOYSTICK_USB_PORT);
-      const char *val = (entry && entry->value) ? entry->value : "1";
+      const char *val = gconfig_get_str(GCONFIG_ID_JOYSTICK_USB_PORT);
       printed = snprintf(pcInsert, iInsertLen, "%s", val);
       break;
     }
     case 10: /* MORIG */
     {
-      SettingsConfigEntry *entry =
-          settings_find_entry(gconfig_getContext(), PARAM_MOUSE_ORIGINAL);
-      const char *val = (entry && entry->value) ? entry->value : "false";
+      const char *val = gconfig_get_str(GCONFIG_ID_MOUSE_ORIGINAL);
       printed = snprintf(pcInsert, iInsertLen, "%s", val);
       break;
     }
     case 11: /* MSPEED */
     {
-      SettingsConfigEntry *entry =
-          settings_find_entry(gconfig_getContext(), PARAM_MOUSE_SPEED);
-      const char *val = (entry && entry->value) ? entry->value : "5";
+      const char *val = gconfig_get_str(GCONFIG_ID_MOUSE_SPEED);
       printed = snprintf(pcInsert, iInsertLen, "%s", val);
       break;
     }
     case 12: /* KBLANG */
     {
-      SettingsConfigEntry *entry =
-          settings_find_entry(gconfig_getContext(), PARAM_USB_KB_LAYOUT);
-      const char *val = (entry && entry->value) ? entry->value : "en";
+      const char *val = gconfig_get_str(GCONFIG_ID_USB_KB_LAYOUT);
       char lower_buf[8];
       to_lowercase_copy(val, lower_buf, sizeof(lower_buf));
       printed = snprintf(pcInsert, iInsertLen, "%s", lower_buf);
@@ -830,9 +1244,7 @@ static u16_t ssi_handler(int iIndex, char *pcInsert, int iInsertLen
     }
     case 13: /* BTKBL */
     {
-      SettingsConfigEntry *entry =
-          settings_find_entry(gconfig_getContext(), PARAM_BT_KB_LAYOUT);
-      const char *val = (entry && entry->value) ? entry->value : "en";
+      const char *val = gconfig_get_str(GCONFIG_ID_BT_KB_LAYOUT);
       char lower_buf[8];
       to_lowercase_copy(val, lower_buf, sizeof(lower_buf));
       printed = snprintf(pcInsert, iInsertLen, "%s", lower_buf);
@@ -843,57 +1255,43 @@ static u16_t ssi_handler(int iIndex, char *pcInsert, int iInsertLen
       break;
     case 15: /* BTGSHT */
     {
-      SettingsConfigEntry *entry =
-          settings_find_entry(gconfig_getContext(), PARAM_BT_GAMEPADSHOOT);
-      const char *val = (entry && entry->value) ? entry->value : "0";
+      const char *val = gconfig_get_str(GCONFIG_ID_BT_GAMEPADSHOOT);
       printed = snprintf(pcInsert, iInsertLen, "%s", val);
       break;
     }
     case 16: /* JASHT */
     {
-      SettingsConfigEntry *entry =
-          settings_find_entry(gconfig_getContext(), PARAM_JOYSTICK_USB_AUTOSHOOT);
-      const char *val = (entry && entry->value) ? entry->value : "0";
+      const char *val = gconfig_get_str(GCONFIG_ID_JOYSTICK_USB_AUTOSHOOT);
       printed = snprintf(pcInsert, iInsertLen, "%s", val);
       break;
     }
     case 17: /* WFIMODE */
     {
-      SettingsConfigEntry *entry =
-          settings_find_entry(gconfig_getContext(), PARAM_WIFI_MODE);
-      const char *val = (entry && entry->value) ? entry->value : "0";
+      const char *val = gconfig_get_str(GCONFIG_ID_WIFI_MODE);
       printed = snprintf(pcInsert, iInsertLen, "%s", val);
       break;
     }
     case 18: /* WFIHOST */
     {
-      SettingsConfigEntry *entry =
-          settings_find_entry(gconfig_getContext(), PARAM_HOSTNAME);
-      const char *val = (entry && entry->value) ? entry->value : "croissant";
+      const char *val = gconfig_get_str(GCONFIG_ID_HOSTNAME);
       printed = snprintf(pcInsert, iInsertLen, "%s", val);
       break;
     }
     case 19: /* WFISSID */
     {
-      SettingsConfigEntry *entry =
-          settings_find_entry(gconfig_getContext(), PARAM_WIFI_SSID);
-      const char *val = (entry && entry->value) ? entry->value : "";
+      const char *val = gconfig_get_str(GCONFIG_ID_WIFI_SSID);
       printed = snprintf(pcInsert, iInsertLen, "%s", val);
       break;
     }
     case 20: /* WFIPASS */
     {
-      SettingsConfigEntry *entry =
-          settings_find_entry(gconfig_getContext(), PARAM_WIFI_PASSWORD);
-      const char *val = (entry && entry->value) ? entry->value : "";
+      const char *val = gconfig_get_str(GCONFIG_ID_WIFI_PASSWORD);
       printed = snprintf(pcInsert, iInsertLen, "%s", val);
       break;
     }
     case 21: /* WFIAUTH */
     {
-      SettingsConfigEntry *entry =
-          settings_find_entry(gconfig_getContext(), PARAM_WIFI_AUTH);
-      const char *val = (entry && entry->value) ? entry->value : "0";
+      const char *val = gconfig_get_str(GCONFIG_ID_WIFI_AUTH);
       printed = snprintf(pcInsert, iInsertLen, "%s", val);
       break;
     }
@@ -912,6 +1310,40 @@ static u16_t ssi_handler(int iIndex, char *pcInsert, int iInsertLen
       printed = snprintf(pcInsert, iInsertLen, "%d", WIFI_AP_AUTH);
       break;
     }
+    case 25: /* WFISTA */
+    {
+      if (network_wifiStaState() == NETWORK_STA_CONNECTED) {
+        ip_addr_t ipaddr = network_getCurrentIp();
+        printed = snprintf(pcInsert, iInsertLen, "%s (%s)",
+                           network_wifiStaStateString(), ip4addr_ntoa(&ipaddr));
+      } else {
+        printed = snprintf(pcInsert, iInsertLen, "%s",
+                           network_wifiStaStateString());
+      }
+      break;
+    }
+    case 26: /* WFIAPCH */
+    {
+      const char *val = gconfig_get_str(GCONFIG_ID_WIFI_AP_CHANNEL);
+      printed = snprintf(pcInsert, iInsertLen, "%s", val);
+      break;
+    }
+    case 27: /* WFICHAN */
+    {
+      uint32_t channel = network_getApChannel();
+      if (channel != 0) {
+        printed = snprintf(pcInsert, iInsertLen, "%lu", (unsigned long)channel);
+      } else {
+        printed = snprintf(pcInsert, iInsertLen, "-");
+      }
+      break;
+    }
+    case 28: /* WFISTIP */
+    {
+      const char *val = gconfig_get_str(GCONFIG_ID_WIFI_STATIC_IP);
+      printed = snprintf(pcInsert, iInsertLen, "%s", val);
+      break;
+    }
     default: /* unknown tag */
       printed = 0;
       break;
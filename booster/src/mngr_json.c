@@ -0,0 +1,367 @@
+/**
+ * File: mngr_json.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Streaming reader of the settings JSON sent by the web UI
+ */
+
+#include "mngr_json.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef struct {
+  char *pos;    // Next character to read
+  bool decode;  // Unescape and terminate the strings in place
+} json_reader_t;
+
+// A string as read: its characters, unescaped only when decoding
+typedef struct {
+  char *start;
+  size_t len;
+} json_span_t;
+
+static void skip_ws(json_reader_t *r) {
+  while (*r->pos == ' ' || *r->pos == '\t' || *r->pos == '\n' ||
+         *r->pos == '\r') {
+    r->pos++;
+  }
+}
+
+static int hex_value(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+// Reads the 4 hex digits of a \u escape
+static bool read_hex4(const char *src, uint32_t *out) {
+  uint32_t value = 0;
+  for (int i = 0; i < 4; i++) {
+    int digit = hex_value(src[i]);
+    if (digit < 0) {
+      return false;
+    }
+    value = (value << 4) | (uint32_t)digit;
+  }
+  *out = value;
+  return true;
+}
+
+// Writes a code point as UTF-8. Never longer than its \u escape(s)
+static size_t put_utf8(char *dst, uint32_t cp) {
+  if (cp < 0x80) {
+    dst[0] = (char)cp;
+    return 1;
+  }
+  if (cp < 0x800) {
+    dst[0] = (char)(0xC0 | (cp >> 6));
+    dst[1] = (char)(0x80 | (cp & 0x3F));
+    return 2;
+  }
+  if (cp < 0x10000) {
+    dst[0] = (char)(0xE0 | (cp >> 12));
+    dst[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    dst[2] = (char)(0x80 | (cp & 0x3F));
+    return 3;
+  }
+  dst[0] = (char)(0xF0 | (cp >> 18));
+  dst[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+  dst[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+  dst[3] = (char)(0x80 | (cp & 0x3F));
+  return 4;
+}
+
+/**
+ * @brief Reads a string starting at its opening quote. When decoding, the
+ * unescaped string is written over the escaped one and null terminated
+ * (possibly on the closing quote, already consumed).
+ */
+static bool read_string(json_reader_t *r, json_span_t *out) {
+  if (*r->pos != '"') {
+    return false;
+  }
+  char *src = ++r->pos;
+  char *dst = src;
+  out->start = src;
+  while (*src != '"') {
+    unsigned char c = (unsigned char)*src;
+    if (c < 0x20) {
+      return false;  // Also the end of the document
+    }
+    if (c != '\\') {
+      if (r->decode) {
+        *dst = (char)c;
+      }
+      dst++;
+      src++;
+      continue;
+    }
+    char decoded;
+    switch (src[1]) {
+      case '"':
+      case '\\':
+      case '/':
+        decoded = src[1];
+        break;
+      case 'b':
+        decoded = '\b';
+        break;
+      case 'f':
+        decoded = '\f';
+        break;
+      case 'n':
+        decoded = '\n';
+        break;
+      case 'r':
+        decoded = '\r';
+        break;
+      case 't':
+        decoded = '\t';
+        break;
+      case 'u': {
+        uint32_t cp;
+        if (!read_hex4(src + 2, &cp)) {
+          return false;
+        }
+        src += 6;
+        if (cp >= 0xDC00 && cp <= 0xDFFF) {
+          return false;  // Lone low surrogate
+        }
+        if (cp >= 0xD800 && cp <= 0xDBFF) {
+          uint32_t low;
+          if (src[0] != '\\' || src[1] != 'u' || !read_hex4(src + 2, &low) ||
+              low < 0xDC00 || low > 0xDFFF) {
+            return false;
+          }
+          src += 6;
+          cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+        }
+        if (r->decode) {
+          dst += put_utf8(dst, cp);
+        } else {
+          dst += cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+        }
+        continue;
+      }
+      default:
+        return false;
+    }
+    if (r->decode) {
+      *dst = decoded;
+    }
+    dst++;
+    src += 2;
+  }
+  out->len = (size_t)(dst - out->start);
+  r->pos = src + 1;
+  if (r->decode) {
+    *dst = '\0';
+  }
+  return true;
+}
+
+static bool read_number(json_reader_t *r) {
+  char *p = r->pos;
+  if (*p == '-') {
+    p++;
+  }
+  if (*p < '0' || *p > '9') {
+    return false;
+  }
+  while (*p >= '0' && *p <= '9') {
+    p++;
+  }
+  if (*p == '.') {
+    p++;
+    if (*p < '0' || *p > '9') {
+      return false;
+    }
+    while (*p >= '0' && *p <= '9') {
+      p++;
+    }
+  }
+  if (*p == 'e' || *p == 'E') {
+    p++;
+    if (*p == '+' || *p == '-') {
+      p++;
+    }
+    if (*p < '0' || *p > '9') {
+      return false;
+    }
+    while (*p >= '0' && *p <= '9') {
+      p++;
+    }
+  }
+  r->pos = p;
+  return true;
+}
+
+static bool read_literal(json_reader_t *r, const char *literal) {
+  size_t len = strlen(literal);
+  if (strncmp(r->pos, literal, len) != 0) {
+    return false;
+  }
+  r->pos += len;
+  return true;
+}
+
+// Skips any value, checking its syntax
+static bool skip_value(json_reader_t *r, int depth) {
+  if (depth > MNGR_JSON_MAX_DEPTH) {
+    return false;
+  }
+  json_span_t span;
+  switch (*r->pos) {
+    case '"':
+      return read_string(r, &span);
+    case 't':
+      return read_literal(r, "true");
+    case 'f':
+      return read_literal(r, "false");
+    case 'n':
+      return read_literal(r, "null");
+    case '[':
+    case '{': {
+      bool object = *r->pos == '{';
+      char close = object ? '}' : ']';
+      r->pos++;
+      skip_ws(r);
+      if (*r->pos == close) {
+        r->pos++;
+        return true;
+      }
+      while (true) {
+        if (object) {
+          if (!read_string(r, &span)) {
+            return false;
+          }
+          skip_ws(r);
+          if (*r->pos++ != ':') {
+            return false;
+          }
+          skip_ws(r);
+        }
+        if (!skip_value(r, depth + 1)) {
+          return false;
+        }
+        skip_ws(r);
+        if (*r->pos == ',') {
+          r->pos++;
+          skip_ws(r);
+        } else if (*r->pos == close) {
+          r->pos++;
+          return true;
+        } else {
+          return false;
+        }
+      }
+    }
+    default:
+      return read_number(r);
+  }
+}
+
+static bool span_equals(const json_span_t *span, const char *str) {
+  return span->len == strlen(str) && memcmp(span->start, str, span->len) == 0;
+}
+
+// Reads one {"name","type","value"} object and passes it to the callback
+static mngr_json_status_t read_param(json_reader_t *r, mngr_json_param_cb_t cb,
+                                     void *user_data) {
+  if (*r->pos != '{') {
+    return skip_value(r, 1) ? MNGR_JSON_ERR_STRUCTURE : MNGR_JSON_ERR_SYNTAX;
+  }
+  r->pos++;
+  json_span_t name = {0};
+  json_span_t type = {0};
+  json_span_t value = {0};
+  skip_ws(r);
+  if (*r->pos == '}') {
+    return MNGR_JSON_ERR_STRUCTURE;
+  }
+  while (true) {
+    json_span_t key;
+    if (!read_string(r, &key)) {
+      return MNGR_JSON_ERR_SYNTAX;
+    }
+    skip_ws(r);
+    if (*r->pos++ != ':') {
+      return MNGR_JSON_ERR_SYNTAX;
+    }
+    skip_ws(r);
+    json_span_t *member = span_equals(&key, "name")    ? &name
+                          : span_equals(&key, "type")  ? &type
+                          : span_equals(&key, "value") ? &value
+                                                       : NULL;
+    if (member != NULL && *r->pos == '"') {
+      if (!read_string(r, member)) {
+        return MNGR_JSON_ERR_SYNTAX;
+      }
+    } else if (member != NULL) {
+      return skip_value(r, 1) ? MNGR_JSON_ERR_STRUCTURE : MNGR_JSON_ERR_SYNTAX;
+    } else if (!skip_value(r, 1)) {
+      return MNGR_JSON_ERR_SYNTAX;
+    }
+    skip_ws(r);
+    if (*r->pos == ',') {
+      r->pos++;
+      skip_ws(r);
+    } else if (*r->pos == '}') {
+      r->pos++;
+      break;
+    } else {
+      return MNGR_JSON_ERR_SYNTAX;
+    }
+  }
+  if (name.start == NULL || type.start == NULL || value.start == NULL) {
+    return MNGR_JSON_ERR_STRUCTURE;
+  }
+  if (cb != NULL && !cb(name.start, type.start, value.start, user_data)) {
+    return MNGR_JSON_ERR_CALLBACK;
+  }
+  return MNGR_JSON_OK;
+}
+
+mngr_json_status_t mngr_json_parse_params(char *json, mngr_json_param_cb_t cb,
+                                          void *user_data) {
+  json_reader_t reader = {.pos = json, .decode = cb != NULL};
+  json_reader_t *r = &reader;
+  skip_ws(r);
+  if (*r->pos != '[') {
+    return skip_value(r, 0) ? MNGR_JSON_ERR_STRUCTURE : MNGR_JSON_ERR_SYNTAX;
+  }
+  r->pos++;
+  skip_ws(r);
+  if (*r->pos == ']') {
+    r->pos++;
+  } else {
+    while (true) {
+      mngr_json_status_t status = read_param(r, cb, user_data);
+      if (status != MNGR_JSON_OK) {
+        return status;
+      }
+      skip_ws(r);
+      if (*r->pos == ',') {
+        r->pos++;
+        skip_ws(r);
+      } else if (*r->pos == ']') {
+        r->pos++;
+        break;
+      } else {
+        return MNGR_JSON_ERR_SYNTAX;
+      }
+    }
+  }
+  skip_ws(r);
+  return *r->pos == '\0' ? MNGR_JSON_OK : MNGR_JSON_ERR_SYNTAX;
+}
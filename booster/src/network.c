@@ -2,10 +2,18 @@
 
 static bool cyw43Initialized = false;
 static wifi_mode_t wifiCurrentMode = WIFI_MODE_STA;
-static wifi_network_info_t wifiNetworkInfo = {0};
 static wifi_scan_data_t wifiScanData = {0};
+// Index in wifiScanData.networks of every BSSID found, by BSSID hash
+static uint8_t wifiScanBssidSet[NETWORK_SCAN_HASH_SLOTS];
+static bool wifiScanStoreReady = false;
 static bool wifiScanInProgress = false;
+static uint32_t wifiScanLastMs = 0;
+// The set of networks changed since the snapshot was saved
+static bool wifiScanSnapshotDirty = false;
+static bool wifiScanSnapshotSaved = false;
+static uint32_t wifiScanSnapshotMs = 0;
 static char wifiHostname[NETWORK_MAX_STRING_LENGTH];
+static char wifiApHostname[NETWORK_MAX_STRING_LENGTH];
 static ip_addr_t currentIp = {0};
 static uint8_t cyw43Mac[NETWORK_MAC_SIZE];
 static wifi_sta_conn_status_t connectionStatus = DISCONNECTED;
@@ -17,6 +25,9 @@ static bool mdnsResponderInitialized = false;
 // Static variable to store the callback function
 static NetworkPollingCallback networkPollingCallback = NULL;
 
+static int network_scanResultCallback(void *env,
+                                      const cyw43_ev_scan_result_t *result);
+
 #if LWIP_MDNS_RESPONDER
 static void srv_txt(struct mdns_service *service, void *txt_userdata);
 static void network_setupMdns(struct netif *netif, const char *hostname,
@@ -261,19 +272,331 @@ static bool network_parseBssid(const char *value, uint8_t outBssid[NETWORK_MAC_S
   return true;
 }
 
-static bool network_findCachedSsidByBssid(const char *bssid, char *outSsid,
-                                          size_t outSsidSize) {
+void network_formatBssid(const uint8_t bssid[NETWORK_MAC_SIZE],
+                         char outBssidStr[MAX_BSSID_LENGTH]) {
+  snprintf(outBssidStr, MAX_BSSID_LENGTH, "%02x:%02x:%02x:%02x:%02x:%02x",
+           bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5]);
+}
+
+_Static_assert(NETWORK_SCAN_MAX_SSIDS >= MAX_NETWORKS,
+               "Every stored BSSID must be able to intern its SSID");
+_Static_assert(NETWORK_SCAN_HASH_SLOTS > MAX_NETWORKS &&
+                   (NETWORK_SCAN_HASH_SLOTS & (NETWORK_SCAN_HASH_SLOTS - 1)) == 0,
+               "The BSSID set must be a power of two with free slots");
+
+// Flash snapshot of the scan results: a header followed by the records
+typedef struct {
+  uint32_t magic;  // NETWORK_SCAN_SNAPSHOT_MAGIC
+  uint16_t count;  // Number of records
+  uint16_t reserved;
+  uint32_t check;  // FNV-1a of the records
+} network_scan_snapshot_header_t;
+
+typedef struct {
+  uint8_t bssid[NETWORK_MAC_SIZE];
+  uint8_t channel;
+  uint8_t authMode;
+  int8_t rssi;
+  uint8_t ssidLen;
+  uint8_t ssid[NETWORK_SSID_MAX_LEN];
+} network_scan_snapshot_record_t;
+
+_Static_assert(sizeof(network_scan_snapshot_header_t) +
+                       MAX_NETWORKS * sizeof(network_scan_snapshot_record_t) <=
+                   FLASH_SECTOR_SIZE,
+               "The scan snapshot must fit in a flash sector");
+
+static uint32_t network_fnv1a(const void *data, size_t size) {
+  const uint8_t *bytes = (const uint8_t *)data;
+  uint32_t hash = SETTINGS_FNV1A_OFFSET_BASIS;
+  for (size_t i = 0; i < size; i++) {
+    hash = (hash ^ bytes[i]) * SETTINGS_FNV1A_PRIME;
+  }
+  return hash;
+}
+
+static uint32_t network_scanSnapshotCheck(
+    const network_scan_snapshot_record_t *records, uint16_t count) {
+  return network_fnv1a(records,
+                       count * sizeof(network_scan_snapshot_record_t));
+}
+
+/**
+ * @brief Fills the empty scan store from the flash snapshot, if there is a
+ * valid one. The restored networks age from boot like fresh results.
+ */
+static void network_scanLoadSnapshot(void) {
+  uint32_t offset;
+  if (gconfig_app_sector_offset(NETWORK_SCAN_SNAPSHOT_UUID, false, &offset) !=
+      GCONFIG_SUCCESS) {
+    return;
+  }
+  const network_scan_snapshot_header_t *header =
+      (const network_scan_snapshot_header_t *)(XIP_BASE + offset);
+  const network_scan_snapshot_record_t *records =
+      (const network_scan_snapshot_record_t *)(header + 1);
+  if (header->magic != NETWORK_SCAN_SNAPSHOT_MAGIC ||
+      header->count > MAX_NETWORKS ||
+      header->check != network_scanSnapshotCheck(records, header->count)) {
+    DPRINTF("No valid scan snapshot in FLASH.\n");
+    return;
+  }
+  for (uint16_t i = 0; i < header->count; i++) {
+    cyw43_ev_scan_result_t result = {0};
+    memcpy(result.bssid, records[i].bssid, NETWORK_MAC_SIZE);
+    result.ssid_len = records[i].ssidLen < NETWORK_SSID_MAX_LEN
+                          ? records[i].ssidLen
+                          : NETWORK_SSID_MAX_LEN;
+    memcpy(result.ssid, records[i].ssid, result.ssid_len);
+    result.channel = records[i].channel;
+    result.auth_mode = records[i].authMode;
+    result.rssi = records[i].rssi;
+    network_scanResultCallback(NULL, &result);
+  }
+  wifiScanSnapshotDirty = false;
+  wifiScanSnapshotSaved = true;
+  DPRINTF("Restored %u networks from the scan snapshot.\n", header->count);
+}
+
+static void network_scanStoreInit(void) {
+  if (wifiScanStoreReady) {
+    return;
+  }
+  memset(wifiScanBssidSet, NETWORK_SCAN_HASH_EMPTY, sizeof(wifiScanBssidSet));
+  for (size_t i = 0; i < NETWORK_SCAN_MAX_SSIDS; i++) {
+    wifiScanData.ssids[i].first = NETWORK_SCAN_NONE;
+  }
+  wifiScanData.count = 0;
+  wifiScanStoreReady = true;
+  network_scanLoadSnapshot();
+}
+
+// First slot to probe for a BSSID. The low bytes are the NIC specific part
+// and spread best; the OUI is folded in for vendors sharing a suffix.
+static size_t network_bssidHashSlot(const uint8_t bssid[NETWORK_MAC_SIZE]) {
+  uint32_t key = ((uint32_t)bssid[2] << 24) | ((uint32_t)bssid[3] << 16) |
+                 ((uint32_t)bssid[4] << 8) | bssid[5];
+  key ^= ((uint32_t)bssid[0] << 8) | bssid[1];
+  // Knuth multiplicative hash
+  return ((key * 2654435761u) >> 16) & (NETWORK_SCAN_HASH_SLOTS - 1);
+}
+
+// Slot holding the BSSID, or the empty slot where it belongs. The set is
+// never full, so the probe always ends.
+static size_t network_scanSetProbe(const uint8_t bssid[NETWORK_MAC_SIZE]) {
+  size_t slot = network_bssidHashSlot(bssid);
+  while (wifiScanBssidSet[slot] != NETWORK_SCAN_HASH_EMPTY &&
+         memcmp(wifiScanData.networks[wifiScanBssidSet[slot]].bssid, bssid,
+                NETWORK_MAC_SIZE) != 0) {
+    slot = (slot + 1) & (NETWORK_SCAN_HASH_SLOTS - 1);
+  }
+  return slot;
+}
+
+/**
+ * @brief Finds a BSSID in the scan results through the hash set.
+ *
+ * @param bssid Raw BSSID to look up.
+ * @return int Index of the network in wifiScanData, or -1 if not found.
+ */
+static int network_scanFindBssid(const uint8_t bssid[NETWORK_MAC_SIZE]) {
+  network_scanStoreInit();
+  uint8_t index = wifiScanBssidSet[network_scanSetProbe(bssid)];
+  return index == NETWORK_SCAN_HASH_EMPTY ? -1 : index;
+}
+
+static void network_scanSetAdd(uint8_t index) {
+  wifiScanBssidSet[network_scanSetProbe(wifiScanData.networks[index].bssid)] =
+      index;
+}
+
+// Linear probing removal with backward shift: entries after the hole move
+// back into it when the hole is on their probe path, so no tombstones.
+static void network_scanSetRemove(uint8_t index) {
+  size_t hole = network_scanSetProbe(wifiScanData.networks[index].bssid);
+  if (wifiScanBssidSet[hole] == NETWORK_SCAN_HASH_EMPTY) {
+    return;
+  }
+  wifiScanBssidSet[hole] = NETWORK_SCAN_HASH_EMPTY;
+  size_t slot = hole;
+  for (;;) {
+    slot = (slot + 1) & (NETWORK_SCAN_HASH_SLOTS - 1);
+    uint8_t moved = wifiScanBssidSet[slot];
+    if (moved == NETWORK_SCAN_HASH_EMPTY) {
+      break;
+    }
+    size_t home = network_bssidHashSlot(wifiScanData.networks[moved].bssid);
+    if (((slot - home) & (NETWORK_SCAN_HASH_SLOTS - 1)) >=
+        ((slot - hole) & (NETWORK_SCAN_HASH_SLOTS - 1))) {
+      wifiScanBssidSet[hole] = moved;
+      wifiScanBssidSet[slot] = NETWORK_SCAN_HASH_EMPTY;
+      hole = slot;
+    }
+  }
+}
+
+// Index of the stored SSID, stored now if new. -1 if the table is full.
+static int network_scanInternSsid(const uint8_t *ssid, size_t ssidLen) {
+  int freeIndex = -1;
+  for (size_t i = 0; i < NETWORK_SCAN_MAX_SSIDS; i++) {
+    wifi_ssid_info_t *entry = &wifiScanData.ssids[i];
+    if (entry->first == NETWORK_SCAN_NONE) {
+      if (freeIndex < 0) {
+        freeIndex = (int)i;
+      }
+    } else if (memcmp(entry->name, ssid, ssidLen) == 0 &&
+               entry->name[ssidLen] == '\0') {
+      return (int)i;
+    }
+  }
+  if (freeIndex >= 0) {
+    memcpy(wifiScanData.ssids[freeIndex].name, ssid, ssidLen);
+    wifiScanData.ssids[freeIndex].name[ssidLen] = '\0';
+  }
+  return freeIndex;
+}
+
+// Unchain a network from its SSID; the SSID is released with its last BSSID.
+static void network_scanSsidUnlink(uint8_t index) {
+  uint8_t *link = &wifiScanData.ssids[wifiScanData.networks[index].ssid].first;
+  while (*link != NETWORK_SCAN_NONE) {
+    if (*link == index) {
+      *link = wifiScanData.networks[index].next;
+      return;
+    }
+    link = &wifiScanData.networks[*link].next;
+  }
+}
+
+static int8_t network_scanHeapRssi(size_t pos) {
+  return wifiScanData.networks[wifiScanData.heap[pos]].rssi;
+}
+
+static void network_scanHeapSwap(size_t a, size_t b) {
+  uint8_t tmp = wifiScanData.heap[a];
+  wifiScanData.heap[a] = wifiScanData.heap[b];
+  wifiScanData.heap[b] = tmp;
+}
+
+// Restore the min-heap order around pos after its RSSI changed.
+static void network_scanHeapFix(size_t pos) {
+  while (pos > 0 &&
+         network_scanHeapRssi(pos) < network_scanHeapRssi((pos - 1) / 2)) {
+    network_scanHeapSwap(pos, (pos - 1) / 2);
+    pos = (pos - 1) / 2;
+  }
+  for (;;) {
+    size_t weakest = pos;
+    size_t left = 2 * pos + 1;
+    size_t right = left + 1;
+    if (left < wifiScanData.count &&
+        network_scanHeapRssi(left) < network_scanHeapRssi(weakest)) {
+      weakest = left;
+    }
+    if (right < wifiScanData.count &&
+        network_scanHeapRssi(right) < network_scanHeapRssi(weakest)) {
+      weakest = right;
+    }
+    if (weakest == pos) {
+      break;
+    }
+    network_scanHeapSwap(pos, weakest);
+    pos = weakest;
+  }
+}
+
+/**
+ * @brief Drops a network from the store. The last network moves into its
+ * index, so networks[0..count-1] stays dense.
+ */
+static void network_scanRemove(uint8_t index) {
+  network_scanSetRemove(index);
+  network_scanSsidUnlink(index);
+  size_t pos = 0;
+  while (wifiScanData.heap[pos] != index) {
+    pos++;
+  }
+  uint8_t last = --wifiScanData.count;
+  if (pos != last) {
+    wifiScanData.heap[pos] = wifiScanData.heap[last];
+    network_scanHeapFix(pos);
+  }
+
+  if (index != last) {
+    wifiScanBssidSet[network_scanSetProbe(wifiScanData.networks[last].bssid)] =
+        index;
+    uint8_t *link =
+        &wifiScanData.ssids[wifiScanData.networks[last].ssid].first;
+    while (*link != last) {
+      link = &wifiScanData.networks[*link].next;
+    }
+    *link = index;
+    for (pos = 0; wifiScanData.heap[pos] != last; pos++) {
+    }
+    wifiScanData.heap[pos] = index;
+    wifiScanData.networks[index] = wifiScanData.networks[last];
+  }
+  wifiScanData.epoch++;
+  wifiScanSnapshotDirty = true;
+}
+
+// Drop the networks not heard for NETWORK_SCAN_TTL_MS
+static void network_scanPrune(uint32_t now) {
+  for (int i = (int)wifiScanData.count - 1; i >= 0; i--) {
+    if (now - wifiScanData.networks[i].seen > NETWORK_SCAN_TTL_MS) {
+      network_scanRemove((uint8_t)i);
+    }
+  }
+}
+
+/**
+ * @brief Serializes the scan store as a flash snapshot, padded with 0xFF to
+ * whole pages. Returns a malloc'ed buffer, or NULL.
+ */
+static uint8_t *network_scanBuildSnapshot(uint32_t *size) {
+  *size = sizeof(network_scan_snapshot_header_t) +
+          wifiScanData.count * sizeof(network_scan_snapshot_record_t);
+  *size = (*size + FLASH_PAGE_SIZE - 1) / FLASH_PAGE_SIZE * FLASH_PAGE_SIZE;
+  uint8_t *buffer = malloc(*size);
+  if (buffer == NULL) {
+    return NULL;
+  }
+  memset(buffer, 0xFF, *size);
+  network_scan_snapshot_header_t *header =
+      (network_scan_snapshot_header_t *)buffer;
+  network_scan_snapshot_record_t *records =
+      (network_scan_snapshot_record_t *)(header + 1);
+  for (uint8_t i = 0; i < wifiScanData.count; i++) {
+    const wifi_network_info_t *network = &wifiScanData.networks[i];
+    const char *ssid = wifiScanData.ssids[network->ssid].name;
+    memset(&records[i], 0, sizeof(records[i]));
+    memcpy(records[i].bssid, network->bssid, NETWORK_MAC_SIZE);
+    records[i].channel = network->channel;
+    records[i].authMode = network->auth_mode;
+    records[i].rssi = network->rssi;
+    records[i].ssidLen = (uint8_t)strnlen(ssid, NETWORK_SSID_MAX_LEN);
+    memcpy(records[i].ssid, ssid, records[i].ssidLen);
+  }
+  header->magic = NETWORK_SCAN_SNAPSHOT_MAGIC;
+  header->count = wifiScanData.count;
+  header->reserved = 0;
+  header->check = network_scanSnapshotCheck(records, header->count);
+  return buffer;
+}
+
+static bool network_findCachedSsidByBssid(const uint8_t bssid[NETWORK_MAC_SIZE],
+                                          char *outSsid, size_t outSsidSize) {
   if (bssid == NULL || outSsid == NULL || outSsidSize == 0) {
     return false;
   }
 
-  for (size_t i = 0; i < wifiScanData.count; i++) {
-    wifi_network_info_t *network = &wifiScanData.networks[i];
-    if (strcasecmp(network->bssid, bssid) == 0 && strlen(network->ssid) > 0) {
-      strncpy(outSsid, network->ssid, outSsidSize - 1);
-      outSsid[outSsidSize - 1] = '\0';
-      return true;
-    }
+  int index = network_scanFindBssid(bssid);
+  if (index >= 0) {
+    const char *ssid =
+        wifiScanData.ssids[wifiScanData.networks[index].ssid].name;
+    strncpy(outSsid, ssid, outSsidSize - 1);
+    outSsid[outSsidSize - 1] = '\0';
+    return true;
   }
 
   outSsid[0] = '\0';
@@ -281,7 +604,7 @@ static bool network_findCachedSsidByBssid(const char *bssid, char *outSsid,
 }
 
 typedef struct {
-  char bssid[MAX_BSSID_LENGTH];
+  uint8_t bssid[NETWORK_MAC_SIZE];
   char ssid[MAX_SSID_LENGTH];
   bool found;
 } bssid_scan_lookup_ctx_t;
@@ -297,12 +620,11 @@ static int network_scanLookupBssidCallback(void *env,
     return 0;
   }
 
-  char resultBssid[MAX_BSSID_LENGTH] = {0};
-  snprintf(resultBssid, sizeof(resultBssid), "%02x:%02x:%02x:%02x:%02x:%02x",
-           result->bssid[0], result->bssid[1], result->bssid[2], result->bssid[3],
-           result->bssid[4], result->bssid[5]);
+  // The resolve scan also refreshes the found networks for the web UI
+  network_scanResultCallback(NULL, result);
 
-  if (strcasecmp(resultBssid, ctx->bssid) == 0 && strlen((const char *)result->ssid) > 0) {
+  if (memcmp(result->bssid, ctx->bssid, NETWORK_MAC_SIZE) == 0 &&
+      strlen((const char *)result->ssid) > 0) {
     strncpy(ctx->ssid, (const char *)result->ssid, sizeof(ctx->ssid) - 1);
     ctx->ssid[sizeof(ctx->ssid) - 1] = '\0';
     ctx->found = true;
@@ -310,47 +632,6 @@ static int network_scanLookupBssidCallback(void *env,
   return 0;
 }
 
-static bool network_resolveSsidByBssidScan(const char *bssid, char *outSsid,
-                                           size_t outSsidSize) {
-  if (bssid == NULL || outSsid == NULL || outSsidSize == 0) {
-    return false;
-  }
-
-  bssid_scan_lookup_ctx_t ctx = {0};
-  strncpy(ctx.bssid, bssid, sizeof(ctx.bssid) - 1);
-  ctx.bssid[sizeof(ctx.bssid) - 1] = '\0';
-
-  cyw43_wifi_scan_options_t scanOptions = {0};
-  int scanErr = cyw43_wifi_scan(&cyw43_state, &scanOptions, &ctx,
-                                network_scanLookupBssidCallback);
-  if (scanErr != 0) {
-    DPRINTF("BSSID scan start failed for %s: %d\n", bssid, scanErr);
-    return false;
-  }
-
-  absolute_time_t scanTimeout = make_timeout_time_ms(6000);
-  while (cyw43_wifi_scan_active(&cyw43_state) &&
-         absolute_time_diff_us(get_absolute_time(), scanTimeout) > 0) {
-#if PICO_CYW43_ARCH_POLL
-    network_safePoll();
-    cyw43_arch_wait_for_work_until(make_timeout_time_ms(50));
-#else
-    sleep_ms(50);
-#endif
-    if (networkPollingCallback != NULL) {
-      networkPollingCallback();
-    }
-  }
-
-  if (!ctx.found) {
-    return false;
-  }
-
-  strncpy(outSsid, ctx.ssid, outSsidSize - 1);
-  outSsid[outSsidSize - 1] = '\0';
-  return true;
-}
-
 // Setter for the callback function
 void network_setPollingCallback(NetworkPollingCallback callback) {
   networkPollingCallback = callback;
@@ -435,6 +716,124 @@ int network_initChipOnly() {
 }
 #endif
 
+#ifdef CYW43_WL_GPIO_LED_PIN
+/**
+ * @brief Picks the least congested of the non-overlapping channels 1, 6 and
+ * 11 for the AP.
+ *
+ * Runs a scan with the regular scan machinery (bringing the STA interface up
+ * for it if needed), then scores every candidate with the networks heard on
+ * it or on an overlapping channel: the stronger and the closer, the higher
+ * the cost. If the scan cannot run, the stored results are scored instead.
+ *
+ * @return uint32_t The chosen channel, or 0 (driver default) if no network
+ * is known.
+ */
+static uint32_t network_surveyApChannel(void) {
+  bool staUp = (cyw43_state.itf_state & (1 << CYW43_ITF_STA)) != 0;
+  if (!staUp) {
+    cyw43_arch_enable_sta_mode();
+  }
+  if (network_scanStart() == 0) {
+    absolute_time_t deadline =
+        make_timeout_time_ms(NETWORK_AP_SURVEY_TIMEOUT_MS);
+    while (network_scanIsActive() > 0 && !time_reached(deadline)) {
+      network_safePoll();
+      sleep_ms(10);
+    }
+  }
+  if (!staUp) {
+    cyw43_arch_disable_sta_mode();
+  }
+
+  static const uint32_t candidates[] = {1, 6, 11};
+  uint32_t best = 0;
+  uint32_t bestCost = UINT32_MAX;
+  cyw43_arch_lwip_begin();
+  network_scanStoreInit();
+  if (wifiScanData.count > 0) {
+    for (size_t c = 0; c < sizeof(candidates) / sizeof(candidates[0]); c++) {
+      uint32_t cost = 0;
+      for (uint8_t i = 0; i < wifiScanData.count; i++) {
+        const wifi_network_info_t *network = &wifiScanData.networks[i];
+        int distance = abs((int)network->channel - (int)candidates[c]);
+        // 20 MHz channels overlap up to 4 channels apart
+        if (distance < 5) {
+          int level = network->rssi + 100;
+          cost += (uint32_t)(level > 1 ? level : 1) * (uint32_t)(5 - distance);
+        }
+      }
+      DPRINTF("AP channel %lu congestion: %lu\n", (unsigned long)candidates[c],
+              (unsigned long)cost);
+      if (cost < bestCost) {
+        bestCost = cost;
+        best = candidates[c];
+      }
+    }
+  }
+  cyw43_arch_lwip_end();
+  return best;
+}
+
+// Channel for the AP from WIFI_AP_CHANNEL, 0 for the driver default
+static uint32_t network_selectApChannel(void) {
+  int setting = gconfig_get_int(GCONFIG_ID_WIFI_AP_CHANNEL);
+  if (setting == NETWORK_AP_CHANNEL_AUTO) {
+    return network_surveyApChannel();
+  }
+  if (setting >= 1 && setting <= NETWORK_AP_CHANNEL_MAX) {
+    return (uint32_t)setting;
+  }
+  return 0;
+}
+
+/**
+ * @brief Brings up the AP interface with its static address, the DHCP
+ * server and mDNS.
+ *
+ * @param ssid AP SSID.
+ * @param password AP password.
+ * @param auth CYW43 auth type.
+ * @param mdnsName mDNS host name of the AP interface.
+ */
+static void network_enableAp(const char *ssid, const char *password,
+                             uint32_t auth, const char *mdnsName) {
+  uint32_t channel = network_selectApChannel();
+  if (channel != 0) {
+    DPRINTF("AP channel: %lu\n", (unsigned long)channel);
+    cyw43_wifi_ap_set_channel(&cyw43_state, channel);
+  }
+  DPRINTF("Auth mode: %08x\n", auth);
+  cyw43_arch_enable_ap_mode(ssid, password, auth);
+
+  // Set static IP address for the AP
+  struct netif *netif = &cyw43_state.netif[CYW43_ITF_AP];
+  ip4_addr_t netmask;
+  ip4_addr_t gateway;
+  ip4addr_aton(WIFI_AP_NETMASK, &netmask);
+  ip4addr_aton(WIFI_AP_GATEWAY, &gateway);
+
+  DPRINTF("GW IP: %s\n", ip4addr_ntoa(&gateway));
+  DPRINTF("Mask IP: %s\n", ip4addr_ntoa(&netmask));
+
+#ifdef MICROPY_INCLUDED_LIB_NETUTILS_DHCPSERVER_H
+  // Start the dhcp server
+  dhcp_server_init(&gateway, &netmask);
+  DPRINTF("DHCP server started.\n");
+#endif
+
+#if LWIP_MDNS_RESPONDER
+  // Set hostname for AP interface and start mDNS
+  strncpy(wifiApHostname, mdnsName, sizeof(wifiApHostname) - 1);
+  netif_set_hostname(netif, wifiApHostname);
+  network_setupMdns(netif, wifiApHostname, "croissant_httpd");
+#else
+  (void)mdnsName;
+  (void)netif;
+#endif
+}
+#endif
+
 /**
  * @brief Initialize the WiFi network with the specified mode.
  *
@@ -442,8 +841,8 @@ int network_initChipOnly() {
  * power management settings. It supports both STA (Station) and AP (Access
  * Point) modes.
  *
- * @param mode The WiFi mode to initialize. It can be either WIFI_MODE_STA or
- * WIFI_MODE_AP.
+ * @param mode The WiFi mode to initialize: WIFI_MODE_STA, WIFI_MODE_AP or
+ * WIFI_MODE_AP_STA (the default AP plus the STA).
  * @return int Returns 0 on success, or -1 on failure.
  */
 #ifdef CYW43_WL_GPIO_LED_PIN
@@ -478,11 +877,22 @@ int network_wifiInit(wifi_mode_t mode) {
   }
   DPRINTF("Country: %s\n", countryEntry->value);
 
-  // Start STA or AP mode
-  if (mode == WIFI_MODE_STA) {
+  // Start STA, AP or both
+  if (mode == WIFI_MODE_STA || mode == WIFI_MODE_AP_STA) {
     DPRINTF("Enabling STA mode...\n");
     cyw43_arch_enable_sta_mode();
     wifiCurrentMode = WIFI_MODE_STA;
+    if (mode == WIFI_MODE_AP_STA) {
+      // The configuration AP comes up with its defaults right away; the STA
+      // credentials are left for the join running in the background.
+      char ssidStr[MAX_SSID_LENGTH] = {0};
+      snprintf(ssidStr, sizeof(ssidStr), "%s-%s", WIFI_AP_SSID,
+               picoSerialStr());
+      DPRINTF("Enabling AP mode too. SSID: %s\n", ssidStr);
+      network_enableAp(ssidStr, WIFI_AP_PASS, getAuthPicoCode(WIFI_AP_AUTH),
+                       WIFI_AP_HOSTNAME);
+      wifiCurrentMode = WIFI_MODE_AP_STA;
+    }
   } else {
     DPRINTF("Enabling AP mode...\n");
     DPRINTF("Read the SSID, password and auth mode\n");
@@ -523,48 +933,20 @@ int network_wifiInit(wifi_mode_t mode) {
     }
     DPRINTF("Password: %s\n", passwordStr);
 
-    SettingsConfigEntry *authEntry =
-        settings_find_entry(gconfig_getContext(), PARAM_WIFI_AUTH);
-    int authInt =
-        (authEntry != NULL && authEntry->value != NULL) ? atoi(authEntry->value)
-                                                        : 0;
+    int authInt = gconfig_get_int(GCONFIG_ID_WIFI_AUTH);
     if (authInt == 0) {
       authInt = WIFI_AP_AUTH;  // WPA2_AES_PSK
       settings_put_integer(gconfig_getContext(), PARAM_WIFI_AUTH, WIFI_AP_AUTH);
       apSettingsUpdated = true;
     }
 
-    DPRINTF("Auth mode: %08x\n", getAuthPicoCode(authInt));
-    cyw43_arch_enable_ap_mode(ssidStr, passwordStr, getAuthPicoCode(authInt));
-
-    // Set static IP address for the AP
-    struct netif *netif = &cyw43_state.netif[CYW43_ITF_AP];
-    ip4_addr_t netmask;
-    ip4_addr_t gateway;
-    ip4addr_aton(WIFI_AP_NETMASK, &netmask);
-    ip4addr_aton(WIFI_AP_GATEWAY, &gateway);
-
-    DPRINTF("GW IP: %s\n", ip4addr_ntoa(&gateway));
-    DPRINTF("Mask IP: %s\n", ip4addr_ntoa(&netmask));
-
-#ifdef MICROPY_INCLUDED_LIB_NETUTILS_DHCPSERVER_H
-    // Start the dhcp server
-    dhcp_server_init(&gateway, &netmask);
-    DPRINTF("DHCP server started.\n");
-#endif
-
-#if LWIP_MDNS_RESPONDER
-    // Set hostname for AP interface and start mDNS
-    const char *mdns_name = hostname_is_croissant ? WIFI_AP_HOSTNAME : ssidStr;
-    strncpy(wifiHostname, mdns_name, sizeof(wifiHostname));
-    netif_set_hostname(netif, wifiHostname);
-    network_setupMdns(netif, wifiHostname, "croissant_httpd");
-#endif
+    network_enableAp(ssidStr, passwordStr, getAuthPicoCode(authInt),
+                     hostname_is_croissant ? WIFI_AP_HOSTNAME : ssidStr);
 
     wifiCurrentMode = WIFI_MODE_AP;
 
     if (apSettingsUpdated) {
-      settings_save(gconfig_getContext(), true);
+      gconfig_commit();
       DPRINTF("AP defaults stored in settings.\n");
     }
   }
@@ -577,6 +959,12 @@ int network_wifiInit(wifi_mode_t mode) {
 }
 #endif
 
+bool network_staEnabled(void) {
+  return wifiCurrentMode == WIFI_MODE_STA || wifiCurrentMode == WIFI_MODE_AP_STA;
+}
+
+wifi_mode_t network_getWifiMode(void) { return wifiCurrentMode; }
+
 /**
  * @brief Safely polls the network if the CYW43 module is initialized.
  *
@@ -591,12 +979,87 @@ void network_safePoll() {
   }
 }
 
+/**
+ * @brief Scan callback: keeps the MAX_NETWORKS strongest BSSIDs.
+ *
+ * Runs for every beacon and probe response while the scan is active, so it
+ * only probes the BSSID hash set, updates the RSSI min-heap and copies the
+ * raw result. When the store is full, a new BSSID replaces the weakest one if
+ * it is stronger. BSSIDs are formatted as text when results are serialized.
+ */
+static int network_scanResultCallback(void *env,
+                                      const cyw43_ev_scan_result_t *result) {
+  (void)env;
+  if (result == NULL || result->ssid_len == 0) {
+    return 0;
+  }
+  size_t ssidLen = result->ssid_len < NETWORK_SSID_MAX_LEN
+                       ? result->ssid_len
+                       : NETWORK_SSID_MAX_LEN;
+  int8_t rssi = result->rssi < INT8_MIN ? INT8_MIN : (int8_t)result->rssi;
+
+  int found = network_scanFindBssid(result->bssid);
+  if (found >= 0) {
+    // Already stored: refresh the reading and its rank
+    wifiScanData.networks[found].rssi = rssi;
+    wifiScanData.networks[found].channel = (uint8_t)result->channel;
+    wifiScanData.networks[found].generation = ++wifiScanData.generation;
+    wifiScanData.networks[found].seen = to_ms_since_boot(get_absolute_time());
+    for (size_t pos = 0; pos < wifiScanData.count; pos++) {
+      if (wifiScanData.heap[pos] == found) {
+        network_scanHeapFix(pos);
+        break;
+      }
+    }
+    return 0;
+  }
+
+  uint8_t index;
+  size_t pos;
+  if (wifiScanData.count < MAX_NETWORKS) {
+    index = wifiScanData.count;
+    pos = wifiScanData.count;
+    wifiScanData.heap[pos] = index;
+    wifiScanData.count++;
+  } else {
+    // Full: the weakest network at the heap root makes room if weaker
+    index = wifiScanData.heap[0];
+    pos = 0;
+    if (rssi <= wifiScanData.networks[index].rssi) {
+      return 0;
+    }
+    network_scanSetRemove(index);
+    network_scanSsidUnlink(index);
+    wifiScanData.epoch++;
+  }
+
+  // Never fails: there are never more SSIDs in use than stored networks
+  int ssid = network_scanInternSsid(result->ssid, ssidLen);
+  wifi_network_info_t *network = &wifiScanData.networks[index];
+  memcpy(network->bssid, result->bssid, NETWORK_MAC_SIZE);
+  network->ssid = (uint8_t)ssid;
+  network->next = wifiScanData.ssids[ssid].first;
+  wifiScanData.ssids[ssid].first = index;
+  network->auth_mode = (uint8_t)result->auth_mode;
+  network->channel = (uint8_t)result->channel;
+  network->rssi = rssi;
+  network->generation = ++wifiScanData.generation;
+  network->seen = to_ms_since_boot(get_absolute_time());
+  network_scanSetAdd(index);
+  wifiScanSnapshotDirty = true;
+  network_scanHeapFix(pos);
+  DPRINTF("FOUND NETWORK %s with auth %d and RSSI %d\n",
+          wifiScanData.ssids[ssid].name, network->auth_mode, network->rssi);
+  return 0;
+}
+
 /**
  * @brief Scans for available Wi-Fi networks and stores the results.
  *
  * This function initiates a Wi-Fi network scan if the network is initialized
  * and the scan interval has elapsed. It processes the scan results and stores
- * unique networks in the global `wifi_scan_data` structure.
+ * the strongest unique networks (by raw BSSID) in the global `wifi_scan_data`
+ * structure.
  *
  * @param wifi_scan_time Pointer to the absolute time of the last scan.
  * @param wifi_scan_interval Interval between scans in seconds.
@@ -607,57 +1070,12 @@ int network_scan(absolute_time_t *wifiScanTime, int wifiScanInterval) {
     // If the network is not initialized, we cancel the scan
     return -1;
   }
-  int scan_result(void *env, const cyw43_ev_scan_result_t *result) {
-    // Check if the BSSID already exists in the found networks
-    bool bssid_exists(wifi_network_info_t * network) {
-      for (size_t i = 0; i < wifiScanData.count; i++) {
-        if (strcmp(wifiScanData.networks[i].bssid, network->bssid) == 0) {
-          return true;  // BSSID found
-        }
-      }
-      return false;  // BSSID not found
-    }
-    if (result && wifiScanData.count < MAX_NETWORKS) {
-      wifi_network_info_t network;
-
-      // Copy SSID
-      snprintf(network.ssid, sizeof(network.ssid), "%s", result->ssid);
-
-      // Format BSSID
-      snprintf(network.bssid, sizeof(network.bssid),
-               "%02x:%02x:%02x:%02x:%02x:%02x", result->bssid[0],
-               result->bssid[1], result->bssid[2], result->bssid[3],
-               result->bssid[4], result->bssid[5]);
-
-      // Store authentication mode
-      network.auth_mode = result->auth_mode;
-
-      // Store signal strength
-      network.rssi = result->rssi;
-
-      // Check if BSSID already exists
-      if (!bssid_exists(&network)) {
-        if (strlen(network.ssid) > 0) {
-          wifiScanData.networks[wifiScanData.count] = network;
-          wifiScanData.count++;
-          DPRINTF("FOUND NETWORK %s (%s) with auth %d and RSSI %d\n",
-                  network.ssid, network.bssid, network.auth_mode, network.rssi);
-        }
-      }
-    }
-    return 0;
-  }
   // DPRINTF("Time diff: %lld\n", absolute_time_diff_us(get_absolute_time(),
   // (absolute_time_t)*wifi_scan_time));
   if (absolute_time_diff_us(get_absolute_time(), *wifiScanTime) < 0) {
     if (!wifiScanInProgress) {
-      DPRINTF("Scanning networks...\n");
-      cyw43_wifi_scan_options_t scanOptions = {0};
-      int err = cyw43_wifi_scan(&cyw43_state, &scanOptions, NULL, scan_result);
-      if (err == 0) {
-        DPRINTF("Performing wifi scan\n");
-        wifiScanInProgress = true;
-      } else {
+      int err = network_scanStart();
+      if (err != 0) {
         DPRINTF("Failed to start scan: %d\n", err);
         *wifiScanTime = make_timeout_time_ms(wifiScanInterval * SEC_TO_MS);
       }
@@ -672,6 +1090,27 @@ int network_scan(absolute_time_t *wifiScanTime, int wifiScanInterval) {
   // else {
   //     DPRINTF("Scan already in progress\n");
   // }
+  return 0;
+}
+
+int network_scanStart(void) {
+  if (!cyw43Initialized) {
+    return -1;
+  }
+  if (cyw43_wifi_scan_active(&cyw43_state)) {
+    return 0;
+  }
+  DPRINTF("Scanning networks...\n");
+  network_scanStoreInit();
+  cyw43_wifi_scan_options_t scanOptions = {0};
+  int err = cyw43_wifi_scan(&cyw43_state, &scanOptions, NULL,
+                            network_scanResultCallback);
+  if (err == 0) {
+    DPRINTF("Performing wifi scan\n");
+    wifiScanInProgress = true;
+    wifiScanLastMs = to_ms_since_boot(get_absolute_time());
+  }
+  return err;
 }
 
 int network_scanIsActive() {
@@ -691,7 +1130,59 @@ int network_scanIsActive() {
  *
  * @return wifi_scan_data_t* Pointer to the list of found Wi-Fi networks.
  */
-wifi_scan_data_t *network_getFoundNetworks() { return &wifiScanData; }
+wifi_scan_data_t *network_getFoundNetworks() {
+  network_scanStoreInit();
+  return &wifiScanData;
+}
+
+void network_scanPoll(void) {
+  if (!cyw43Initialized) {
+    return;
+  }
+  uint32_t now = to_ms_since_boot(get_absolute_time());
+  network_sta_state_t staState = network_wifiStaState();
+  bool idle = staState == NETWORK_STA_IDLE ||
+              staState == NETWORK_STA_CONNECTED ||
+              staState == NETWORK_STA_FAILED;
+  uint8_t *snapshot = NULL;
+  uint32_t snapshotSize = 0;
+
+  // The scan callbacks and the httpd run in the background context
+  cyw43_arch_lwip_begin();
+  network_scanStoreInit();
+  if (idle && !cyw43_wifi_scan_active(&cyw43_state)) {
+    network_scanPrune(now);
+    if (wifiScanSnapshotDirty &&
+        (!wifiScanSnapshotSaved ||
+         now - wifiScanSnapshotMs >= NETWORK_SCAN_SNAPSHOT_INTERVAL_MS)) {
+      snapshot = network_scanBuildSnapshot(&snapshotSize);
+      wifiScanSnapshotDirty = false;
+      wifiScanSnapshotSaved = true;
+      wifiScanSnapshotMs = now;
+    }
+    if (now - wifiScanLastMs >= NETWORK_SCAN_REFRESH_MS) {
+      // Also throttles the retries if the scan cannot start
+      wifiScanLastMs = now;
+      DPRINTF("Background scan refresh.\n");
+      network_scanStart();
+    }
+  }
+  cyw43_arch_lwip_end();
+
+  // Written outside the lwIP lock, and chunked by gconfig_write_app_sector():
+  // interrupts are masked for one erase or one 256-byte page at a time, so
+  // the CYW43 driver and the httpd keep running during the save
+  if (snapshot != NULL) {
+    uint32_t offset;
+    int err = gconfig_app_sector_offset(NETWORK_SCAN_SNAPSHOT_UUID, true,
+                                        &offset);
+    if (err == GCONFIG_SUCCESS) {
+      err = gconfig_write_app_sector(offset, snapshot, snapshotSize);
+    }
+    free(snapshot);
+    DPRINTF("Scan snapshot saved: %d\n", err);
+  }
+}
 
 static void wifiLinkCallback(struct netif *netif) {
   DPRINTF("WiFi Link: %s\n", (netif_is_link_up(netif) ? "UP" : "DOWN"));
@@ -770,27 +1261,715 @@ static void network_setupMdns(struct netif *netif, const char *hostname,
 }
 #endif
 
-wifi_sta_conn_process_status_t network_wifiStaConnect() {
+/**
+ * @brief Reads the last successful join from the WIFI_JOIN parameter,
+ * "bssid,channel,auth,lease,ssid". The format without the DHCP lease written
+ * by older firmware is still accepted.
+ *
+ * The cache is only valid for the network configured now: the same SSID, or
+ * the same BSSID if the SSID parameter holds a BSSID.
+ *
+ * @return true if there is a valid cache for configuredSsid.
+ */
+static bool network_loadJoinCache(const char *configuredSsid,
+                                  network_join_cache_t *cache) {
+  // A save by the httpd (background context) can free the string
+  char value[SETTINGS_MAX_VALUE_LENGTH];
+  cyw43_arch_lwip_begin();
+  strncpy(value, gconfig_get_str(GCONFIG_ID_WIFI_JOIN), sizeof(value) - 1);
+  cyw43_arch_lwip_end();
+  value[sizeof(value) - 1] = '\0';
+  if (strlen(value) == 0) {
+    return false;
+  }
+  char bssidStr[MAX_BSSID_LENGTH] = {0};
+  char normalizedBssid[MAX_BSSID_LENGTH];
+  unsigned int channel = 0;
+  unsigned long auth = 0;
+  char leaseStr[16] = {0};
+  int ssidStart = 0;
+  if (sscanf(value, "%17[0-9a-fA-F:],%u,%lx,%15[0-9.],%n", bssidStr, &channel,
+             &auth, leaseStr, &ssidStart) != 4 ||
+      ssidStart == 0) {
+    leaseStr[0] = '\0';
+    ssidStart = 0;
+    sscanf(value, "%17[0-9a-fA-F:],%u,%lx,%n", bssidStr, &channel, &auth,
+           &ssidStart);
+  }
+  if (ssidStart == 0 || channel == 0 ||
+      !network_parseBssid(bssidStr, cache->bssid, normalizedBssid)) {
+    DPRINTF("Ignoring malformed %s: %s\n", PARAM_WIFI_JOIN, value);
+    return false;
+  }
+  strncpy(cache->ssid, value + ssidStart, sizeof(cache->ssid) - 1);
+  cache->ssid[sizeof(cache->ssid) - 1] = '\0';
+  if (strlen(cache->ssid) == 0) {
+    return false;
+  }
+  cache->channel = channel;
+  cache->auth = (uint32_t)auth;
+  ip4_addr_t lease;
+  cache->lease =
+      ip4addr_aton(leaseStr, &lease) ? ip4_addr_get_u32(&lease) : 0;
+
+  uint8_t configuredBssid[NETWORK_MAC_SIZE];
+  char configuredBssidStr[MAX_BSSID_LENGTH];
+  if (network_parseBssid(configuredSsid, configuredBssid, configuredBssidStr)) {
+    return memcmp(configuredBssid, cache->bssid, NETWORK_MAC_SIZE) == 0;
+  }
+  return strcmp(configuredSsid, cache->ssid) == 0;
+}
+
+/**
+ * @brief Stores the BSSID, channel and DHCP lease of the current STA join in
+ * WIFI_JOIN.
+ *
+ * Only commits (write-behind) when the cached join changed, so a normal
+ * rejoin does not touch the flash.
+ */
+static void network_saveJoinCache(const char *ssid, uint32_t auth) {
+  uint8_t bssid[NETWORK_MAC_SIZE] = {0};
+  if (cyw43_wifi_get_bssid(&cyw43_state, bssid) != 0) {
+    DPRINTF("Can't read the BSSID of the join. Not cached\n");
+    return;
+  }
+
+  // The channel info is { hw_channel, target_channel, scan_channel }
+  uint32_t channelInfo[3] = {0};
+  uint32_t channel = 0;
+  if (cyw43_ioctl(&cyw43_state, CYW43_IOCTL_GET_CHANNEL, sizeof(channelInfo),
+                  (uint8_t *)channelInfo, CYW43_ITF_STA) == 0) {
+    channel = channelInfo[0];
+  }
+  if (channel == 0) {
+    int index = network_scanFindBssid(bssid);
+    if (index >= 0) {
+      channel = wifiScanData.networks[index].channel;
+    }
+  }
+  if (channel == 0) {
+    DPRINTF("Can't read the channel of the join. Not cached\n");
+    return;
+  }
+
+  // A static address is not a lease: 0.0.0.0 keeps the field parseable
+  struct netif *nif = &cyw43_state.netif[CYW43_ITF_STA];
+  ip4_addr_t lease;
+  ip4_addr_set_u32(&lease, dhcp_supplied_address(nif)
+                               ? ip4_addr_get_u32(netif_ip_addr4(nif))
+                               : 0);
+  char leaseStr[16];
+  strncpy(leaseStr, ip4addr_ntoa(&lease), sizeof(leaseStr) - 1);
+  leaseStr[sizeof(leaseStr) - 1] = '\0';
+
+  char bssidStr[MAX_BSSID_LENGTH];
+  network_formatBssid(bssid, bssidStr);
+  char value[SETTINGS_MAX_VALUE_LENGTH];
+  snprintf(value, sizeof(value), "%s,%lu,%lx,%s,%s", bssidStr,
+           (unsigned long)channel, (unsigned long)auth, leaseStr, ssid);
+  // The httpd changes and saves the settings in the background context
+  cyw43_arch_lwip_begin();
+  if (strcmp(value, gconfig_get_str(GCONFIG_ID_WIFI_JOIN)) != 0) {
+    DPRINTF("Caching join %s\n", value);
+    settings_put_string(gconfig_getContext(), PARAM_WIFI_JOIN, value);
+    gconfig_commit();
+  }
+  cyw43_arch_lwip_end();
+}
+
+/**
+ * @brief Applies the WIFI_STATIC_IP parameter, "ip,netmask,gateway[,dns]",
+ * to the STA interface instead of DHCP. Must run with the lwIP lock held.
+ *
+ * @return true if a static address is configured and valid.
+ */
+static bool network_applyStaticIp(struct netif *nif) {
+  const char *value = gconfig_get_str(GCONFIG_ID_WIFI_STATIC_IP);
+  if (value == NULL || strlen(value) == 0) {
+    return false;
+  }
+  char buffer[SETTINGS_MAX_VALUE_LENGTH];
+  strncpy(buffer, value, sizeof(buffer) - 1);
+  buffer[sizeof(buffer) - 1] = '\0';
+
+  ip4_addr_t addrs[4];  // ip, netmask, gateway, dns
+  int count = 0;
+  char *save = NULL;
+  for (char *token = strtok_r(buffer, ",", &save); token != NULL && count < 4;
+       token = strtok_r(NULL, ",", &save)) {
+    if (!ip4addr_aton(token, &addrs[count])) {
+      break;
+    }
+    count++;
+  }
+  if (count < 3 || ip4_addr_get_u32(&addrs[0]) == 0) {
+    DPRINTF("Ignoring malformed %s: %s. Using DHCP\n", PARAM_WIFI_STATIC_IP,
+            value);
+    return false;
+  }
+
+  dhcp_stop(nif);
+  netif_set_addr(nif, &addrs[0], &addrs[1], &addrs[2]);
+  if (count == 4) {
+    ip_addr_t dns;
+    ip_addr_copy_from_ip4(dns, addrs[3]);
+    dns_setserver(0, &dns);
+  }
+  DPRINTF("Static IP address: %s\n", ip4addr_ntoa(&addrs[0]));
+  return true;
+}
+
+/**
+ * @brief Primes the DHCP client with the lease of the last join, so the
+ * first message once the link is up is an INIT-REBOOT REQUEST for that
+ * address instead of a DISCOVER. The server ACKs it (saving the DISCOVER and
+ * OFFER round trip) or NAKs it, and the client falls back to a DISCOVER.
+ * Must run with the lwIP lock held, before the link is up.
+ *
+ * lwIP has no API for this: it writes the private state and offered_ip_addr
+ * fields of struct dhcp, and relies on lwIP 2.1/2.2 behaviour. dhcp_start()
+ * on a link that is down leaves the client in DHCP_STATE_INIT, and when the
+ * link comes up dhcp_network_changed() calls dhcp_reboot() for a client in
+ * DHCP_STATE_REBOOTING, which requests offered_ip_addr. Check both again
+ * before moving to another lwIP release.
+ */
+_Static_assert(LWIP_VERSION_MAJOR == 2 && LWIP_VERSION_MINOR >= 1 &&
+                   LWIP_VERSION_MINOR <= 2,
+               "network_requestLastLease() relies on lwIP 2.1/2.2 DHCP "
+               "internals");
+static void network_requestLastLease(struct netif *nif, uint32_t lease) {
+  struct dhcp *dhcp = netif_dhcp_data(nif);
+  if (lease == 0 || dhcp == NULL || dhcp->state != DHCP_STATE_INIT ||
+      netif_is_link_up(nif)) {
+    return;
+  }
+  ip4_addr_set_u32(&dhcp->offered_ip_addr, lease);
+  dhcp->state = DHCP_STATE_REBOOTING;
+  DPRINTF("Requesting the last DHCP lease %s\n",
+          ip4addr_ntoa(&dhcp->offered_ip_addr));
+}
+
+// Known networks in order of preference, loaded from flash on first use
+static network_known_t knownNetworks[NETWORK_KNOWN_MAX];
+static uint8_t knownCount = 0;
+static bool knownLoaded = false;
+static bool knownDirty = false;
+
+// Flash image of the known networks: the header, then per network the auth
+// code, the SSID length, the SSID, the password length and the password
+typedef struct {
+  uint32_t magic;  // NETWORK_KNOWN_MAGIC
+  uint16_t count;  // Number of networks
+  uint16_t size;   // Bytes of records after the header
+  uint32_t check;  // FNV-1a of the records
+} network_known_header_t;
+
+#define NETWORK_KNOWN_RECORD_MAX \
+  (3 + NETWORK_SSID_MAX_LEN + MAX_PASSWORD_LENGTH - 1)
+
+_Static_assert(sizeof(network_known_header_t) +
+                       NETWORK_KNOWN_MAX * NETWORK_KNOWN_RECORD_MAX <=
+                   FLASH_SECTOR_SIZE,
+               "The known networks must fit in a flash sector");
+
+static void network_knownLoad(void) {
+  if (knownLoaded) {
+    return;
+  }
+  knownLoaded = true;
+  knownCount = 0;
+  uint32_t offset;
+  if (gconfig_app_sector_offset(NETWORK_KNOWN_UUID, false, &offset) !=
+      GCONFIG_SUCCESS) {
+    return;
+  }
+  const network_known_header_t *header =
+      (const network_known_header_t *)(XIP_BASE + offset);
+  const uint8_t *records = (const uint8_t *)(header + 1);
+  if (header->magic != NETWORK_KNOWN_MAGIC ||
+      header->count > NETWORK_KNOWN_MAX ||
+      header->size > NETWORK_KNOWN_MAX * NETWORK_KNOWN_RECORD_MAX ||
+      header->check != network_fnv1a(records, header->size)) {
+    DPRINTF("No valid known networks in FLASH.\n");
+    return;
+  }
+  size_t pos = 0;
+  while (knownCount < header->count && pos + 2 <= header->size) {
+    network_known_t *known = &knownNetworks[knownCount];
+    memset(known, 0, sizeof(*known));
+    known->auth = records[pos++];
+    uint8_t ssidLen = records[pos++];
+    if (ssidLen > NETWORK_SSID_MAX_LEN || pos + ssidLen + 1 > header->size) {
+      break;
+    }
+    memcpy(known->ssid, &records[pos], ssidLen);
+    pos += ssidLen;
+    uint8_t passwordLen = records[pos++];
+    if (passwordLen >= MAX_PASSWORD_LENGTH ||
+        pos + passwordLen > header->size) {
+      break;
+    }
+    memcpy(known->password, &records[pos], passwordLen);
+    pos += passwordLen;
+    knownCount++;
+  }
+  DPRINTF("Loaded %u known networks.\n", knownCount);
+}
+
+/**
+ * @brief Serializes the known networks as a flash image, padded with 0xFF to
+ * whole pages. Returns a malloc'ed buffer, or NULL.
+ */
+static uint8_t *network_knownBuildImage(uint32_t *size) {
+  *size = sizeof(network_known_header_t) +
+          knownCount * NETWORK_KNOWN_RECORD_MAX;
+  *size = (*size + FLASH_PAGE_SIZE - 1) / FLASH_PAGE_SIZE * FLASH_PAGE_SIZE;
+  uint8_t *buffer = malloc(*size);
+  if (buffer == NULL) {
+    return NULL;
+  }
+  memset(buffer, 0xFF, *size);
+  network_known_header_t *header = (network_known_header_t *)buffer;
+  uint8_t *records = (uint8_t *)(header + 1);
+  size_t pos = 0;
+  for (uint8_t i = 0; i < knownCount; i++) {
+    const network_known_t *known = &knownNetworks[i];
+    size_t ssidLen = strnlen(known->ssid, NETWORK_SSID_MAX_LEN);
+    size_t passwordLen = strnlen(known->password, MAX_PASSWORD_LENGTH - 1);
+    records[pos++] = known->auth;
+    records[pos++] = (uint8_t)ssidLen;
+    memcpy(&records[pos], known->ssid, ssidLen);
+    pos += ssidLen;
+    records[pos++] = (uint8_t)passwordLen;
+    memcpy(&records[pos], known->password, passwordLen);
+    pos += passwordLen;
+  }
+  header->magic = NETWORK_KNOWN_MAGIC;
+  header->count = knownCount;
+  header->size = (uint16_t)pos;
+  header->check = network_fnv1a(records, pos);
+  return buffer;
+}
+
+size_t network_knownGet(network_known_t *out, size_t max) {
+  network_knownLoad();
+  size_t count = knownCount < max ? knownCount : max;
+  memcpy(out, knownNetworks, count * sizeof(network_known_t));
+  return count;
+}
+
+static bool network_hasControlChars(const char *str) {
+  for (; *str != '\0'; str++) {
+    if ((unsigned char)*str < 0x20) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool network_knownSet(const network_known_t *list, size_t count) {
+  if (count > NETWORK_KNOWN_MAX) {
+    return false;
+  }
+  for (size_t i = 0; i < count; i++) {
+    size_t ssidLen = strnlen(list[i].ssid, sizeof(list[i].ssid));
+    size_t passwordLen = strnlen(list[i].password, sizeof(list[i].password));
+    if (ssidLen == 0 || ssidLen > NETWORK_SSID_MAX_LEN ||
+        passwordLen >= MAX_PASSWORD_LENGTH) {
+      return false;
+    }
+    // Control characters would not fit the JSON of the web UI unescaped
+    if (network_hasControlChars(list[i].ssid) ||
+        network_hasControlChars(list[i].password)) {
+      return false;
+    }
+  }
+  knownLoaded = true;
+  memset(knownNetworks, 0, sizeof(knownNetworks));
+  memcpy(knownNetworks, list, count * sizeof(network_known_t));
+  knownCount = (uint8_t)count;
+  knownDirty = true;
+  return true;
+}
+
+void network_knownPoll(void) {
+  uint8_t *image = NULL;
+  uint32_t imageSize = 0;
+  // The httpd changes the list in the background context
+  cyw43_arch_lwip_begin();
+  if (knownDirty) {
+    image = network_knownBuildImage(&imageSize);
+    knownDirty = false;
+  }
+  cyw43_arch_lwip_end();
+
+  // Chunked by gconfig_write_app_sector(), outside the lwIP lock, as the scan
+  // snapshot in network_scanPoll()
+  if (image != NULL) {
+    uint32_t offset;
+    int err = gconfig_app_sector_offset(NETWORK_KNOWN_UUID, true, &offset);
+    if (err == GCONFIG_SUCCESS) {
+      err = gconfig_write_app_sector(offset, image, imageSize);
+    }
+    free(image);
+    DPRINTF("Known networks saved: %d\n", err);
+  }
+}
+
+// RSSI of a candidate not heard in the selection scan, ranked last
+#define NETWORK_RSSI_UNSEEN INT8_MIN
+
+// A network the STA connection can join: WIFI_SSID or a known network
+typedef struct {
+  int8_t known;   // Index in knownNetworks, -1 for WIFI_SSID
+  int8_t rssi;    // Strongest BSSID in the selection scan
+  bool rejected;  // Wrong password, not tried again
+} network_sta_candidate_t;
+
+// STA connection in progress, advanced by network_wifiStaConnectPoll()
+typedef struct {
+  network_sta_state_t state;
+  wifi_sta_conn_process_status_t error;  // Why the last attempt failed
+  int attemptsLeft;
+  uint32_t backoffMs;        // Wait before the next attempt
+  absolute_time_t deadline;  // End of the current state
+  char password[MAX_PASSWORD_LENGTH];  // Empty joins without password
+  uint32_t auth;             // Configured CYW43 auth type
+  uint32_t joinAuth;         // Auth type of the join in progress
+  char ssid[MAX_SSID_LENGTH];  // SSID to join, empty until resolved
+  uint8_t bssid[NETWORK_MAC_SIZE];
+  bool configuredBssid;  // The SSID parameter holds a BSSID
+  bool useBssid;
+  bool bssidFallbackTried;
+  bool haveJoinCache;
+  bool fastJoinTried;
+  network_join_cache_t joinCache;
+  bssid_scan_lookup_ctx_t lookup;
+  wifi_sta_conn_status_t prevStatus;
+  network_sta_candidate_t candidates[NETWORK_KNOWN_MAX + 1];  // Best first
+  uint8_t candidateCount;
+  uint8_t candidate;  // Index in candidates of the network being tried
+  bool staticIp;
+  bool selectScanned;         // The selection scan started
+  uint32_t selectGeneration;  // Scan store generation before it
+} network_sta_conn_t;
+
+static network_sta_conn_t staConn = {0};
+
+static void network_staFinish(network_sta_state_t state) {
+  memset(staConn.password, 0, sizeof(staConn.password));
+  staConn.state = state;
+}
+
+// Password of the join, NULL to join without password
+static const char *network_staPassword(void) {
+  return staConn.password[0] != '\0' ? staConn.password : NULL;
+}
+
+/**
+ * @brief Copies the credentials of a candidate, so the web UI can change
+ * them while the connection is in progress.
+ *
+ * @return false if the known network is gone.
+ */
+static bool network_staCandidateCredentials(
+    const network_sta_candidate_t *candidate, network_known_t *out) {
+  memset(out, 0, sizeof(*out));
+  if (candidate->known < 0) {
+    cyw43_arch_lwip_begin();
+    strncpy(out->ssid, gconfig_get_str(GCONFIG_ID_WIFI_SSID),
+            sizeof(out->ssid) - 1);
+    strncpy(out->password, gconfig_get_str(GCONFIG_ID_WIFI_PASSWORD),
+            sizeof(out->password) - 1);
+    out->auth = (uint8_t)gconfig_get_int(GCONFIG_ID_WIFI_AUTH);
+    cyw43_arch_lwip_end();
+    return true;
+  }
+  cyw43_arch_lwip_begin();
+  bool valid = candidate->known < knownCount;
+  if (valid) {
+    *out = knownNetworks[candidate->known];
+  }
+  cyw43_arch_lwip_end();
+  return valid;
+}
+
+/**
+ * @brief Makes a candidate the network of the next attempts: credentials,
+ * join cache and DHCP lease.
+ */
+static bool network_staUseCandidate(uint8_t index) {
+  network_known_t credentials;
+  if (!network_staCandidateCredentials(&staConn.candidates[index],
+                                       &credentials)) {
+    return false;
+  }
+  staConn.candidate = index;
+  memcpy(staConn.password, credentials.password, sizeof(staConn.password));
+  if (staConn.password[0] == '\0') {
+    DPRINTF("No password for %s. Trying to connect without password\n",
+            credentials.ssid);
+  }
+  staConn.auth = getAuthPicoCode(credentials.auth);
+  memset(staConn.ssid, 0, sizeof(staConn.ssid));
+  char bssidStr[MAX_BSSID_LENGTH];
+  staConn.configuredBssid =
+      network_parseBssid(credentials.ssid, staConn.bssid, bssidStr);
+  if (!staConn.configuredBssid) {
+    strncpy(staConn.ssid, credentials.ssid, sizeof(staConn.ssid) - 1);
+  }
+  staConn.haveJoinCache =
+      network_loadJoinCache(credentials.ssid, &staConn.joinCache);
+  if (staConn.haveJoinCache && !staConn.staticIp) {
+    cyw43_arch_lwip_begin();
+    network_requestLastLease(&cyw43_state.netif[CYW43_ITF_STA],
+                             staConn.joinCache.lease);
+    cyw43_arch_lwip_end();
+  }
+  return true;
+}
+
+// Switches to the first candidate from index on not rejected
+static bool network_staNextCandidate(uint8_t from) {
+  for (uint8_t i = from; i < staConn.candidateCount; i++) {
+    if (!staConn.candidates[i].rejected && network_staUseCandidate(i)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Sorts the candidates by the strongest BSSID heard in the selection
+ * scan. The ones not heard (out of range, or hidden SSIDs) keep their order
+ * of preference after them.
+ */
+static void network_staRankCandidates(void) {
+  for (uint8_t c = 0; c < staConn.candidateCount; c++) {
+    network_sta_candidate_t *candidate = &staConn.candidates[c];
+    candidate->rssi = NETWORK_RSSI_UNSEEN;
+    network_known_t credentials;
+    if (!network_staCandidateCredentials(candidate, &credentials)) {
+      continue;
+    }
+    uint8_t bssid[NETWORK_MAC_SIZE];
+    char bssidStr[MAX_BSSID_LENGTH];
+    bool byBssid = network_parseBssid(credentials.ssid, bssid, bssidStr);
+    cyw43_arch_lwip_begin();
+    for (uint8_t i = 0; i < wifiScanData.count; i++) {
+      const wifi_network_info_t *network = &wifiScanData.networks[i];
+      // Results older than the scan may be from another place
+      if (staConn.selectScanned &&
+          (int32_t)(network->generation - staConn.selectGeneration) <= 0) {
+        continue;
+      }
+      bool match =
+          byBssid ? memcmp(network->bssid, bssid, NETWORK_MAC_SIZE) == 0
+                  : strcmp(wifiScanData.ssids[network->ssid].name,
+                           credentials.ssid) == 0;
+      if (match && network->rssi > candidate->rssi) {
+        candidate->rssi = network->rssi;
+      }
+    }
+    cyw43_arch_lwip_end();
+    DPRINTF("Known network %s: %d dBm\n", credentials.ssid,
+            candidate->rssi == NETWORK_RSSI_UNSEEN ? 0 : candidate->rssi);
+  }
+  for (uint8_t i = 1; i < staConn.candidateCount; i++) {
+    network_sta_candidate_t item = staConn.candidates[i];
+    uint8_t j = i;
+    while (j > 0 && staConn.candidates[j - 1].rssi < item.rssi) {
+      staConn.candidates[j] = staConn.candidates[j - 1];
+      j--;
+    }
+    staConn.candidates[j] = item;
+  }
+}
+
+static void network_staBeginAttempt(void);
+
+// Starts the first attempt with the best candidate
+static void network_staStartCandidates(void) {
+  if (staConn.candidateCount > 1) {
+    network_staRankCandidates();
+  }
+  if (!network_staNextCandidate(0)) {
+    DPRINTF("No network left to join\n");
+    staConn.error = NETWORK_WIFI_STA_CONN_ERR_NO_SSID;
+    network_staFinish(NETWORK_STA_FAILED);
+    return;
+  }
+  network_staBeginAttempt();
+}
+
+static void network_staAttemptFailed(wifi_sta_conn_process_status_t error) {
+  staConn.error = error;
+  cyw43_wifi_leave(&cyw43_state, CYW43_ITF_STA);
+  if (network_staNextCandidate(staConn.candidate + 1)) {
+    DPRINTF("STA attempt failed: %s. Trying the next known network\n",
+            network_WifiStaConnStatusString(error));
+    network_staBeginAttempt();
+    return;
+  }
+  if (--staConn.attemptsLeft <= 0 || !network_staNextCandidate(0)) {
+    DPRINTF("STA connection failed: %s\n",
+            network_WifiStaConnStatusString(error));
+    network_staFinish(NETWORK_STA_FAILED);
+    return;
+  }
+  DPRINTF("STA attempt failed: %s. Retrying in %lu ms, %d attempts left\n",
+          network_WifiStaConnStatusString(error),
+          (unsigned long)staConn.backoffMs, staConn.attemptsLeft);
+  staConn.state = NETWORK_STA_BACKOFF;
+  staConn.deadline = make_timeout_time_ms(staConn.backoffMs);
+  staConn.backoffMs = staConn.backoffMs * 2 < NETWORK_STA_BACKOFF_MAX_MS
+                          ? staConn.backoffMs * 2
+                          : NETWORK_STA_BACKOFF_MAX_MS;
+}
+
+/**
+ * @brief Starts the full join: resolves the SSID of a configured BSSID first
+ * (from the scan results, or with a scan), then joins by BSSID or SSID.
+ */
+static void network_staStartJoin(void) {
+  if (staConn.useBssid && staConn.ssid[0] == '\0') {
+    char bssidStr[MAX_BSSID_LENGTH];
+    network_formatBssid(staConn.bssid, bssidStr);
+    if (network_findCachedSsidByBssid(staConn.bssid, staConn.ssid,
+                                      sizeof(staConn.ssid))) {
+      DPRINTF(
+          "SSID parameter is BSSID=%s. Using cached SSID='%s' and forcing "
+          "BSSID match.\n",
+          bssidStr, staConn.ssid);
+    } else {
+      memset(&staConn.lookup, 0, sizeof(staConn.lookup));
+      memcpy(staConn.lookup.bssid, staConn.bssid, NETWORK_MAC_SIZE);
+      cyw43_wifi_scan_options_t scanOptions = {0};
+      int scanErr = cyw43_wifi_scan(&cyw43_state, &scanOptions, &staConn.lookup,
+                                    network_scanLookupBssidCallback);
+      if (scanErr != 0) {
+        DPRINTF("BSSID scan start failed: %d\n", scanErr);
+        network_staAttemptFailed(NETWORK_WIFI_STA_CONN_ERR_NO_SSID);
+        return;
+      }
+      DPRINTF("SSID parameter is BSSID=%s. Resolving SSID with a scan\n",
+              bssidStr);
+      staConn.state = NETWORK_STA_RESOLVING;
+      staConn.deadline = make_timeout_time_ms(NETWORK_BSSID_SCAN_TIMEOUT_MS);
+      return;
+    }
+  }
+
+  int errorCode = 0;
+  staConn.joinAuth = staConn.auth;
+  if (staConn.useBssid) {
+    DPRINTF("Connecting to SSID=%s by BSSID, auth=%08lx. ASYNC\n",
+            staConn.ssid, (unsigned long)staConn.auth);
+    errorCode = cyw43_arch_wifi_connect_bssid_async(
+        staConn.ssid, staConn.bssid, network_staPassword(), staConn.auth);
+  } else {
+    DPRINTF("Connecting to SSID=%s, auth=%08lx. ASYNC\n", staConn.ssid,
+            (unsigned long)staConn.auth);
+    errorCode = cyw43_arch_wifi_connect_async(
+        staConn.ssid, network_staPassword(), staConn.auth);
+  }
+  if (errorCode != 0) {
+    DPRINTF("Failed to connect to WiFi: %d\n", errorCode);
+    network_staAttemptFailed(NETWORK_WIFI_STA_CONN_ERR_CONNECTION_FAILED);
+    return;
+  }
+  staConn.state = NETWORK_STA_JOINING;
+  staConn.deadline = make_timeout_time_ms(NETWORK_CONNECT_TIMEOUT * SEC_TO_MS);
+  staConn.prevStatus = DISCONNECTED;
+}
+
+/**
+ * @brief Starts an attempt. The first one joins the cached BSSID on its
+ * channel, skipping the scan of every channel that a join by SSID does.
+ */
+static void network_staBeginAttempt(void) {
+  staConn.useBssid = staConn.configuredBssid;
+  staConn.bssidFallbackTried = false;
+  if (!staConn.haveJoinCache || staConn.fastJoinTried) {
+    network_staStartJoin();
+    return;
+  }
+
+  staConn.fastJoinTried = true;
+  network_join_cache_t *cache = &staConn.joinCache;
+  char bssidStr[MAX_BSSID_LENGTH];
+  network_formatBssid(cache->bssid, bssidStr);
+  DPRINTF("Fast join to SSID=%s, BSSID=%s, channel=%lu, auth=%08lx\n",
+          cache->ssid, bssidStr, (unsigned long)cache->channel,
+          (unsigned long)cache->auth);
+  const char *password = network_staPassword();
+  int err = cyw43_wifi_join(
+      &cyw43_state, strlen(cache->ssid), (const uint8_t *)cache->ssid,
+      password ? strlen(password) : 0, (const uint8_t *)password,
+      password ? cache->auth : CYW43_AUTH_OPEN, cache->bssid, cache->channel);
+  if (err != 0) {
+    DPRINTF("Fast join start failed: %d\n", err);
+    network_staStartJoin();
+    return;
+  }
+  staConn.state = NETWORK_STA_FAST_JOIN;
+  staConn.deadline = make_timeout_time_ms(NETWORK_FAST_JOIN_TIMEOUT_MS);
+}
+
+static void network_staPollJoining(void) {
+  wifi_sta_conn_status_t status = network_wifiConnStatus(NULL, 0);
+  if (status != staConn.prevStatus) {
+    DPRINTF("WiFi connection status: %s[%i]\n", network_wifiConnStatusStr(),
+            status);
+    staConn.prevStatus = status;
+  }
+  if (status == CONNECTED_WIFI_IP) {
+    network_saveJoinCache(staConn.ssid, staConn.joinAuth);
+    DPRINTF("Connected. Check the connection status...\n");
+    network_staFinish(NETWORK_STA_CONNECTED);
+    return;
+  }
+  bool failed = status == CONNECT_FAILED_ERROR || status == GENERIC_ERROR;
+  if (failed && staConn.useBssid && !staConn.bssidFallbackTried) {
+    DPRINTF("BSSID-directed join failed. Retrying SSID-only join for SSID=%s\n",
+            staConn.ssid);
+    staConn.bssidFallbackTried = true;
+    staConn.useBssid = false;
+    network_staStartJoin();
+    return;
+  }
+  if (status == BADAUTH_ERROR) {
+    // Retrying does not fix a wrong password
+    staConn.candidates[staConn.candidate].rejected = true;
+    network_staAttemptFailed(NETWORK_WIFI_STA_CONN_ERR_CONNECTION_FAILED);
+  } else if (failed) {
+    network_staAttemptFailed(NETWORK_WIFI_STA_CONN_ERR_CONNECTION_FAILED);
+  } else if (absolute_time_diff_us(get_absolute_time(), staConn.deadline) <=
+             0) {
+    DPRINTF("WiFi connection timeout\n");
+    network_staAttemptFailed(NETWORK_WIFI_STA_CONN_ERR_TIMEOUT);
+  }
+}
+
+wifi_sta_conn_process_status_t network_wifiStaConnectStart(int attempts) {
   if (!cyw43Initialized) {
     DPRINTF("WiFi not initialized. Cancelling connection\n");
     return NETWORK_WIFI_STA_CONN_ERR_NOT_INITIALIZED;
   }
-  if (wifiCurrentMode != WIFI_MODE_STA) {
+  if (!network_staEnabled()) {
     DPRINTF("WiFi mode is not STA. Cancelling connection\n");
     return NETWORK_WIFI_STA_CONN_ERR_INVALID_MODE;
   }
 
   int res;
 
-  // Set hostname
-  char *hostname =
-      settings_find_entry(gconfig_getContext(), PARAM_HOSTNAME)->value;
-
   // Set the STA mode interface mode
   struct netif *nif = &cyw43_state.netif[CYW43_ITF_STA];
 
   cyw43_arch_lwip_begin();
 
+  // Set hostname
+  const char *hostname = gconfig_get_str(GCONFIG_ID_HOSTNAME);
   if ((hostname != NULL) && (strlen(hostname) > 0)) {
     strncpy(wifiHostname, hostname, sizeof(wifiHostname));
   } else {
@@ -809,8 +1988,10 @@ wifi_sta_conn_process_status_t network_wifiStaConnect() {
   netif_set_link_callback(nif, wifiLinkCallback);
   netif_set_status_callback(nif, networkStatusCallback);
 
-  // Always use DHCP in STA mode.
-  DPRINTF("DHCP enabled\n");
+  bool staticIp = network_applyStaticIp(nif);
+  if (!staticIp) {
+    DPRINTF("DHCP enabled\n");
+  }
   netif_set_up(nif);
 
   cyw43_arch_lwip_end();
@@ -821,140 +2002,165 @@ wifi_sta_conn_process_status_t network_wifiStaConnect() {
     return NETWORK_WIFI_STA_CONN_ERR_MAC_FAILED;
   }
 
-  SettingsConfigEntry *ssid =
-      settings_find_entry(gconfig_getContext(), PARAM_WIFI_SSID);
-  if (strlen(ssid->value) == 0) {
+  char ssid[MAX_SSID_LENGTH] = {0};
+  cyw43_arch_lwip_begin();
+  strncpy(ssid, gconfig_get_str(GCONFIG_ID_WIFI_SSID), sizeof(ssid) - 1);
+  bool noAuth = strlen(gconfig_get_str(GCONFIG_ID_WIFI_AUTH)) == 0;
+  cyw43_arch_lwip_end();
+  if (strlen(ssid) > 0 && noAuth) {
+    DPRINTF("No auth mode found in config. Can't connect\n");
+    return NETWORK_WIFI_STA_CONN_ERR_NO_AUTH_MODE;
+  }
+
+  network_staFinish(NETWORK_STA_IDLE);
+  memset(&staConn, 0, sizeof(staConn));
+  staConn.staticIp = staticIp;
+  // WIFI_SSID first, then the known networks in order of preference
+  if (strlen(ssid) > 0) {
+    staConn.candidates[staConn.candidateCount++].known = -1;
+  }
+  cyw43_arch_lwip_begin();
+  network_knownLoad();
+  for (uint8_t i = 0; i < knownCount; i++) {
+    if (strcmp(knownNetworks[i].ssid, ssid) != 0) {
+      staConn.candidates[staConn.candidateCount++].known = (int8_t)i;
+    }
+  }
+  cyw43_arch_lwip_end();
+  if (staConn.candidateCount == 0) {
     DPRINTF("No SSID found in config. Can't connect\n");
     return NETWORK_WIFI_STA_CONN_ERR_NO_SSID;
   }
-  bool connectUsingBssid = false;
-  uint8_t targetBssid[NETWORK_MAC_SIZE] = {0};
-  char targetBssidStr[MAX_BSSID_LENGTH] = {0};
-  char resolvedSsid[MAX_SSID_LENGTH] = {0};
-  const char *targetSsid = ssid->value;
-
-  if (network_parseBssid(ssid->value, targetBssid, targetBssidStr)) {
-    connectUsingBssid = true;
-    if (network_findCachedSsidByBssid(targetBssidStr, resolvedSsid,
-                                      sizeof(resolvedSsid))) {
-      targetSsid = resolvedSsid;
-      DPRINTF(
-          "SSID parameter is BSSID=%s. Using cached SSID='%s' and forcing "
-          "BSSID match.\n",
-          targetBssidStr, targetSsid);
-    } else if (network_resolveSsidByBssidScan(targetBssidStr, resolvedSsid,
-                                              sizeof(resolvedSsid))) {
-      targetSsid = resolvedSsid;
-      DPRINTF(
-          "SSID parameter is BSSID=%s. Resolved SSID='%s' from scan and "
-          "forcing BSSID match.\n",
-          targetBssidStr, targetSsid);
-    } else {
-      DPRINTF("SSID parameter is BSSID=%s. Could not resolve SSID from cache "
-              "or scan; aborting STA connection.\n",
-              targetBssidStr);
-      return NETWORK_WIFI_STA_CONN_ERR_NO_SSID;
+  staConn.attemptsLeft = attempts > 0 ? attempts : 1;
+  staConn.backoffMs = NETWORK_STA_BACKOFF_MIN_MS;
+
+  if (staConn.candidateCount > 1) {
+    cyw43_arch_lwip_begin();
+    network_scanStoreInit();
+    staConn.selectGeneration = wifiScanData.generation;
+    cyw43_arch_lwip_end();
+    staConn.selectScanned = network_scanStart() == 0;
+    if (staConn.selectScanned) {
+      DPRINTF("Scanning for %u known networks\n", staConn.candidateCount);
+      staConn.state = NETWORK_STA_SELECTING;
+      staConn.deadline = make_timeout_time_ms(NETWORK_STA_SELECT_TIMEOUT_MS);
+      return NETWORK_WIFI_STA_CONN_OK;
     }
+    DPRINTF("Selection scan failed. Using the stored scan results\n");
   }
+  network_staStartCandidates();
+  return NETWORK_WIFI_STA_CONN_OK;
+}
 
-  SettingsConfigEntry *authMode =
-      settings_find_entry(gconfig_getContext(), PARAM_WIFI_AUTH);
-  if (strlen(authMode->value) == 0) {
-    DPRINTF("No auth mode found in config. Can't connect\n");
-    return NETWORK_WIFI_STA_CONN_ERR_NO_AUTH_MODE;
+network_sta_state_t network_wifiStaConnectPoll(void) {
+  bool expired =
+      absolute_time_diff_us(get_absolute_time(), staConn.deadline) <= 0;
+  switch (staConn.state) {
+    case NETWORK_STA_SELECTING:
+      if (!cyw43_wifi_scan_active(&cyw43_state) || expired) {
+        network_staStartCandidates();
+      }
+      break;
+    case NETWORK_STA_FAST_JOIN: {
+      int linkStatus = cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA);
+      if (linkStatus >= CYW43_LINK_JOIN) {
+        DPRINTF("Fast join link up\n");
+        strncpy(staConn.ssid, staConn.joinCache.ssid, sizeof(staConn.ssid) - 1);
+        staConn.joinAuth = staConn.joinCache.auth;
+        staConn.useBssid = false;
+        staConn.state = NETWORK_STA_JOINING;
+        staConn.deadline =
+            make_timeout_time_ms(NETWORK_CONNECT_TIMEOUT * SEC_TO_MS);
+        staConn.prevStatus = DISCONNECTED;
+      } else if (linkStatus < 0 || expired) {
+        DPRINTF("Fast join did not complete (%d). Using the full join\n",
+                linkStatus);
+        cyw43_wifi_leave(&cyw43_state, CYW43_ITF_STA);
+        network_staStartJoin();
+      }
+      break;
+    }
+    case NETWORK_STA_RESOLVING:
+      if (staConn.lookup.found) {
+        strncpy(staConn.ssid, staConn.lookup.ssid, sizeof(staConn.ssid) - 1);
+        DPRINTF("Resolved SSID='%s' from scan. Forcing BSSID match.\n",
+                staConn.ssid);
+        network_staStartJoin();
+      } else if (!cyw43_wifi_scan_active(&cyw43_state) || expired) {
+        DPRINTF("Could not resolve the SSID of the BSSID from a scan\n");
+        network_staAttemptFailed(NETWORK_WIFI_STA_CONN_ERR_NO_SSID);
+      }
+      break;
+    case NETWORK_STA_JOINING:
+      network_staPollJoining();
+      break;
+    case NETWORK_STA_BACKOFF:
+      if (expired) {
+        network_staBeginAttempt();
+      }
+      break;
+    default:
+      break;
   }
-  char *passwordValue = NULL;
-  SettingsConfigEntry *password =
-      settings_find_entry(gconfig_getContext(), PARAM_WIFI_PASSWORD);
-  if (strlen(password->value) > 0) {
-    passwordValue = strdup(password->value);
-  } else {
-    DPRINTF(
-        "No password found in config. Trying to connect without password\n");
+  return staConn.state;
+}
+
+network_sta_state_t network_wifiStaState(void) { return staConn.state; }
+
+const char *network_wifiStaStateString(void) {
+  switch (staConn.state) {
+    case NETWORK_STA_IDLE:
+      return "Not started";
+    case NETWORK_STA_SELECTING:
+      return "Scanning";
+    case NETWORK_STA_FAST_JOIN:
+    case NETWORK_STA_RESOLVING:
+    case NETWORK_STA_JOINING:
+      return "Connecting";
+    case NETWORK_STA_BACKOFF:
+      return "Retrying";
+    case NETWORK_STA_CONNECTED:
+      return "Connected";
+    case NETWORK_STA_FAILED:
+      return network_WifiStaConnStatusString(staConn.error);
+    default:
+      return "Unknown";
   }
-  DPRINTF("The password is: %s\n", passwordValue);
+}
 
-  uint32_t authValue = getAuthPicoCode(atoi(authMode->value));
-  int errorCode = 0;
-  bool bssidFallbackTried = false;
-  if (connectUsingBssid) {
-    DPRINTF("Connecting to SSID=%s, BSSID=%s, password=%s, auth=%08x. ASYNC\n",
-            targetSsid, targetBssidStr, passwordValue, authValue);
-    errorCode = cyw43_arch_wifi_connect_bssid_async(
-        targetSsid, targetBssid, passwordValue, authValue);
-  } else {
-    DPRINTF("Connecting to SSID=%s, password=%s, auth=%08x. ASYNC\n",
-            targetSsid, passwordValue, authValue);
-    errorCode = cyw43_arch_wifi_connect_async(targetSsid, passwordValue,
-                                              authValue);
+wifi_sta_conn_process_status_t network_wifiStaConnectError(void) {
+  return staConn.state == NETWORK_STA_CONNECTED ? NETWORK_WIFI_STA_CONN_OK
+                                                : staConn.error;
+}
+
+wifi_sta_conn_process_status_t network_wifiStaConnect() {
+  wifi_sta_conn_process_status_t err = network_wifiStaConnectStart(1);
+  if (err != NETWORK_WIFI_STA_CONN_OK) {
+    return err;
   }
-  if (errorCode != 0) {
-    DPRINTF("Failed to connect to WiFi: %d\n", errorCode);
-    free(passwordValue);
-    return NETWORK_WIFI_STA_CONN_ERR_CONNECTION_FAILED;
-  }
-
-  // Enter a loop until the device has a WiFi connection with an IP address. Or
-  // timesout.
-  wifi_sta_conn_status_t prevStatus = DISCONNECTED;
-  int wifiConnPollingInterval = 1;  // 1 seconds
-  absolute_time_t wifiConnStatusTime = make_timeout_time_ms(1 * SEC_TO_MS);
-  absolute_time_t wifiConnConnTimeout =
-      make_timeout_time_ms(NETWORK_CONNECT_TIMEOUT * SEC_TO_MS);  // 30 seconds
-  while (absolute_time_diff_us(get_absolute_time(), wifiConnConnTimeout) > 0) {
+  network_sta_state_t state = network_wifiStaConnectPoll();
+  while (state != NETWORK_STA_CONNECTED && state != NETWORK_STA_FAILED) {
 #ifdef BLINK_H
     blink_morse('T');
 #endif
-
-    wifi_sta_conn_status_t status =
-        network_wifiConnStatus(&wifiConnStatusTime, wifiConnPollingInterval);
 #if PICO_CYW43_ARCH_POLL
     network_safePoll();
-    cyw43_arch_wait_for_work_until(make_timeout_time_ms(2 * SEC_TO_MS));
+    cyw43_arch_wait_for_work_until(
+        make_timeout_time_ms(NETWORK_POLLING_INTERVAL));
 #else
     sleep_ms(NETWORK_POLLING_INTERVAL);
 #endif
     if (networkPollingCallback != NULL) {
       networkPollingCallback();
     }
-    if (status != prevStatus) {
-      DPRINTF("WiFi connection status: %s[%i]\n", network_wifiConnStatusStr(),
-              status);
-      prevStatus = status;
-    }
-    if (connectUsingBssid && !bssidFallbackTried &&
-        (status == CONNECT_FAILED_ERROR || status == GENERIC_ERROR)) {
-      DPRINTF("BSSID-directed join failed. Retrying SSID-only join for SSID=%s\n",
-              targetSsid);
-      errorCode = cyw43_arch_wifi_connect_async(targetSsid, passwordValue,
-                                                authValue);
-      if (errorCode != 0) {
-        DPRINTF("SSID-only retry start failed: %d\n", errorCode);
-        free(passwordValue);
-        return NETWORK_WIFI_STA_CONN_ERR_CONNECTION_FAILED;
-      }
-      bssidFallbackTried = true;
-      connectUsingBssid = false;
-      prevStatus = DISCONNECTED;
-      continue;
-    }
-    if (status == CONNECTED_WIFI_IP) {
-#ifdef BLINK_H
-      blink_on();
-#endif
-      break;
-    }
+    state = network_wifiStaConnectPoll();
   }
-  if (absolute_time_diff_us(get_absolute_time(), wifiConnConnTimeout) <= 0) {
-    DPRINTF("WiFi connection timeout\n");
-    // Return the error code
-    free(passwordValue);
-    return NETWORK_WIFI_STA_CONN_ERR_TIMEOUT;
+#ifdef BLINK_H
+  if (state == NETWORK_STA_CONNECTED) {
+    blink_on();
   }
-
-  free(passwordValue);
-  DPRINTF("Connected. Check the connection status...\n");
-  return 0;
+#endif
+  return network_wifiStaConnectError();
 }
 
 char *network_wifiConnStatusStr() { return connectionStatusStr; }
@@ -965,7 +2171,7 @@ wifi_sta_conn_status_t network_wifiConnStatus(
     DPRINTF("WiFi not initialized. Cancelling connection\n");
     return -1;
   }
-  if (wifiCurrentMode != WIFI_MODE_STA) {
+  if (!network_staEnabled()) {
     DPRINTF("WiFi mode is not STA. Cancelling connection\n");
     return -2;
   }
@@ -1020,8 +2226,10 @@ wifi_sta_conn_status_t network_wifiConnStatus(
                  "LINK UNKNOWN");
       }
     }
-    *wifiConnStatusTime =
-        make_timeout_time_ms(wifiConStatusInterval * SEC_TO_MS);
+    if (wifiConnStatusTime != NULL) {
+      *wifiConnStatusTime =
+          make_timeout_time_ms(wifiConStatusInterval * SEC_TO_MS);
+    }
   }
   // else {
   //     DPRINTF("Connection status check skipped\n");
@@ -1037,3 +2245,17 @@ wifi_sta_conn_status_t network_wifiConnStatus(
  * @return The current IP address as an ip_addr_t structure.
  */
 ip_addr_t network_getCurrentIp() { return currentIp; }
+
+uint32_t network_getApChannel(void) {
+  if (!cyw43Initialized || (wifiCurrentMode != WIFI_MODE_AP &&
+                            wifiCurrentMode != WIFI_MODE_AP_STA)) {
+    return 0;
+  }
+  // The channel info is { hw_channel, target_channel, scan_channel }
+  uint32_t channelInfo[3] = {0};
+  if (cyw43_ioctl(&cyw43_state, CYW43_IOCTL_GET_CHANNEL, sizeof(channelInfo),
+                  (uint8_t *)channelInfo, CYW43_ITF_AP) != 0) {
+    return 0;
+  }
+  return channelInfo[0];
+}
@@ -2,7 +2,7 @@
  * @file settings.c
  */
 
- #include "settings.h"
+ #include "settings_internal.h"
 
  /*
   * -----------
@@ -15,13 +15,14 @@
   */
  static int checkKeyFormat(const char key[SETTINGS_MAX_KEY_LENGTH]) {
    // Check if the key is empty
-   if (strlen(key) == 0) {
+   size_t keyLength = strlen(key);
+   if (keyLength == 0) {
      DPRINTF("Error: Key is empty.\n");
      return -1;  // Invalid key format
    }
  
    // Loop through each character in the key
-   for (size_t i = 0; i < strlen(key); i++) {
+   for (size_t i = 0; i < keyLength; i++) {
      char chr = key[i];
  
      // Check if the character is not an uppercase letter, digit or underscore
@@ -37,6 +38,109 @@
    return 0;  // Valid key format
  }
  
+ /**
+  * @brief Validate a key and compute its FNV-1a hash in a single pass.
+  *
+  * Only the first SETTINGS_MAX_KEY_LENGTH characters are significant, the same
+  * as the strncmp() used to compare stored keys.
+  */
+ static int settingsHashKey(const char *key, uint32_t *hash) {
+   if (key == NULL || key[0] == '\0') {
+     DPRINTF("Error: Key is empty.\n");
+     return -1;
+   }
+ 
+   uint32_t value = SETTINGS_FNV1A_OFFSET_BASIS;
+   for (size_t i = 0; i < SETTINGS_MAX_KEY_LENGTH && key[i] != '\0'; i++) {
+     char chr = key[i];
+     if (!isupper(chr) && !isdigit(chr) && chr != '_') {
+       DPRINTF("Error: Invalid character '%c' in key '%s'.\n", chr, key);
+       return -1;
+     }
+     value ^= (uint8_t)chr;
+     value *= SETTINGS_FNV1A_PRIME;
+   }
+   *hash = value;
+   return 0;
+ }
+ 
+ /**
+  * @brief Build the hashed key index over the loaded entries.
+  *
+  * Called once the entries are loaded; keys never change afterwards so the
+  * index stays valid for the lifetime of the context. If a key appears more
+  * than once, the first occurrence wins, as with the previous linear scan.
+  */
+ static void settingsBuildIndex(SettingsContext *ctx) {
+   free(ctx->index);
+   ctx->index = NULL;
+   ctx->indexMask = 0;
+ 
+   size_t slots = SETTINGS_INDEX_MIN_SLOTS;
+   while (slots < ctx->configData.count * 2) {
+     slots <<= 1;
+   }
+   ctx->index = (uint16_t *)malloc(slots * sizeof(uint16_t));
+   if (!ctx->index) {
+     DPRINTF("WARNING: No memory for key index. Using linear lookups.\n");
+     return;
+   }
+   memset(ctx->index, 0xFF, slots * sizeof(uint16_t));
+   ctx->indexMask = (uint16_t)(slots - 1);
+ 
+   for (size_t i = 0; i < ctx->configData.count; i++) {
+     const char *key = ctx->configData.entries[i].key;
+     uint32_t hash = 0;
+     if (settingsHashKey(key, &hash) != 0) {
+       continue;
+     }
+     uint16_t slot = (uint16_t)(hash & ctx->indexMask);
+     while (ctx->index[slot] != SETTINGS_INDEX_EMPTY &&
+            strncmp(ctx->configData.entries[ctx->index[slot]].key, key,
+                    SETTINGS_MAX_KEY_LENGTH) != 0) {
+       slot = (slot + 1) & ctx->indexMask;
+     }
+     if (ctx->index[slot] == SETTINGS_INDEX_EMPTY) {
+       ctx->index[slot] = (uint16_t)i;
+     }
+   }
+   DPRINTF("Key index built: %zu entries in %zu slots.\n",
+           ctx->configData.count, slots);
+ }
+ 
+ /**
+  * @brief Resolve a key to its position in the entries array.
+  *
+  * @return The position of the entry, or -1 if the key is invalid or unknown.
+  */
+ static int settingsFindPosition(const SettingsContext *ctx, const char *key) {
+   uint32_t hash = 0;
+   if (settingsHashKey(key, &hash) != 0) {
+     return -1;
+   }
+ 
+   if (ctx->index == NULL) {
+     for (size_t i = 0; i < ctx->configData.count; i++) {
+       if (strncmp(ctx->configData.entries[i].key, key,
+                   SETTINGS_MAX_KEY_LENGTH) == 0) {
+         return (int)i;
+       }
+     }
+     return -1;
+   }
+ 
+   uint16_t slot = (uint16_t)(hash & ctx->indexMask);
+   while (ctx->index[slot] != SETTINGS_INDEX_EMPTY) {
+     uint16_t pos = ctx->index[slot];
+     if (strncmp(ctx->configData.entries[pos].key, key,
+                 SETTINGS_MAX_KEY_LENGTH) == 0) {
+       return pos;
+     }
+     slot = (slot + 1) & ctx->indexMask;
+   }
+   return -1;
+ }
+ 
  /**
   * @brief Verify that the type is one of the known types.
   */
@@ -94,18 +198,22 @@
    } else {
      DPRINTF("Loaded %zu default entries.\n", ctx->configData.count);
    }
+ 
+   // The default keys are the final set of keys: index them now so the values
+   // stored in flash can be matched without a scan per entry.
+   settingsBuildIndex(ctx);
+ 
+   // Defaults are not in flash until they are saved
+   settingsMarkAllDirty(ctx);
  }
  
  /**
-  * @brief Load all entries from FLASH if valid, otherwise use default entries.
+  * @brief Overwrite the loaded defaults with the entry array stored in FLASH
+  * (block layout), if its magic matches.
   */
- static int settingsLoadAllEntries(SettingsContext *ctx,
-                                   const SettingsConfigEntry *entries,
-                                   uint16_t numEntries, uint16_t maxEntries) {
-   uint8_t *currentAddress = (uint8_t *)(ctx->flashSettingsOffset + XIP_BASE);
- 
-   // First, load default entries
-   settingsLoadDefaultEntries(ctx, entries, numEntries);
+ static int settingsLoadBlockEntries(SettingsContext *ctx, uint16_t numEntries) {
+   uint8_t *currentAddress =
+       (uint8_t *)(ctx->flashSettingsOffset + SETTINGS_XIP_BASE);
  
    // The magic value is stored as a string in the first "entry",
    // i.e. at offset = first entry's value field. By design, your code
@@ -181,12 +289,10 @@
  
      // Overwrite the matching default entry in ctx->configData
      // if it exists:
-     for (size_t i = 0; i < ctx->configData.count; i++) {
-       if (strncmp(ctx->configData.entries[i].key, entry.key,
-                   SETTINGS_MAX_KEY_LENGTH) == 0) {
-         ctx->configData.entries[i] = entry;
-         break;  // Found the match, updated, done
-       }
+     int pos = settingsFindPosition(ctx, entry.key);
+     if (pos >= 0) {
+       ctx->configData.entries[pos] = entry;
+       settingsMarkClean(ctx, (size_t)pos);
      }
      count++;
    }
@@ -194,16 +300,270 @@
    return 0;
  }
  
- /*
-  * -----------
-  * PUBLIC API IMPLEMENTATION
-  * -----------
+ /**
+  * @brief One flash operation, run through settings_flash_execute().
   */
+ typedef struct {
+   uint32_t offset;
+   const uint8_t *data;
+   uint32_t size;
+ } SettingsFlashOperation;
+ 
+ static void settingsFlashEraseChunk(void *param) {
+   const SettingsFlashOperation *op = (const SettingsFlashOperation *)param;
+   flash_range_erase(op->offset, op->size);
+ }
  
- int settings_init(SettingsContext *ctx,
-                   const SettingsConfigEntry *defaultEntries,
-                   uint16_t defaultNumEntries, uint32_t flashOffset,
-                   uint32_t flashSize, uint16_t magic, uint16_t version) {
+ static void settingsFlashProgramChunk(void *param) {
+   const SettingsFlashOperation *op = (const SettingsFlashOperation *)param;
+   flash_range_program(op->offset, op->data, op->size);
+ }
+ 
+ /**
+  * @brief Run one chunk, with interrupts off and the other core locked out
+  * only for its duration, and record how long that window lasted.
+  */
+ static int settingsFlashRun(SettingsContext *ctx, void (*chunk)(void *),
+                             SettingsFlashOperation *op,
+                             bool disableInterrupts) {
+   uint32_t start = time_us_32();
+   int err = PICO_OK;
+   if (disableInterrupts) {
+     err = settings_flash_execute(chunk, op);
+   } else {
+     chunk(op);
+   }
+   uint32_t elapsed = time_us_32() - start;
+   ctx->flashStats.busyUs += elapsed;
+   if (disableInterrupts && elapsed > ctx->irqOffMaxUs) {
+     ctx->irqOffMaxUs = elapsed;
+   }
+   if (err != PICO_OK) {
+     DPRINTF("Error: flash operation at 0x%lx failed (%d).\n",
+             (unsigned long)op->offset, err);
+     return -1;
+   }
+   return 0;
+ }
+ 
+ static void settingsCountErase(SettingsContext *ctx, uint32_t offset) {
+   ctx->flashStats.erasedSectors++;
+   uint32_t sector =
+       (offset - ctx->flashSettingsOffset) / SETTINGS_FLASH_SECTOR_SIZE;
+   if (ctx->flashStats.sectorErases &&
+       sector < ctx->flashSettingsSize / SETTINGS_FLASH_SECTOR_SIZE) {
+     ctx->flashStats.sectorErases[sector]++;
+   }
+ }
+ 
+ /**
+  * @brief Reset the wear counters, with one erase counter per sector.
+  */
+ static void settingsInitFlashStats(SettingsContext *ctx) {
+   memset(&ctx->flashStats, 0, sizeof(ctx->flashStats));
+   ctx->flashStats.sectorErases = (uint32_t *)calloc(
+       ctx->flashSettingsSize / SETTINGS_FLASH_SECTOR_SIZE, sizeof(uint32_t));
+ }
+ 
+ int settingsFlashErase(SettingsContext *ctx, uint32_t offset, uint32_t size,
+                        bool disableInterrupts) {
+   for (uint32_t done = 0; done < size; done += SETTINGS_FLASH_SECTOR_SIZE) {
+     SettingsFlashOperation op = {offset + done, NULL,
+                                  SETTINGS_FLASH_SECTOR_SIZE};
+     if (settingsFlashRun(ctx, settingsFlashEraseChunk, &op,
+                          disableInterrupts) != 0) {
+       return -1;
+     }
+     settingsCountErase(ctx, op.offset);
+   }
+   return 0;
+ }
+ 
+ int settingsFlashProgram(SettingsContext *ctx, uint32_t offset,
+                          const uint8_t *data, uint32_t size,
+                          bool disableInterrupts) {
+   for (uint32_t done = 0; done < size;
+        done += SETTINGS_FLASH_PROGRAM_PAGE_SIZE) {
+     SettingsFlashOperation op = {offset + done, data + done,
+                                  SETTINGS_FLASH_PROGRAM_PAGE_SIZE};
+     if (settingsFlashRun(ctx, settingsFlashProgramChunk, &op,
+                          disableInterrupts) != 0) {
+       return -1;
+     }
+     ctx->flashStats.programmedBytes += op.size;
+   }
+   return 0;
+ }
+ 
+ /**
+  * @brief Copy-on-write: the RAM copy of an entry of an XIP view, created
+  * from the flash entry on first use. NULL if out of memory.
+  */
+ static SettingsConfigEntry *settingsXipViewWritable(SettingsContext *ctx,
+                                                     size_t position) {
+   if (!ctx->overlay[position]) {
+     SettingsConfigEntry *copy =
+         (SettingsConfigEntry *)malloc(sizeof(SettingsConfigEntry));
+     if (!copy) {
+       return NULL;
+     }
+     *copy = ctx->configData.entries[position];
+     ctx->overlay[position] = copy;
+   }
+   return ctx->overlay[position];
+ }
+ 
+ /**
+  * @brief Drop the whole overlay (entry copies and table).
+  */
+ static void settingsXipViewFreeOverlay(SettingsContext *ctx) {
+   if (ctx->overlay) {
+     for (size_t i = 0; i < ctx->configData.count; i++) {
+       free(ctx->overlay[i]);
+     }
+     free(ctx->overlay);
+     ctx->overlay = NULL;
+   }
+ }
+ 
+ /**
+  * @brief Back from a save of an XIP view, whose reads were served from the
+  * merged snapshot (ctx->configData.entries) during the save.
+  *
+  * On success, reads go back to flash and the overlay copies that were
+  * saved are dropped; those changed during the save stay. On failure the
+  * snapshot becomes the RAM entry array and the context stops being a view.
+  */
+ static void settingsXipViewSaved(SettingsContext *ctx, bool saved) {
+   if (!saved) {
+     uint32_t ints = save_and_disable_interrupts();
+     for (size_t i = 0; i < ctx->configData.count; i++) {
+       ctx->configData.entries[i] = *settingsEntryAt(ctx, i);
+     }
+     ctx->xipView = false;
+     SettingsConfigEntry **overlay = ctx->overlay;
+     ctx->overlay = NULL;
+     restore_interrupts(ints);
+     for (size_t i = 0; i < ctx->configData.count; i++) {
+       free(overlay[i]);
+     }
+     free(overlay);
+     return;
+   }
+ 
+   ctx->configData.entries = (SettingsConfigEntry *)(SETTINGS_XIP_BASE +
+                                                     ctx->flashSettingsOffset);
+   for (size_t i = 0; i < ctx->configData.count; i++) {
+     uint32_t ints = save_and_disable_interrupts();
+     SettingsConfigEntry *copy = ctx->overlay[i];
+     if (copy && !settingsIsDirty(ctx, i)) {
+       ctx->overlay[i] = NULL;
+     } else {
+       copy = NULL;
+     }
+     restore_interrupts(ints);
+     free(copy);
+   }
+ }
+ 
+ /**
+  * @brief Check that the flash region holds the magic entry followed by
+  * exactly the default keys, so it can be used in place.
+  */
+ static bool settingsXipViewMatches(const SettingsConfigEntry *flashEntries,
+                                    const SettingsConfigEntry *defaultEntries,
+                                    uint16_t defaultNumEntries,
+                                    uint32_t magic) {
+   if (strncmp(flashEntries[0].key, SETTINGS_MAGICVERSION_KEY,
+               SETTINGS_MAX_KEY_LENGTH) != 0 ||
+       memchr(flashEntries[0].value, '\0', SETTINGS_MAX_VALUE_LENGTH) ==
+           NULL ||
+       (uint32_t)strtoul(flashEntries[0].value, NULL, SETTINGS_BASE_10) !=
+           magic) {
+     return false;
+   }
+   for (uint16_t i = 0; i < defaultNumEntries; i++) {
+     const SettingsConfigEntry *entry = &flashEntries[i + 1];
+     if (strncmp(entry->key, defaultEntries[i].key, SETTINGS_MAX_KEY_LENGTH) !=
+             0 ||
+         checkKeyFormat(entry->key) != 0 ||
+         checkTypeFormat(entry->dataType) != 0 ||
+         memchr(entry->value, '\0', SETTINGS_MAX_VALUE_LENGTH) == NULL) {
+       return false;
+     }
+   }
+   return true;
+ }
+ 
+ /**
+  * @brief Save the entry array in the block layout.
+  *
+  * The flash is written from a snapshot of the entries: interrupts are
+  * enabled between chunks and a handler may update an entry meanwhile. Such
+  * an update stays dirty for the next save.
+  */
+ static int settingsBlockSave(SettingsContext *ctx, bool disableInterrupts) {
+   // Check if we don't exceed the reserved space
+   size_t totalUsed = ctx->configData.count * sizeof(SettingsConfigEntry);
+   if (totalUsed > ctx->flashSettingsSize) {
+     DPRINTF("Error: config size %zu exceeds reserved space %u.\n", totalUsed,
+             ctx->flashSettingsSize);
+     return -1;
+   }
+ 
+   DPRINTF("Writing %zu entries to FLASH (size=%zu bytes).\n",
+           ctx->configData.count, totalUsed);
+ 
+   uint8_t *shadow = (uint8_t *)malloc(ctx->flashSettingsSize);
+   if (!shadow) {
+     DPRINTF("Error: Unable to allocate memory for the flash snapshot.\n");
+     return -1;
+   }
+   uint32_t ints = save_and_disable_interrupts();
+   memcpy(shadow, ctx->configData.entries, ctx->flashSettingsSize);
+   if (ctx->xipView) {
+     // Merge the overlay, and serve reads from the snapshot while the flash
+     // region is being rewritten
+     SettingsConfigEntry *merged = (SettingsConfigEntry *)shadow;
+     for (size_t i = 0; i < ctx->configData.count; i++) {
+       merged[i] = *settingsEntryAt(ctx, i);
+     }
+     ctx->configData.entries = merged;
+   }
+   settingsClearDirty(ctx);
+   restore_interrupts(ints);
+ 
+   int err = settingsFlashErase(ctx, ctx->flashSettingsOffset,
+                                ctx->flashSettingsSize, disableInterrupts);
+   if (err == 0) {
+     err = settingsFlashProgram(ctx, ctx->flashSettingsOffset, shadow,
+                                ctx->flashSettingsSize, disableInterrupts);
+   }
+ 
+   if (!ctx->xipView) {
+     free(shadow);
+   } else {
+     // On failure the snapshot is kept as the RAM entry array
+     settingsXipViewSaved(ctx, err == 0);
+     if (err == 0) {
+       free(shadow);
+     }
+   }
+ 
+   if (err != 0) {
+     settingsMarkAllDirty(ctx);
+   }
+   return err;
+ }
+ 
+ /**
+  * @brief Initialization of a context holding its entries in RAM.
+  */
+ static int settingsInitContext(SettingsContext *ctx,
+                                const SettingsConfigEntry *defaultEntries,
+                                uint16_t defaultNumEntries,
+                                uint32_t flashOffset, uint32_t flashSize,
+                                uint16_t magic, uint16_t version) {
    // 1) Validate/Assign flash parameters
    assert(flashSize % SETTINGS_FLASH_PAGE_SIZE == 0);
    ctx->flashSettingsSize = flashSize;
@@ -214,17 +574,28 @@
    DPRINTF("Flash settings offset: 0x%lx\n",
            (unsigned long)ctx->flashSettingsOffset);
  
-   // 2) Allocate memory for all possible entries
-   size_t maxEntries = ctx->flashSettingsSize / sizeof(SettingsConfigEntry);
+   // 2) Allocate memory for all possible entries. The whole region is
+   // programmed straight from this buffer.
+   size_t bufferSize = ctx->flashSettingsSize;
+   size_t maxEntries = bufferSize / sizeof(SettingsConfigEntry);
    DPRINTF("Max entries count: %zu\n", maxEntries);
  
    assert(defaultNumEntries <= maxEntries);
    DPRINTF("Default entries count: %d\n", defaultNumEntries);
  
    // 3) Prepare the configData structure
-   ctx->configData.entries =
-       (SettingsConfigEntry *)malloc(ctx->flashSettingsSize);
-   if (!ctx->configData.entries) {
+   ctx->index = NULL;
+   ctx->indexMask = 0;
+   ctx->generation = 0;
+   ctx->saveCount = 0;
+   ctx->skipCount = 0;
+   ctx->irqOffMaxUs = 0;
+   ctx->xipView = false;
+   ctx->overlay = NULL;
+   settingsInitFlashStats(ctx);
+   ctx->dirty = (uint8_t *)calloc((defaultNumEntries + 1 + 7) / 8, 1);
+   ctx->configData.entries = (SettingsConfigEntry *)malloc(bufferSize);
+   if (!ctx->configData.entries || !ctx->dirty) {
      DPRINTF("Error: Unable to allocate memory for config entries.\n");
      return -1;
    }
@@ -260,9 +631,10 @@
           defaultNumEntries * sizeof(SettingsConfigEntry));
  
    // 6) Load from flash (or default) into ctx->configData
-   int error = settingsLoadAllEntries(ctx, defaultEntriesWithMagic,
-                                      (uint16_t)(defaultNumEntries + 1),
-                                      (uint16_t)maxEntries);
+   // First, load default entries
+   settingsLoadDefaultEntries(ctx, defaultEntriesWithMagic,
+                              (uint16_t)(defaultNumEntries + 1));
+   int error = settingsLoadBlockEntries(ctx, (uint16_t)(defaultNumEntries + 1));
  
    free(defaultEntriesWithMagic);
  
@@ -270,14 +642,97 @@
    return (error == 0 ? (int)ctx->configData.count : error);
  }
  
+ /*
+  * -----------
+  * PUBLIC API IMPLEMENTATION
+  * -----------
+  */
+ 
+ int settings_flash_execute(void (*func)(void *), void *param) {
+   int err = flash_safe_execute(func, param, SETTINGS_FLASH_SAFE_TIMEOUT_MS);
+   if (err == PICO_ERROR_NOT_PERMITTED) {
+     // The other core is not a lockout victim: it was never launched and
+     // waits in the bootrom, not in flash. Masking this core is enough.
+     uint32_t ints = save_and_disable_interrupts();
+     func(param);
+     restore_interrupts(ints);
+     err = PICO_OK;
+   }
+   return err;
+ }
+ 
+ int settings_init(SettingsContext *ctx,
+                   const SettingsConfigEntry *defaultEntries,
+                   uint16_t defaultNumEntries, uint32_t flashOffset,
+                   uint32_t flashSize, uint16_t magic, uint16_t version) {
+   return settingsInitContext(ctx, defaultEntries, defaultNumEntries,
+                              flashOffset, flashSize, magic, version);
+ }
+ 
+ int settings_init_xip(SettingsContext *ctx,
+                       const SettingsConfigEntry *defaultEntries,
+                       uint16_t defaultNumEntries, uint32_t flashOffset,
+                       uint32_t flashSize, uint16_t magic, uint16_t version) {
+   uint32_t combinedMagic =
+       ((uint32_t)magic << SETTINGS_SHIFT_LEFT_16_BITS) | version;
+   const SettingsConfigEntry *flashEntries =
+       (const SettingsConfigEntry *)(SETTINGS_XIP_BASE + flashOffset);
+   size_t count = (size_t)defaultNumEntries + 1;
+ 
+   if (count * sizeof(SettingsConfigEntry) > flashSize ||
+       !settingsXipViewMatches(flashEntries, defaultEntries, defaultNumEntries,
+                               combinedMagic)) {
+     DPRINTF("No matching settings in FLASH to read in place. Using RAM.\n");
+     return settings_init(ctx, defaultEntries, defaultNumEntries, flashOffset,
+                          flashSize, magic, version);
+   }
+ 
+   assert(flashSize % SETTINGS_FLASH_PAGE_SIZE == 0);
+   assert(flashOffset % SETTINGS_FLASH_PAGE_SIZE == 0);
+   ctx->flashSettingsSize = flashSize;
+   ctx->flashSettingsOffset = flashOffset;
+   ctx->index = NULL;
+   ctx->indexMask = 0;
+   ctx->generation = 0;
+   ctx->saveCount = 0;
+   ctx->skipCount = 0;
+   ctx->irqOffMaxUs = 0;
+   ctx->xipView = true;
+   settingsInitFlashStats(ctx);
+   ctx->configData.magic = combinedMagic;
+   ctx->configData.entries = (SettingsConfigEntry *)flashEntries;
+   ctx->configData.count = count;
+   ctx->dirty = (uint8_t *)calloc((count + 7) / 8, 1);
+   ctx->overlay =
+       (SettingsConfigEntry **)calloc(count, sizeof(SettingsConfigEntry *));
+   if (!ctx->dirty || !ctx->overlay) {
+     DPRINTF("Error: Unable to allocate memory for the settings overlay.\n");
+     return -1;
+   }
+   settingsBuildIndex(ctx);
+ 
+   DPRINTF("Reading %zu entries in place from FLASH at 0x%lx.\n", count,
+           (unsigned long)flashOffset);
+   return (int)count;
+ }
+ 
  int settings_deinit(SettingsContext *ctx) {
    if (!ctx) return -1;
  
-   // Reset the entire structure
-   if (ctx->configData.entries) {
+   // Reset the entire structure (an XIP view does not own its entries)
+   if (ctx->configData.entries && !ctx->xipView) {
      free(ctx->configData.entries);
-     ctx->configData.entries = NULL;
    }
+   ctx->configData.entries = NULL;
+   settingsXipViewFreeOverlay(ctx);
+   ctx->xipView = false;
+   free(ctx->flashStats.sectorErases);
+   ctx->flashStats.sectorErases = NULL;
+   free(ctx->index);
+   ctx->index = NULL;
+   ctx->indexMask = 0;
+   free(ctx->dirty);
+   ctx->dirty = NULL;
    ctx->configData.count = 0;
    ctx->flashSettingsSize = SETTINGS_DEFAULT_FLASH_SIZE;
    ctx->flashSettingsOffset = 0;
@@ -288,47 +743,47 @@
  int settings_save(SettingsContext *ctx, bool disable_interrupts) {
    if (!ctx) return -1;
  
-   // Check if we don't exceed the reserved space
-   size_t totalUsed = ctx->configData.count * sizeof(SettingsConfigEntry);
-   if (totalUsed > ctx->flashSettingsSize) {
-     DPRINTF("Error: config size %zu exceeds reserved space %u.\n", totalUsed,
-             ctx->flashSettingsSize);
-     return -1;
+   if (!settingsAnyDirty(ctx)) {
+     ctx->skipCount++;
+     DPRINTF("Settings unchanged, save skipped (%lu saved, %lu skipped).\n",
+             (unsigned long)ctx->saveCount, (unsigned long)ctx->skipCount);
+     return 0;
    }
- 
-   DPRINTF("Writing %zu entries to FLASH (size=%zu bytes).\n",
-           ctx->configData.count, totalUsed);
- 
-   uint32_t ints = 0;
-   if (disable_interrupts) {
-     ints = save_and_disable_interrupts();
-   }
- 
-   flash_range_erase(ctx->flashSettingsOffset, ctx->flashSettingsSize);
-   flash_range_program(ctx->flashSettingsOffset,
-                       (uint8_t *)ctx->configData.entries,
-                       ctx->flashSettingsSize);
- 
-   if (disable_interrupts) {
-     restore_interrupts(ints);
-   }
- 
-   return 0;
+   ctx->saveCount++;
+   ctx->irqOffMaxUs = 0;
+ 
+   int err = settingsBlockSave(ctx, disable_interrupts);
+   DPRINTF(
+       "Settings saved: longest interrupts-off window %lu us. Since init: "
+       "%lu sector erases, %lu bytes programmed, %lu us in flash.\n",
+       (unsigned long)ctx->irqOffMaxUs,
+       (unsigned long)ctx->flashStats.erasedSectors,
+       (unsigned long)ctx->flashStats.programmedBytes,
+       (unsigned long)ctx->flashStats.busyUs);
+   return err;
  }
  
  int settings_erase(SettingsContext *ctx) {
    if (!ctx) return -1;
  
    // Erase the flash region
-   uint32_t ints = save_and_disable_interrupts();
-   flash_range_erase(ctx->flashSettingsOffset, ctx->flashSettingsSize);
-   restore_interrupts(ints);
+   settingsFlashErase(ctx, ctx->flashSettingsOffset, ctx->flashSettingsSize,
+                      true);
  
    // Free and reset
-   if (ctx->configData.entries) {
+   if (ctx->configData.entries && !ctx->xipView) {
      free(ctx->configData.entries);
-     ctx->configData.entries = NULL;
    }
+   ctx->configData.entries = NULL;
+   settingsXipViewFreeOverlay(ctx);
+   ctx->xipView = false;
+   free(ctx->flashStats.sectorErases);
+   ctx->flashStats.sectorErases = NULL;
+   free(ctx->index);
+   ctx->index = NULL;
+   ctx->indexMask = 0;
+   free(ctx->dirty);
+   ctx->dirty = NULL;
    ctx->configData.count = 0;
  
    return 0;
@@ -337,19 +792,19 @@
  SettingsConfigEntry *settings_find_entry(
      SettingsContext *ctx, const char *key) {
    if (!ctx) return NULL;
-   if (checkKeyFormat(key) != 0) {
-     DPRINTF("Invalid key format for key %s.\n", key);
+ 
+   int pos = settingsFindPosition(ctx, key);
+   if (pos < 0) {
+     DPRINTF("Key %s not found.\n", key);
      return NULL;
    }
+   return settingsEntryAt(ctx, (size_t)pos);
+ }
  
-   for (size_t i = 0; i < ctx->configData.count; i++) {
-     if (strncmp(ctx->configData.entries[i].key, key, SETTINGS_MAX_KEY_LENGTH) ==
-         0) {
-       return &ctx->configData.entries[i];
-     }
-   }
-   DPRINTF("Key %s not found.\n", key);
-   return NULL;
+ SettingsConfigEntry *settings_get_entry(SettingsContext *ctx,
+                                         size_t position) {
+   if (!ctx || position >= ctx->configData.count) return NULL;
+   return settingsEntryAt(ctx, position);
  }
  
  /**
@@ -359,28 +814,36 @@
                                 const char *key,
                                 SettingsDataType dataType,
                                 const char *value) {
-   if (checkKeyFormat(key) != 0) {
-     DPRINTF("Invalid key format: %s\n", key);
-     return -1;
-   }
    if (checkTypeFormat(dataType) != 0) {
      DPRINTF("Invalid data type for key: %s\n", key);
      return -1;
    }
  
-   for (size_t i = 0; i < ctx->configData.count; i++) {
-     if (strncmp(ctx->configData.entries[i].key, key, SETTINGS_MAX_KEY_LENGTH) ==
-         0) {
-       // Key found, update
-       ctx->configData.entries[i].dataType = dataType;
-       strncpy(ctx->configData.entries[i].value, value,
-               SETTINGS_MAX_VALUE_LENGTH - 1);
-       ctx->configData.entries[i].value[SETTINGS_MAX_VALUE_LENGTH - 1] = '\0';
-       return 0;
+   int pos = settingsFindPosition(ctx, key);
+   if (pos < 0) {
+     DPRINTF("Key %s not found (cannot update).\n", key);
+     return -1;
+   }
+ 
+   SettingsConfigEntry *entry = settingsEntryAt(ctx, (size_t)pos);
+   if (entry->dataType == dataType &&
+       strncmp(entry->value, value, SETTINGS_MAX_VALUE_LENGTH - 1) == 0) {
+     // Same value: nothing to persist
+     return 0;
+   }
+   if (ctx->xipView) {
+     entry = settingsXipViewWritable(ctx, (size_t)pos);
+     if (!entry) {
+       DPRINTF("Error: Unable to allocate memory for key %s.\n", key);
+       return -1;
      }
    }
-   DPRINTF("Key %s not found (cannot update).\n", key);
-   return -1;
+   entry->dataType = dataType;
+   strncpy(entry->value, value, SETTINGS_MAX_VALUE_LENGTH - 1);
+   entry->value[SETTINGS_MAX_VALUE_LENGTH - 1] = '\0';
+   settingsMarkDirty(ctx, (size_t)pos);
+   ctx->generation++;
+   return 0;
  }
  
  int settings_put_bool(SettingsContext *ctx,
@@ -437,8 +900,9 @@
  
    // Loop through each entry
    for (size_t i = 0; i < ctx->configData.count && remaining > 0; i++) {
+     const SettingsConfigEntry *entry = settingsEntryAt(ctx, i);
      const char *typeStr = "UNK";
-     switch (ctx->configData.entries[i].dataType) {
+     switch (entry->dataType) {
        case SETTINGS_TYPE_INT:
          typeStr = "INT";
          break;
@@ -455,8 +919,7 @@
  
      // Print in the format: "KEY (TYPE): Value\n"
      len = snprintf(ptr, remaining, "%s (%s): %s\n",
-                    ctx->configData.entries[i].key, typeStr,
-                    ctx->configData.entries[i].value);
+                    entry->key, typeStr, entry->value);
  
      ptr += len;
      remaining = (len < remaining) ? (remaining - len) : 0;
@@ -16,6 +16,8 @@
  #include <hardware/resets.h>
  #include <hardware/sync.h>
  #include <hardware/watchdog.h>
+ #include <pico/flash.h>
+ #include <pico/time.h>
  #include <stdbool.h>
  #include <stdio.h>
  #include <stdlib.h>
@@ -77,6 +79,34 @@
  #define SETTINGS_BASE_10 10
  #define SETTINGS_SHIFT_LEFT_16_BITS 16
  
+ /**
+  * @brief Key index constants. The index is an open-addressing hash table of
+  * entry positions, sized to the next power of two that keeps the load factor
+  * at or below 50%.
+  */
+ #define SETTINGS_INDEX_EMPTY 0xFFFF
+ #define SETTINGS_INDEX_MIN_SLOTS 8
+ #define SETTINGS_FNV1A_OFFSET_BASIS 2166136261u
+ #define SETTINGS_FNV1A_PRIME 16777619u
+ 
+ /**
+  * @brief Address where the settings flash is memory mapped. A build that
+  * backs the flash with something else (an image file on a development host,
+  * for instance) defines it before including this header and provides
+  * flash_range_erase() and flash_range_program().
+  */
+ #ifndef SETTINGS_XIP_BASE
+ #define SETTINGS_XIP_BASE XIP_BASE
+ #endif
+ 
+ /**
+  * @brief Flash geometry: erases are done one sector and programs one page
+  * at a time.
+  */
+ #define SETTINGS_FLASH_SECTOR_SIZE 4096
+ #define SETTINGS_FLASH_PROGRAM_PAGE_SIZE 256
+ #define SETTINGS_FLASH_SAFE_TIMEOUT_MS 100  // flash_safe_execute() lockout
+ 
  /**
   * @brief Enumeration of possible data types for configuration entries.
   */
@@ -88,6 +118,11 @@
  
  /**
   * @brief Structure representing a single configuration entry.
+  *
+  * A flash region holds the entries as a plain array, rewritten in place on
+  * each save. The IKBD firmware reads the global configuration block with
+  * this layout, so the block cannot become an append-only journal or a packed
+  * binary encoding without a matching change there.
   */
  typedef struct {
    char key[SETTINGS_MAX_KEY_LENGTH];      ///< The configuration key (name)
@@ -104,6 +139,16 @@
    size_t count;                  ///< Number of configuration entries
  } ConfigData;
  
+ /**
+  * @brief Flash wear and cost counters of a context, since its init.
+  */
+ typedef struct {
+   uint32_t *sectorErases;    ///< Erase count of every sector of the region
+   uint32_t erasedSectors;    ///< Sector erases, all sectors together
+   uint32_t programmedBytes;  ///< Bytes programmed
+   uint32_t busyUs;           ///< Time spent erasing and programming
+ } SettingsFlashStats;
+ 
  /**
   * @brief The "context" structure holding all state for one "instance"
   *        of the settings manager (e.g. for one block in flash).
@@ -112,6 +157,16 @@
    ConfigData configData;
    uint32_t flashSettingsSize;
    uint32_t flashSettingsOffset;
+   uint8_t *dirty;  ///< Bitmap of entries changed since the last save
+   uint16_t *index;     ///< Hash slots holding entry positions (or EMPTY)
+   uint16_t indexMask;  ///< Number of slots minus one (power of two)
+   uint32_t generation;  ///< Bumped on every entry update (cache validation)
+   uint32_t saveCount;   ///< settings_save() calls that wrote to flash
+   uint32_t skipCount;   ///< settings_save() calls skipped (nothing changed)
+   uint32_t irqOffMaxUs;  ///< Longest interrupts-off window of the last save
+   bool xipView;  ///< Entries read in place from flash (settings_init_xip)
+   SettingsConfigEntry **overlay;  ///< Per position RAM copy, or NULL
+   SettingsFlashStats flashStats;  ///< Wear counters of the flash region
  } SettingsContext;
  
  /**
@@ -137,6 +192,38 @@
                    uint16_t defaultNumEntries, uint32_t flashOffset,
                    uint32_t flashSize, uint16_t magic, uint16_t version);
  
+ /**
+  * @brief Initialize a block settings context that reads from flash in place.
+  *
+  * Same contract as settings_init(). When flash holds exactly the default
+  * keys in order (as left by a previous save), the entries are not copied to
+  * RAM: lookups resolve against the memory-mapped flash, and settings_put_*
+  * copies the entry it changes into a RAM overlay. A save merges the overlay
+  * into the region and drops the overlaid entries. Otherwise the context
+  * falls back to a RAM copy, exactly like settings_init().
+  *
+  * Entry pointers are valid until the next save of the context.
+  */
+ int settings_init_xip(SettingsContext *ctx,
+                       const SettingsConfigEntry *defaultEntries,
+                       uint16_t defaultNumEntries, uint32_t flashOffset,
+                       uint32_t flashSize, uint16_t magic, uint16_t version);
+ 
+ /**
+  * @brief Run a flash erase or program with interrupts off and the other
+  * core kept out of flash.
+  *
+  * Goes through flash_safe_execute(). That call refuses to run
+  * (PICO_ERROR_NOT_PERMITTED) when core 1 was not set up as a multicore
+  * lockout victim, which is always the case in firmware that never launches
+  * core 1: then func runs with only this core's interrupts disabled.
+  *
+  * @param func  The flash operation.
+  * @param param Passed to func.
+  * @return int  PICO_OK, or the flash_safe_execute() error (timeout).
+  */
+ int settings_flash_execute(void (*func)(void *), void *param);
+ 
  /**
   * @brief Deinitializes the settings module (for one context).
   *
@@ -150,6 +237,15 @@
  /**
   * @brief Save the current configuration settings to flash (for one context).
   *
+  * Nothing is written when no entry changed since the last save (or since
+  * the values were loaded from flash); the call then only bumps skipCount.
+  *
+  * The flash is erased one sector and programmed one page at a time. With
+  * disable_interrupts, each chunk runs through settings_flash_execute() and
+  * interrupts are enabled again between chunks, so the radio and network
+  * stacks keep being serviced during a save; irqOffMaxUs reports the longest
+  * window. Entries updated while the save runs stay dirty for the next one.
+  *
   * @param ctx               Pointer to the SettingsContext.
   * @param disable_interrupts If true, interrupts will be disabled while writing.
   * @return int             0 on success, non-zero on failure.
@@ -180,6 +276,9 @@
  /**
   * @brief Find a configuration entry by its key.
   *
+  * Resolved through the hashed key index built by settings_init(), so the
+  * cost does not depend on the number of entries in the context.
+  *
   * @param ctx Pointer to the SettingsContext.
   * @param key The key of the configuration entry to find.
   * @return Pointer to the found entry, or NULL if not found or invalid key.
@@ -187,6 +286,19 @@
  SettingsConfigEntry *settings_find_entry(
      SettingsContext *ctx, const char *key);
  
+ /**
+  * @brief Get a configuration entry by its position in the entries array.
+  *
+  * Position 0 is always the MAGICVERSION entry; the default entries passed to
+  * settings_init() follow in the same order. Constant time, no key handling.
+  *
+  * @param ctx      Pointer to the SettingsContext.
+  * @param position Position of the entry.
+  * @return Pointer to the entry, or NULL if the position is out of range.
+  */
+ SettingsConfigEntry *settings_get_entry(SettingsContext *ctx,
+                                         size_t position);
+ 
  /**
   * @brief Update a boolean configuration entry.
   *
@@ -0,0 +1,105 @@
+/**
+ * @file settings_internal.h
+ *
+ * @brief Private helpers of the settings manager, kept out of settings.h.
+ * Not meant to be included by users of the settings library.
+ */
+
+ #ifndef SETTINGS_INTERNAL_H
+ #define SETTINGS_INTERNAL_H
+
+ #include "settings.h"
+
+ /**
+  * @brief Current entry at the given position: the RAM overlay copy if the
+  * entry was changed in an XIP view, the entry array otherwise.
+  */
+ static inline SettingsConfigEntry *settingsEntryAt(const SettingsContext *ctx,
+                                                    size_t position) {
+   if (ctx->overlay && ctx->overlay[position]) {
+     return ctx->overlay[position];
+   }
+   return &ctx->configData.entries[position];
+ }
+ 
+ /**
+  * @brief Mark the entry at the given position as changed since the last save.
+  */
+ static inline void settingsMarkDirty(SettingsContext *ctx, size_t position) {
+   if (ctx->dirty) {
+     ctx->dirty[position / 8] |= (uint8_t)(1u << (position % 8));
+   }
+ }
+
+ /**
+  * @brief Check whether the entry at the given position changed.
+  */
+ static inline bool settingsIsDirty(const SettingsContext *ctx,
+                                    size_t position) {
+   return ctx->dirty &&
+          (ctx->dirty[position / 8] & (uint8_t)(1u << (position % 8))) != 0;
+ }
+
+ /**
+  * @brief Mark the entry at the given position as matching flash.
+  */
+ static inline void settingsMarkClean(SettingsContext *ctx, size_t position) {
+   if (ctx->dirty) {
+     ctx->dirty[position / 8] &= (uint8_t)~(1u << (position % 8));
+   }
+ }
+ 
+ /**
+  * @brief Mark every entry as changed (nothing persisted yet).
+  */
+ static inline void settingsMarkAllDirty(SettingsContext *ctx) {
+   for (size_t i = 0; i < ctx->configData.count; i++) {
+     settingsMarkDirty(ctx, i);
+   }
+ }
+ 
+ /**
+  * @brief Check whether any entry changed since the last save.
+  */
+ static inline bool settingsAnyDirty(const SettingsContext *ctx) {
+   if (!ctx->dirty) {
+     return true;
+   }
+   for (size_t i = 0; i < ((size_t)ctx->configData.count + 7) / 8; i++) {
+     if (ctx->dirty[i] != 0) {
+       return true;
+     }
+   }
+   return false;
+ }
+ 
+ /**
+  * @brief Forget all pending changes (after they have been persisted).
+  */
+ static inline void settingsClearDirty(SettingsContext *ctx) {
+   if (ctx->dirty) {
+     memset(ctx->dirty, 0, (ctx->configData.count + 7) / 8);
+   }
+ }
+
+ /**
+  * @brief Erase a flash range (sector aligned) one sector at a time.
+  *
+  * With disableInterrupts, every sector runs under settings_flash_execute(),
+  * so interrupts are only off (and the other core locked out) for one sector
+  * erase; ctx->irqOffMaxUs keeps the longest such window. Returns 0 on
+  * success, -1 if the flash could not be accessed safely.
+  */
+ int settingsFlashErase(SettingsContext *ctx, uint32_t offset, uint32_t size,
+                        bool disableInterrupts);
+ 
+ /**
+  * @brief Program a flash range (page aligned) one page at a time, like
+  * settingsFlashErase().
+  */
+ int settingsFlashProgram(SettingsContext *ctx, uint32_t offset,
+                          const uint8_t *data, uint32_t size,
+                          bool disableInterrupts);
+ 
+
+ #endif  // SETTINGS_INTERNAL_H
@@ -0,0 +1,121 @@
+/**
+ * @file flash_emu.c
+ *
+ * @brief Host implementation of the flash, interrupt and timer calls the
+ * settings library makes, over a memory mapped image.
+ */
+
+#include "flash_emu.h"
+
+#include <assert.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+#include "pico/flash.h"
+#include "pico/time.h"
+
+uint8_t *flash_emu_image = NULL;
+
+static flash_emu_stats_t stats;
+
+// Maps the image on first use
+static void flashEmuMap(void) {
+  if (flash_emu_image != NULL) {
+    return;
+  }
+  const char *path = getenv("FLASH_EMU_IMAGE");
+  void *image;
+  if (path != NULL && path[0] != '\0') {
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0 || ftruncate(fd, FLASH_EMU_SIZE) != 0) {
+      perror(path);
+      exit(2);
+    }
+    image = mmap(NULL, FLASH_EMU_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+                 0);
+    close(fd);
+    if (image != MAP_FAILED && st.st_size == 0) {
+      memset(image, 0xFF, FLASH_EMU_SIZE);  // A new file is a blank flash
+    }
+  } else {
+    image = mmap(NULL, FLASH_EMU_SIZE, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (image != MAP_FAILED) {
+      memset(image, 0xFF, FLASH_EMU_SIZE);
+    }
+  }
+  if (image == MAP_FAILED) {
+    perror("mmap");
+    exit(2);
+  }
+  flash_emu_image = (uint8_t *)image;
+}
+
+void flash_emu_reset(void) {
+  flashEmuMap();
+  memset(flash_emu_image, 0xFF, FLASH_EMU_SIZE);
+  flash_emu_clear_stats();
+}
+
+const flash_emu_stats_t *flash_emu_stats(void) { return &stats; }
+
+void flash_emu_clear_stats(void) { memset(&stats, 0, sizeof(stats)); }
+
+uint64_t flash_emu_now_ns(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+void flash_range_erase(uint32_t flash_offs, size_t count) {
+  assert(flash_offs % FLASH_SECTOR_SIZE == 0);
+  assert(count % FLASH_SECTOR_SIZE == 0);
+  assert(flash_offs + count <= FLASH_EMU_SIZE);
+  flashEmuMap();
+  memset(&flash_emu_image[flash_offs], 0xFF, count);
+  for (size_t done = 0; done < count; done += FLASH_SECTOR_SIZE) {
+    stats.sectorErases[(flash_offs + done) / FLASH_SECTOR_SIZE]++;
+    stats.erases++;
+    stats.busyUs += FLASH_EMU_SECTOR_ERASE_US;
+  }
+}
+
+void flash_range_program(uint32_t flash_offs, const uint8_t *data,
+                         size_t count) {
+  assert(flash_offs % FLASH_PAGE_SIZE == 0);
+  assert(count % FLASH_PAGE_SIZE == 0);
+  assert(flash_offs + count <= FLASH_EMU_SIZE);
+  flashEmuMap();
+  uint8_t *dst = &flash_emu_image[flash_offs];
+  for (size_t i = 0; i < count; i++) {
+    stats.bitsSet += (uint32_t)__builtin_popcount(data[i] & ~dst[i] & 0xFF);
+    dst[i] &= data[i];
+  }
+  stats.programmedBytes += (uint32_t)count;
+  stats.programmedPages += (uint32_t)(count / FLASH_PAGE_SIZE);
+  stats.busyUs += (uint64_t)(count / FLASH_PAGE_SIZE) *
+                  FLASH_EMU_PAGE_PROGRAM_US;
+}
+
+uint32_t save_and_disable_interrupts(void) { return 0; }
+
+void restore_interrupts(uint32_t status) { (void)status; }
+
+int flash_safe_execute(void (*func)(void *), void *param,
+                       uint32_t enter_exit_timeout_ms) {
+  (void)func;
+  (void)param;
+  (void)enter_exit_timeout_ms;
+  return PICO_ERROR_NOT_PERMITTED;
+}
+
+uint32_t time_us_32(void) { return (uint32_t)(flash_emu_now_ns() / 1000u); }
@@ -0,0 +1,53 @@
+/**
+ * @file flash_emu.h
+ *
+ * @brief Flash emulator for the host builds of the settings library.
+ *
+ * The image is memory mapped, from the file named by the FLASH_EMU_IMAGE
+ * environment variable if set (so it persists between runs), anonymous
+ * otherwise. settings.h reads it through SETTINGS_XIP_BASE, defined by
+ * CMakeLists.txt. Erases and programs behave like NOR flash (an erase sets
+ * the bytes to 0xFF, a program can only clear bits), and are counted and
+ * timed with the typical figures of the W25Q16JV of the Pico W.
+ */
+
+#ifndef FLASH_EMU_H
+#define FLASH_EMU_H
+
+#include <stdint.h>
+
+#define FLASH_EMU_SIZE (256 * 1024)
+#define FLASH_EMU_SECTORS (FLASH_EMU_SIZE / 4096)
+
+// W25Q16JV datasheet, typical: 4 KB sector erase and 256 byte page program
+#define FLASH_EMU_SECTOR_ERASE_US 45000
+#define FLASH_EMU_PAGE_PROGRAM_US 400
+
+extern uint8_t *flash_emu_image;
+
+typedef struct {
+  uint32_t sectorErases[FLASH_EMU_SECTORS];  // Erases of every sector
+  uint32_t erases;                           // Sector erases in total
+  uint32_t programmedBytes;                  // Bytes programmed
+  uint32_t programmedPages;                  // Pages programmed
+  uint32_t bitsSet;  // Bits a program tried to turn from 0 to 1 (a bug)
+  uint64_t busyUs;   // Modelled erase and program time
+} flash_emu_stats_t;
+
+/**
+ * @brief Erase the whole image, as a blank flash, and zero the counters.
+ */
+void flash_emu_reset(void);
+
+/**
+ * @brief Counters since the last flash_emu_reset() or flash_emu_clear_stats().
+ */
+const flash_emu_stats_t *flash_emu_stats(void);
+void flash_emu_clear_stats(void);
+
+/**
+ * @brief Monotonic time in nanoseconds, for the benchmarks.
+ */
+uint64_t flash_emu_now_ns(void);
+
+#endif  // FLASH_EMU_H
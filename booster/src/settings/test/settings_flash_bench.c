@@ -0,0 +1,226 @@
+/**
+ * @file settings_flash_bench.c
+ *
+ * @brief Host benchmark suite of the settings library over the flash
+ * emulator: init, lookup, put, save and a replay of the boot sequence, at
+ * 25, 100 and 500 keys.
+ *
+ * Host times are wall clock on this machine. Flash costs come from the
+ * emulator: sector erases, bytes programmed and the time the W25Q16JV would
+ * be busy (typical datasheet figures). Fails when a program tried to set a
+ * bit an erase had not set, or when the wear counters of the context do not
+ * match the emulator's.
+ *
+ * Usage: settings_flash_bench [rounds] [boots]
+ */
+
+#include <string.h>
+
+#include "settings_test_util.h"
+
+int testFailures = 0;
+
+static unsigned rounds = 100;
+static unsigned boots = 50;
+
+static double nsPer(uint64_t ns, double count) { return (double)ns / count; }
+
+// Negative on a blank region, where the context holds the defaults
+static int loadDefaults(SettingsContext *ctx, SettingsConfigEntry *defaults,
+                        size_t count, bool xip) {
+  int (*init)(SettingsContext *, const SettingsConfigEntry *, uint16_t,
+              uint32_t, uint32_t, uint16_t, uint16_t) =
+      xip ? settings_init_xip : settings_init;
+  return init(ctx, defaults, (uint16_t)count, 0, testRegionSize(count),
+              TEST_MAGIC, TEST_VERSION);
+}
+
+// A region saved once, holding the defaults
+static void prepareRegion(SettingsConfigEntry *defaults, size_t count) {
+  SettingsContext ctx;
+  flash_emu_reset();
+  loadDefaults(&ctx, defaults, count, false);
+  CHECK(settings_save(&ctx, true) == 0);
+  settings_deinit(&ctx);
+  flash_emu_clear_stats();
+}
+
+static void benchInit(SettingsConfigEntry *defaults, size_t count) {
+  SettingsContext ctx;
+  flash_emu_reset();
+  uint64_t start = flash_emu_now_ns();
+  for (unsigned r = 0; r < rounds; r++) {
+    loadDefaults(&ctx, defaults, count, false);
+    settings_deinit(&ctx);
+  }
+  uint64_t blank = flash_emu_now_ns() - start;
+
+  prepareRegion(defaults, count);
+  start = flash_emu_now_ns();
+  for (unsigned r = 0; r < rounds; r++) {
+    CHECK(loadDefaults(&ctx, defaults, count, false) >= 0);
+    settings_deinit(&ctx);
+  }
+  uint64_t saved = flash_emu_now_ns() - start;
+
+  start = flash_emu_now_ns();
+  for (unsigned r = 0; r < rounds; r++) {
+    CHECK(loadDefaults(&ctx, defaults, count, true) >= 0);
+    settings_deinit(&ctx);
+  }
+  uint64_t xip = flash_emu_now_ns() - start;
+
+  printf("  init    blank %9.0f ns  saved %9.0f ns  xip %9.0f ns\n",
+         nsPer(blank, rounds), nsPer(saved, rounds), nsPer(xip, rounds));
+}
+
+static void benchLookup(SettingsConfigEntry *defaults, size_t count) {
+  SettingsContext ram, xip;
+  prepareRegion(defaults, count);
+  CHECK(loadDefaults(&ram, defaults, count, false) >= 0);
+  CHECK(loadDefaults(&xip, defaults, count, true) >= 0);
+
+  volatile uintptr_t sink = 0;
+  uint64_t start = flash_emu_now_ns();
+  for (unsigned r = 0; r < rounds; r++) {
+    for (size_t i = 0; i < count; i++) {
+      sink += (uintptr_t)settings_find_entry(&ram, defaults[i].key);
+    }
+  }
+  uint64_t inRam = flash_emu_now_ns() - start;
+
+  start = flash_emu_now_ns();
+  for (unsigned r = 0; r < rounds; r++) {
+    for (size_t i = 0; i < count; i++) {
+      sink += (uintptr_t)settings_find_entry(&xip, defaults[i].key);
+    }
+  }
+  uint64_t inFlash = flash_emu_now_ns() - start;
+  (void)sink;
+
+  double lookups = (double)rounds * (double)count;
+  printf("  lookup  ram %9.1f ns  xip %9.1f ns\n", nsPer(inRam, lookups),
+         nsPer(inFlash, lookups));
+  settings_deinit(&ram);
+  settings_deinit(&xip);
+}
+
+static void benchPut(SettingsConfigEntry *defaults, size_t count) {
+  SettingsContext ram, xip;
+  prepareRegion(defaults, count);
+  CHECK(loadDefaults(&ram, defaults, count, false) >= 0);
+  CHECK(loadDefaults(&xip, defaults, count, true) >= 0);
+
+  uint64_t start = flash_emu_now_ns();
+  for (unsigned r = 0; r < rounds; r++) {
+    for (size_t i = 0; i < count; i++) {
+      settings_put_string(&ram, defaults[i].key, (r & 1) ? "odd" : "even");
+    }
+  }
+  uint64_t inRam = flash_emu_now_ns() - start;
+
+  start = flash_emu_now_ns();
+  for (unsigned r = 0; r < rounds; r++) {
+    for (size_t i = 0; i < count; i++) {
+      settings_put_string(&xip, defaults[i].key, (r & 1) ? "odd" : "even");
+    }
+  }
+  uint64_t overlay = flash_emu_now_ns() - start;
+
+  double puts = (double)rounds * (double)count;
+  printf("  put     ram %9.1f ns  xip %9.1f ns\n", nsPer(inRam, puts),
+         nsPer(overlay, puts));
+  settings_deinit(&ram);
+  settings_deinit(&xip);
+}
+
+static void benchSave(SettingsConfigEntry *defaults, size_t count) {
+  SettingsContext ctx;
+  prepareRegion(defaults, count);
+  CHECK(loadDefaults(&ctx, defaults, count, false) >= 0);
+
+  unsigned saves = rounds < 20 ? rounds : 20;
+  uint64_t start = flash_emu_now_ns();
+  for (unsigned r = 0; r < saves; r++) {
+    settings_put_integer(&ctx, defaults[count / 2].key, (int)r + 1);
+    CHECK(settings_save(&ctx, true) == 0);
+  }
+  uint64_t written = flash_emu_now_ns() - start;
+  const flash_emu_stats_t *stats = flash_emu_stats();
+  CHECK(stats->erases == ctx.flashStats.erasedSectors);
+  CHECK(stats->programmedBytes == ctx.flashStats.programmedBytes);
+  CHECK(stats->bitsSet == 0);
+
+  start = flash_emu_now_ns();
+  for (unsigned r = 0; r < rounds; r++) {
+    CHECK(settings_save(&ctx, true) == 0);
+  }
+  uint64_t skipped = flash_emu_now_ns() - start;
+
+  printf("  save    host %9.0f ns  flash %4.1f erases %6.0f bytes %6.1f ms"
+         "  unchanged %6.1f ns\n",
+         nsPer(written, saves), (double)stats->erases / saves,
+         (double)stats->programmedBytes / saves,
+         (double)stats->busyUs / 1000.0 / saves, nsPer(skipped, rounds));
+  settings_deinit(&ctx);
+}
+
+// Every boot of the firmware: map the saved block, read every entry, update
+// a couple of them (the join outcome, a paired device) and save
+static void benchBootReplay(SettingsConfigEntry *defaults, size_t count) {
+  SettingsContext ctx;
+  prepareRegion(defaults, count);
+
+  uint64_t start = flash_emu_now_ns();
+  for (unsigned b = 0; b < boots; b++) {
+    CHECK(loadDefaults(&ctx, defaults, count, true) >= 0);
+    for (size_t i = 0; i < count; i++) {
+      CHECK(settings_find_entry(&ctx, defaults[i].key) != NULL);
+    }
+    settings_put_integer(&ctx, defaults[0].key, (int)b);
+    settings_put_bool(&ctx, defaults[count - 1].key, (b & 1) != 0);
+    CHECK(settings_save(&ctx, true) == 0);
+    settings_deinit(&ctx);
+  }
+  uint64_t host = flash_emu_now_ns() - start;
+
+  const flash_emu_stats_t *stats = flash_emu_stats();
+  CHECK(stats->bitsSet == 0);
+  uint32_t worst = 0;
+  for (size_t s = 0; s < FLASH_EMU_SECTORS; s++) {
+    worst = stats->sectorErases[s] > worst ? stats->sectorErases[s] : worst;
+  }
+  printf("  boot    host %9.0f ns  flash %4.1f erases %6.0f bytes %6.1f ms"
+         "  worst sector %u erases in %u boots\n",
+         nsPer(host, boots), (double)stats->erases / boots,
+         (double)stats->programmedBytes / boots,
+         (double)stats->busyUs / 1000.0 / boots, (unsigned)worst, boots);
+}
+
+int main(int argc, char **argv) {
+  if (argc > 1) rounds = (unsigned)strtoul(argv[1], NULL, 10);
+  if (argc > 2) boots = (unsigned)strtoul(argv[2], NULL, 10);
+  if (rounds == 0 || boots == 0) {
+    fprintf(stderr, "usage: %s [rounds] [boots]\n", argv[0]);
+    return 2;
+  }
+
+  static const size_t sizes[] = {25, 100, 500};
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+    SettingsConfigEntry *defaults = testMakeEntries(sizes[i]);
+    printf("%zu keys, %u byte region\n", sizes[i],
+           (unsigned)testRegionSize(sizes[i]));
+    benchInit(defaults, sizes[i]);
+    benchLookup(defaults, sizes[i]);
+    benchPut(defaults, sizes[i]);
+    benchSave(defaults, sizes[i]);
+    benchBootReplay(defaults, sizes[i]);
+    free(defaults);
+  }
+
+  if (testFailures != 0) {
+    fprintf(stderr, "%d check(s) failed\n", testFailures);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file settings_index_bench.c
+ *
+ * @brief Host benchmark of settings_find_entry() at 25, 100 and 500 keys,
+ * against the linear strncmp() scan the index replaced.
+ *
+ * Usage: settings_index_bench [rounds]
+ */
+
+#include <string.h>
+
+#include "settings_test_util.h"
+
+int testFailures = 0;
+
+// The lookup before the index: first entry with the key, in order
+static SettingsConfigEntry *linearFind(SettingsContext *ctx, const char *key) {
+  for (size_t i = 0; i < ctx->configData.count; i++) {
+    SettingsConfigEntry *entry = settings_get_entry(ctx, i);
+    if (strncmp(entry->key, key, SETTINGS_MAX_KEY_LENGTH) == 0) {
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+static void bench(size_t count, unsigned rounds) {
+  SettingsConfigEntry *defaults = testMakeEntries(count);
+  SettingsContext ctx;
+  flash_emu_reset();
+  settings_init(&ctx, defaults, (uint16_t)count, 0, testRegionSize(count),
+                TEST_MAGIC, TEST_VERSION);
+
+  volatile uintptr_t sink = 0;
+  uint64_t start = flash_emu_now_ns();
+  for (unsigned r = 0; r < rounds; r++) {
+    for (size_t i = 0; i < count; i++) {
+      sink += (uintptr_t)settings_find_entry(&ctx, defaults[i].key);
+    }
+  }
+  uint64_t indexed = flash_emu_now_ns() - start;
+
+  start = flash_emu_now_ns();
+  for (unsigned r = 0; r < rounds; r++) {
+    for (size_t i = 0; i < count; i++) {
+      sink += (uintptr_t)linearFind(&ctx, defaults[i].key);
+    }
+  }
+  uint64_t linear = flash_emu_now_ns() - start;
+  (void)sink;
+
+  double lookups = (double)rounds * (double)count;
+  printf("%5zu keys %6u slots  index %8.1f ns/lookup  linear %8.1f ns/lookup\n",
+         count, (unsigned)ctx.indexMask + 1, (double)indexed / lookups,
+         (double)linear / lookups);
+
+  settings_deinit(&ctx);
+  free(defaults);
+}
+
+int main(int argc, char **argv) {
+  unsigned rounds = argc > 1 ? (unsigned)strtoul(argv[1], NULL, 10) : 200;
+  static const size_t sizes[] = {25, 100, 500};
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+    bench(sizes[i], rounds);
+  }
+  return 0;
+}
@@ -0,0 +1,219 @@
+/**
+ * @file settings_index_test.c
+ *
+ * @brief Host tests of the hashed key index of the settings library:
+ * lookups at several sizes, colliding keys, duplicate keys, unknown and
+ * invalid keys, and keys removed from the defaults between two boots.
+ */
+
+#include <string.h>
+
+#include "settings_test_util.h"
+
+int testFailures = 0;
+
+// Same hash as the index: FNV-1a over the key characters
+static uint32_t fnv1a(const char *key) {
+  uint32_t hash = SETTINGS_FNV1A_OFFSET_BASIS;
+  for (size_t i = 0; key[i] != '\0'; i++) {
+    hash = (hash ^ (uint8_t)key[i]) * SETTINGS_FNV1A_PRIME;
+  }
+  return hash;
+}
+
+// Slots of the index of a context with count entries (MAGICVERSION included)
+static uint32_t indexSlots(size_t count) {
+  uint32_t slots = SETTINGS_INDEX_MIN_SLOTS;
+  while (slots < count * 2) {
+    slots <<= 1;
+  }
+  return slots;
+}
+
+static void testLookupAll(size_t count) {
+  SettingsConfigEntry *defaults = testMakeEntries(count);
+  SettingsContext ctx;
+  flash_emu_reset();
+  settings_init(&ctx, defaults, (uint16_t)count, 0, testRegionSize(count),
+                TEST_MAGIC, TEST_VERSION);
+
+  for (size_t i = 0; i < count; i++) {
+    SettingsConfigEntry *entry = settings_find_entry(&ctx, defaults[i].key);
+    CHECK(entry != NULL);
+    CHECK(entry == settings_get_entry(&ctx, i + 1));
+    CHECK(entry && strcmp(entry->value, defaults[i].value) == 0);
+  }
+  CHECK(settings_find_entry(&ctx, SETTINGS_MAGICVERSION_KEY) ==
+        settings_get_entry(&ctx, 0));
+
+  char key[SETTINGS_MAX_KEY_LENGTH];
+  for (size_t i = 0; i < count; i++) {
+    snprintf(key, sizeof(key), "MISSING_%04zu", i);
+    CHECK(settings_find_entry(&ctx, key) == NULL);
+  }
+
+  settings_deinit(&ctx);
+  free(defaults);
+}
+
+static void testInvalidKeys(void) {
+  SettingsConfigEntry *defaults = testMakeEntries(4);
+  SettingsContext ctx;
+  flash_emu_reset();
+  settings_init(&ctx, defaults, 4, 0, testRegionSize(4), TEST_MAGIC,
+                TEST_VERSION);
+
+  CHECK(settings_find_entry(&ctx, NULL) == NULL);
+  CHECK(settings_find_entry(&ctx, "") == NULL);
+  CHECK(settings_find_entry(&ctx, "key_0000") == NULL);
+  CHECK(settings_find_entry(&ctx, "KEY-0000") == NULL);
+  CHECK(settings_put_string(&ctx, "key_0000", "x") != 0);
+
+  settings_deinit(&ctx);
+  free(defaults);
+}
+
+/**
+ * @brief Keys that all hash to the last slot of the table, so their probe
+ * sequence wraps around to slot 0, plus an unknown key on the same slot.
+ */
+static void testCollisions(void) {
+  enum { COLLIDING = 4 };
+  SettingsConfigEntry defaults[COLLIDING];
+  char missing[SETTINGS_MAX_KEY_LENGTH] = {0};
+  uint32_t mask = indexSlots(COLLIDING + 1) - 1;
+  uint32_t magicSlot = fnv1a(SETTINGS_MAGICVERSION_KEY) & mask;
+  uint32_t target = mask == magicSlot ? mask - 1 : mask;
+
+  size_t found = 0;
+  char key[SETTINGS_MAX_KEY_LENGTH];
+  for (unsigned n = 0; found < COLLIDING || missing[0] == '\0'; n++) {
+    snprintf(key, sizeof(key), "C%u", n);
+    if ((fnv1a(key) & mask) != target) {
+      continue;
+    }
+    if (found < COLLIDING) {
+      memset(&defaults[found], 0, sizeof(defaults[found]));
+      strcpy(defaults[found].key, key);
+      defaults[found].dataType = SETTINGS_TYPE_INT;
+      snprintf(defaults[found].value, SETTINGS_MAX_VALUE_LENGTH, "%zu", found);
+      found++;
+    } else {
+      strcpy(missing, key);
+    }
+  }
+
+  SettingsContext ctx;
+  flash_emu_reset();
+  settings_init(&ctx, defaults, COLLIDING, 0, testRegionSize(COLLIDING),
+                TEST_MAGIC, TEST_VERSION);
+  CHECK(ctx.indexMask == mask);
+
+  for (size_t i = 0; i < COLLIDING; i++) {
+    SettingsConfigEntry *entry = settings_find_entry(&ctx, defaults[i].key);
+    CHECK(entry == settings_get_entry(&ctx, i + 1));
+  }
+  CHECK(settings_find_entry(&ctx, missing) == NULL);
+
+  // Updates go through the same probes
+  CHECK(settings_put_integer(&ctx, defaults[COLLIDING - 1].key, 42) == 0);
+  CHECK(strcmp(settings_get_entry(&ctx, COLLIDING)->value, "42") == 0);
+
+  settings_deinit(&ctx);
+}
+
+static void testDuplicateKeys(void) {
+  SettingsConfigEntry defaults[3] = {
+      {"DUP", SETTINGS_TYPE_STRING, "first"},
+      {"OTHER", SETTINGS_TYPE_STRING, "other"},
+      {"DUP", SETTINGS_TYPE_STRING, "second"},
+  };
+  SettingsContext ctx;
+  flash_emu_reset();
+  settings_init(&ctx, defaults, 3, 0, testRegionSize(3), TEST_MAGIC,
+                TEST_VERSION);
+
+  SettingsConfigEntry *entry = settings_find_entry(&ctx, "DUP");
+  CHECK(entry == settings_get_entry(&ctx, 1));
+  CHECK(entry && strcmp(entry->value, "first") == 0);
+
+  settings_deinit(&ctx);
+}
+
+/**
+ * @brief Keys dropped from the defaults of a newer firmware are gone after
+ * the next boot, even though the flash still holds them, and the keys kept
+ * are still found. Also checks the index of an XIP view.
+ */
+static void testRemovedKeys(void) {
+  enum { BEFORE = 40, AFTER = 30 };
+  SettingsConfigEntry *defaults = testMakeEntries(BEFORE);
+  SettingsContext ctx;
+  flash_emu_reset();
+  settings_init(&ctx, defaults, BEFORE, 0, testRegionSize(BEFORE), TEST_MAGIC,
+                TEST_VERSION);
+  for (size_t i = 0; i < BEFORE; i++) {
+    CHECK(settings_put_integer(&ctx, defaults[i].key, (int)i) == 0);
+  }
+  CHECK(settings_save(&ctx, true) == 0);
+  settings_deinit(&ctx);
+
+  // Drop the last keys
+  settings_init(&ctx, defaults, AFTER, 0, testRegionSize(BEFORE), TEST_MAGIC,
+                TEST_VERSION);
+  for (size_t i = 0; i < BEFORE; i++) {
+    SettingsConfigEntry *entry = settings_find_entry(&ctx, defaults[i].key);
+    if (i < AFTER) {
+      CHECK(entry != NULL && entry->dataType == SETTINGS_TYPE_INT &&
+            atoi(entry->value) == (int)i);
+    } else {
+      CHECK(entry == NULL);
+    }
+  }
+  CHECK(settings_save(&ctx, true) == 0);
+  settings_deinit(&ctx);
+
+  // Drop every other key of those left, and read in place
+  SettingsConfigEntry *kept = testMakeEntries(AFTER / 2);
+  for (size_t i = 0; i < AFTER / 2; i++) {
+    kept[i] = defaults[i * 2];
+  }
+  settings_init(&ctx, kept, AFTER / 2, 0, testRegionSize(BEFORE), TEST_MAGIC,
+                TEST_VERSION);
+  for (size_t i = 0; i < AFTER; i++) {
+    SettingsConfigEntry *entry = settings_find_entry(&ctx, defaults[i].key);
+    CHECK((entry != NULL) == (i % 2 == 0));
+  }
+  CHECK(settings_save(&ctx, true) == 0);
+  settings_deinit(&ctx);
+
+  CHECK(settings_init_xip(&ctx, kept, AFTER / 2, 0, testRegionSize(BEFORE),
+                          TEST_MAGIC, TEST_VERSION) == AFTER / 2 + 1);
+  CHECK(ctx.xipView);
+  for (size_t i = 0; i < AFTER / 2; i++) {
+    SettingsConfigEntry *entry = settings_find_entry(&ctx, kept[i].key);
+    CHECK(entry == settings_get_entry(&ctx, i + 1));
+  }
+  CHECK(settings_find_entry(&ctx, defaults[1].key) == NULL);
+  settings_deinit(&ctx);
+
+  free(kept);
+  free(defaults);
+}
+
+int main(void) {
+  testLookupAll(25);
+  testLookupAll(100);
+  testLookupAll(500);
+  testInvalidKeys();
+  testCollisions();
+  testDuplicateKeys();
+  testRemovedKeys();
+
+  if (testFailures != 0) {
+    fprintf(stderr, "%d check(s) failed\n", testFailures);
+    return 1;
+  }
+  printf("settings index: all checks passed\n");
+  return 0;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file settings_test_util.h
+ *
+ * @brief Helpers shared by the host tests and benchmarks of the settings
+ * library.
+ */
+
+#ifndef SETTINGS_TEST_UTIL_H
+#define SETTINGS_TEST_UTIL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "flash_emu.h"
+#include "settings.h"
+
+#define TEST_MAGIC 0x1234
+#define TEST_VERSION 0x0001
+
+extern int testFailures;
+
+#define CHECK(cond)                                                   \
+  do {                                                                \
+    if (!(cond)) {                                                    \
+      fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, \
+              #cond);                                                 \
+      testFailures++;                                                 \
+    }                                                                 \
+  } while (0)
+
+/**
+ * @brief Default entries "KEY_0000" to "KEY_<count - 1>", string typed,
+ * with the key in lowercase as value. Free with free().
+ */
+static inline SettingsConfigEntry *testMakeEntries(size_t count) {
+  SettingsConfigEntry *entries =
+      (SettingsConfigEntry *)calloc(count, sizeof(SettingsConfigEntry));
+  for (size_t i = 0; entries && i < count; i++) {
+    snprintf(entries[i].key, SETTINGS_MAX_KEY_LENGTH, "KEY_%04zu", i);
+    entries[i].dataType = SETTINGS_TYPE_STRING;
+    snprintf(entries[i].value, SETTINGS_MAX_VALUE_LENGTH, "key_%04zu", i);
+  }
+  return entries;
+}
+
+/**
+ * @brief Size of a block region holding count defaults and MAGICVERSION.
+ */
+static inline uint32_t testRegionSize(size_t count) {
+  size_t bytes = (count + 1) * sizeof(SettingsConfigEntry);
+  return (uint32_t)((bytes + SETTINGS_FLASH_SECTOR_SIZE - 1) /
+                    SETTINGS_FLASH_SECTOR_SIZE * SETTINGS_FLASH_SECTOR_SIZE);
+}
+
+#endif  // SETTINGS_TEST_UTIL_H
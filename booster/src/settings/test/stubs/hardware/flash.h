@@ -0,0 +1,24 @@
+/**
+ * @file flash.h
+ *
+ * @brief Host stand-in for the Pico SDK hardware_flash API, backed by the
+ * RAM image of flash_emu.c.
+ */
+
+#ifndef HARDWARE_FLASH_H
+#define HARDWARE_FLASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define FLASH_SECTOR_SIZE 4096u
+#define FLASH_PAGE_SIZE 256u
+#define XIP_BASE 0x10000000u
+
+extern uint8_t *flash_emu_image;
+
+void flash_range_erase(uint32_t flash_offs, size_t count);
+void flash_range_program(uint32_t flash_offs, const uint8_t *data,
+                         size_t count);
+
+#endif  // HARDWARE_FLASH_H
@@ -0,0 +1,10 @@
+/**
+ * @file resets.h
+ *
+ * @brief Host stand-in: nothing from hardware_resets is used by settings.
+ */
+
+#ifndef HARDWARE_RESETS_H
+#define HARDWARE_RESETS_H
+
+#endif  // HARDWARE_RESETS_H
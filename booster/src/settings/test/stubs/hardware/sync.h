@@ -0,0 +1,15 @@
+/**
+ * @file sync.h
+ *
+ * @brief Host stand-in for the Pico SDK interrupt masking calls.
+ */
+
+#ifndef HARDWARE_SYNC_H
+#define HARDWARE_SYNC_H
+
+#include <stdint.h>
+
+uint32_t save_and_disable_interrupts(void);
+void restore_interrupts(uint32_t status);
+
+#endif  // HARDWARE_SYNC_H
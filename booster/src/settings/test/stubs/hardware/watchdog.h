@@ -0,0 +1,10 @@
+/**
+ * @file watchdog.h
+ *
+ * @brief Host stand-in: nothing from hardware_watchdog is used by settings.
+ */
+
+#ifndef HARDWARE_WATCHDOG_H
+#define HARDWARE_WATCHDOG_H
+
+#endif  // HARDWARE_WATCHDOG_H
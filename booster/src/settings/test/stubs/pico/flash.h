@@ -0,0 +1,19 @@
+/**
+ * @file flash.h
+ *
+ * @brief Host stand-in for pico_flash. Like the device firmware, which never
+ * launches core 1, flash_safe_execute() refuses with NOT_PERMITTED.
+ */
+
+#ifndef PICO_FLASH_H
+#define PICO_FLASH_H
+
+#include <stdint.h>
+
+#define PICO_OK 0
+#define PICO_ERROR_NOT_PERMITTED -4
+
+int flash_safe_execute(void (*func)(void *), void *param,
+                       uint32_t enter_exit_timeout_ms);
+
+#endif  // PICO_FLASH_H
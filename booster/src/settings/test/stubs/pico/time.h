@@ -0,0 +1,14 @@
+/**
+ * @file time.h
+ *
+ * @brief Host stand-in for the Pico SDK microsecond timer.
+ */
+
+#ifndef PICO_TIME_H
+#define PICO_TIME_H
+
+#include <stdint.h>
+
+uint32_t time_us_32(void);
+
+#endif  // PICO_TIME_H